@@ -19,18 +19,35 @@
 // OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
 // USE OR OTHER DEALINGS IN THE SOFTWARE.
 
+// Throughput of the base64, hex and utf8 codecs in MB of raw data per
+// second. For utf8, encode means Buffer to string and the data is ASCII.
 var common = require('../common.js');
 
-var bench = common.createBenchmark(main, {});
+var bench = common.createBenchmark(main, {
+  encoding: ['base64', 'hex', 'utf8'],
+  op: ['encode', 'decode'],
+  len: [64, 1024, 16 * 1024 * 1024]
+});
 
 function main(conf) {
-  var N = 64 * 1024 * 1024;
-  var b = Buffer(N);
+  var len = conf.len | 0;
+  var b = Buffer(len);
   var s = '';
   for (var i = 0; i < 256; ++i) s += String.fromCharCode(i);
+  for (var i = 0; i < len; i += 256) b.write(s, i, 256, 'ascii');
+  if (conf.encoding === 'utf8') {
+    for (var i = 0; i < len; ++i) b[i] &= 0x7f;
+  }
+
+  // Process 512 MB in total, but at least a few rounds.
+  var n = Math.max(32, (512 * 1024 * 1024 / len) | 0);
+  var str = b.toString(conf.encoding);
 
   bench.start();
-  for (var i = 0; i < N; i += 256) b.write(s, i, 256, 'ascii');
-  for (var i = 0; i < 32; ++i) b.toString('base64');
-  bench.end(64);
+  if (conf.op === 'encode') {
+    for (var i = 0; i < n; ++i) b.toString(conf.encoding);
+  } else {
+    for (var i = 0; i < n; ++i) Buffer(str, conf.encoding);
+  }
+  bench.end(len * n / (1024 * 1024));
 }
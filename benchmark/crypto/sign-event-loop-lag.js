@@ -0,0 +1,72 @@
+// Signs in a loop while a timer measures how late the event loop is.
+// With api=sync every signature blocks the loop, with api=async the
+// signatures are calculated on the thread pool. Reports the mean lag in
+// milliseconds, lower is better.
+var common = require('../common.js');
+var crypto = require('crypto');
+var fs = require('fs');
+var path = require('path');
+
+var fixtures = path.resolve(__dirname, '../../test/fixtures');
+var keyPem = fs.readFileSync(fixtures + '/test_rsa_privkey_2.pem', 'ascii');
+
+var bench = common.createBenchmark(main, {
+  api: ['sync', 'async'],
+  concurrency: [4],
+  dur: [5]
+});
+
+function main(conf) {
+  var interval = 10;
+  var signatures = 0;
+  var maxLag = 0;
+  var totalLag = 0;
+  var ticks = 0;
+  var stop = false;
+
+  var last = Date.now();
+  var timer = setInterval(function() {
+    var now = Date.now();
+    var lag = Math.max(0, now - last - interval);
+    last = now;
+    totalLag += lag;
+    maxLag = Math.max(maxLag, lag);
+    ticks++;
+  }, interval);
+
+  setTimeout(function() {
+    stop = true;
+    clearInterval(timer);
+    var elapsed = process.hrtime(start);
+    console.log('%s: %d signatures/s, max lag %d ms',
+                bench.getHeading(),
+                (signatures / (elapsed[0] + elapsed[1] / 1e9)).toFixed(1),
+                maxLag);
+    // The reported value is the mean event loop lag in milliseconds.
+    bench.report(ticks === 0 ? 0 : totalLag / ticks);
+  }, conf.dur * 1000);
+
+  var start = process.hrtime();
+  for (var i = 0; i < conf.concurrency; i++)
+    next();
+
+  function next() {
+    if (stop)
+      return;
+    var sign = crypto.createSign('RSA-SHA256').update('payload');
+    if (conf.api === 'async') {
+      sign.sign(keyPem, function(err) {
+        if (err)
+          throw err;
+        signatures++;
+        next();
+      });
+    } else {
+      // Still yield between signatures, the question is how long each
+      // turn of the loop takes.
+      sign.sign(keyPem);
+      signatures++;
+      setImmediate(next);
+    }
+  }
+}
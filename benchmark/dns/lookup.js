@@ -0,0 +1,39 @@
+// Lookups of the same name per second, the way outgoing requests to a
+// service look it up.
+//
+// cache=0:  every lookup the others aren't waiting for goes to getaddrinfo
+// cache=1:  answers are cached for as long as the benchmark runs
+var common = require('../common.js');
+var dns = require('dns');
+
+var bench = common.createBenchmark(main, {
+  cache: [0, 1],
+  concurrent: [1, 50],
+  n: [5e4]
+});
+
+function main(conf) {
+  var n = +conf.n;
+  dns.setCacheOptions({ ttl: +conf.cache ? 60000 : 0 });
+
+  var started = 0;
+  var done = 0;
+
+  bench.start();
+  for (var i = 0; i < +conf.concurrent; i++)
+    next();
+
+  function next() {
+    if (started === n)
+      return;
+    started++;
+    dns.lookup('localhost', function(err) {
+      if (err)
+        throw err;
+      if (++done === n)
+        bench.end(n);
+      else
+        next();
+    });
+  }
+}
@@ -0,0 +1,70 @@
+// Stats a list of paths, half of which don't exist, the way module
+// resolution does. Paths per second.
+//
+// stat:         fs.stat() for every path, all at once
+// statSync:     fs.statSync() for every path, catching the errors
+// statMany:     one fs.statMany() call
+// statManySync: one fs.statManySync() call
+var path = require('path');
+var common = require('../common.js');
+var fs = require('fs');
+
+var bench = common.createBenchmark(main, {
+  method: ['stat', 'statSync', 'statMany', 'statManySync'],
+  paths: [1000],
+  n: [20]
+});
+
+function main(conf) {
+  var dir = path.resolve(__dirname, '../../lib');
+  var names = fs.readdirSync(dir);
+  var paths = [];
+  for (var i = 0; i < +conf.paths; i++) {
+    var name = names[i % names.length];
+    paths.push(path.join(dir, i % 2 ? name : name + '.missing'));
+  }
+
+  var n = +conf.n;
+  var total = n * paths.length;
+  var rounds = 0;
+
+  bench.start();
+  switch (conf.method) {
+    case 'statSync':
+      for (var r = 0; r < n; r++) {
+        for (var i = 0; i < paths.length; i++) {
+          try { fs.statSync(paths[i]); } catch (e) {}
+        }
+      }
+      return bench.end(total);
+
+    case 'statManySync':
+      for (var r = 0; r < n; r++)
+        fs.statManySync(paths);
+      return bench.end(total);
+
+    case 'statMany':
+      return (function next() {
+        if (rounds++ === n)
+          return bench.end(total);
+        fs.statMany(paths, function(err) {
+          if (err)
+            throw err;
+          next();
+        });
+      })();
+
+    case 'stat':
+      return (function next() {
+        if (rounds++ === n)
+          return bench.end(total);
+        var pending = paths.length;
+        paths.forEach(function(p) {
+          fs.stat(p, function() {
+            if (--pending === 0)
+              next();
+          });
+        });
+      })();
+  }
+}
@@ -0,0 +1,56 @@
+// fs.stat(), fs.lstat() and fs.fstat() calls per second, and their sync
+// versions. With dates=true every result's mtime is read as well, which
+// is what most callers look at.
+var common = require('../common.js');
+var fs = require('fs');
+
+var bench = common.createBenchmark(main, {
+  method: ['stat', 'lstat', 'fstat'],
+  sync: ['true', 'false'],
+  dates: ['false', 'true'],
+  concurrent: [10],
+  n: [1e5]
+});
+
+function main(conf) {
+  var n = +conf.n;
+  var dates = conf.dates === 'true';
+  var arg = __filename;
+  if (conf.method === 'fstat')
+    arg = fs.openSync(__filename, 'r');
+
+  if (conf.sync === 'true') {
+    var fn = fs[conf.method + 'Sync'];
+    bench.start();
+    for (var i = 0; i < n; i++) {
+      var stats = fn(arg);
+      if (dates)
+        stats.mtime.getTime();
+    }
+    return bench.end(n);
+  }
+
+  var fn = fs[conf.method];
+  var started = 0;
+  var done = 0;
+
+  bench.start();
+  for (var i = 0; i < +conf.concurrent; i++)
+    next();
+
+  function next() {
+    if (started === n)
+      return;
+    started++;
+    fn(arg, function(err, stats) {
+      if (err)
+        throw err;
+      if (dates)
+        stats.mtime.getTime();
+      if (++done === n)
+        bench.end(n);
+      else
+        next();
+    });
+  }
+}
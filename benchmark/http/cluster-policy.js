@@ -0,0 +1,128 @@
+// Compares the cluster scheduling policies. Every request is made on a new
+// connection so this measures how fast connections are spread over the
+// workers, and how evenly.
+var common = require('../common.js');
+var PORT = common.PORT;
+
+var cluster = require('cluster');
+var http = require('http');
+var util = require('util');
+
+if (process.env.CLUSTER_BENCH_CLIENT) {
+  client(+process.env.CLUSTER_BENCH_C, +process.env.CLUSTER_BENCH_DUR);
+} else if (cluster.isMaster) {
+  var bench = common.createBenchmark(main, {
+    policy: ['rr', 'none', 'reuseport'],
+    workers: [4],
+    c: [50, 200],
+    dur: [5]
+  });
+} else {
+  worker();
+}
+
+function main(conf) {
+  cluster.schedulingPolicy = {
+    rr: cluster.SCHED_RR,
+    none: cluster.SCHED_NONE,
+    reuseport: cluster.SCHED_REUSEPORT
+  }[conf.policy];
+
+  var workers = [];
+  for (var i = 0; i < conf.workers; i++)
+    workers.push(cluster.fork());
+
+  var listening = 0;
+  cluster.on('listening', function() {
+    if (++listening < conf.workers)
+      return;
+
+    // Run the client in its own process, the master may be busy handing
+    // out connections.
+    var env = util._extend({}, process.env);
+    env.CLUSTER_BENCH_CLIENT = 1;
+    env.CLUSTER_BENCH_C = conf.c;
+    env.CLUSTER_BENCH_DUR = conf.dur;
+    var child = require('child_process').fork(__filename, [], { env: env });
+    child.on('message', function(rate) {
+      collect(workers, function(counts) {
+        report(counts, rate);
+      });
+    });
+  });
+
+  function report(counts, rate) {
+    var min = Math.min.apply(null, counts);
+    var max = Math.max.apply(null, counts);
+    console.log('%s: per worker %s, fairness (min/max) %s',
+                bench.getHeading(),
+                counts.join(' '),
+                (max === 0 ? 0 : min / max).toFixed(3));
+    workers.forEach(function(w) { w.destroy(); });
+    bench.report(rate);
+  }
+}
+
+// Asks every worker how many requests it served.
+function collect(workers, cb) {
+  var counts = [];
+  var pending = workers.length;
+  workers.forEach(function(w, i) {
+    w.once('message', function(count) {
+      counts[i] = count;
+      if (--pending === 0)
+        cb(counts);
+    });
+    w.send('count');
+  });
+}
+
+function worker() {
+  var requests = 0;
+  process.on('message', function(msg) {
+    if (msg === 'count')
+      process.send(requests);
+  });
+  http.createServer(function(req, res) {
+    requests++;
+    res.writeHead(200, { 'Connection': 'close', 'Content-Length': 2 });
+    res.end('ok');
+  }).listen(PORT);
+}
+
+function client(c, dur) {
+  var requests = 0;
+  var stop = false;
+  var start = process.hrtime();
+
+  setTimeout(function() {
+    stop = true;
+  }, dur * 1000);
+
+  for (var i = 0; i < c; i++)
+    request();
+
+  var active = c;
+  function request() {
+    if (stop) {
+      if (--active === 0) {
+        var elapsed = process.hrtime(start);
+        process.send(requests / (elapsed[0] + elapsed[1] / 1e9));
+        process.exit(0);
+      }
+      return;
+    }
+    http.get({
+      port: PORT,
+      path: '/',
+      agent: false,
+      headers: { 'Connection': 'close' }
+    }, function(res) {
+      res.resume();
+      res.on('end', function() {
+        requests++;
+        request();
+      });
+    });
+  }
+}
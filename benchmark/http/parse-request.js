@@ -0,0 +1,61 @@
+// Parses requests through the same code the http server uses, without the
+// network: the C++ parser and the headers handling in JS land.
+var common = require('../common.js');
+
+var bench = common.createBenchmark(main, {
+  headers: [4, 20],
+  n: [1e5]
+});
+
+// A typical browser request, plus a few headers the parser doesn't know.
+var HEADERS = [
+  'Host: localhost:8080',
+  'Connection: keep-alive',
+  'Accept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8',
+  'User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36',
+  'Accept-Encoding: gzip,deflate,sdch',
+  'Accept-Language: en-US,en;q=0.8',
+  'Cookie: session=0123456789abcdef; theme=dark',
+  'Cache-Control: max-age=0',
+  'Referer: http://localhost:8080/index.html',
+  'If-None-Match: "1a2b3c4d"',
+  'If-Modified-Since: Mon, 01 Jul 2013 10:00:00 GMT',
+  'DNT: 1',
+  'X-Requested-With: XMLHttpRequest',
+  'X-Forwarded-For: 10.0.0.1',
+  'X-Forwarded-Proto: http',
+  'X-Request-Id: 8c3b1b0e-4bd2-4b5e-a0d9-1f3c4e5d6a7b',
+  'Origin: http://localhost:8080',
+  'Pragma: no-cache',
+  'X-Api-Version: 2',
+  'Authorization: Bearer abcdef0123456789'
+];
+
+function main(conf) {
+  var HTTPParser = process.binding('http_parser').HTTPParser;
+  var parsers = require('_http_common').parsers;
+
+  var request = 'GET /index.html?q=1 HTTP/1.1\r\n' +
+                HEADERS.slice(0, conf.headers).join('\r\n') +
+                '\r\n\r\n';
+  var buf = new Buffer(request);
+
+  var parser = parsers.alloc();
+  parser.reinitialize(HTTPParser.REQUEST);
+  parser.socket = { readable: false };
+  parser.maxHeaderPairs = 2000;
+
+  var requests = 0;
+  parser.onIncoming = function(req, shouldKeepAlive) {
+    if (req.headers.host === undefined)
+      throw new Error('no headers');
+    requests++;
+    return false;
+  };
+
+  var n = conf.n | 0;
+  bench.start();
+  for (var i = 0; i < n; i++)
+    parser.execute(buf, 0, buf.length);
+  bench.end(requests);
+}
@@ -0,0 +1,53 @@
+// Worker to master message throughput, in messages per second.
+var common = require('../common.js');
+var cluster = require('cluster');
+
+if (cluster.isMaster) {
+  var bench = common.createBenchmark(main, {
+    serialization: ['json', 'binary'],
+    type: ['object', 'buffer'],
+    len: [16, 1024, 16384],
+    dur: [5]
+  });
+} else {
+  worker();
+}
+
+function main(conf) {
+  cluster.setupMaster({
+    args: ['type=' + conf.type, 'len=' + conf.len],
+    serialization: conf.serialization
+  });
+
+  var messages = 0;
+  var w = cluster.fork();
+
+  w.on('message', function(msg) {
+    if (messages++ === 0) {
+      bench.start();
+      setTimeout(function() {
+        w.process.kill();
+        bench.end(messages);
+      }, conf.dur * 1000);
+    }
+  });
+}
+
+function worker() {
+  var type = process.argv[2].split('=')[1];
+  var len = +process.argv[3].split('=')[1];
+
+  var msg;
+  if (type === 'buffer') {
+    msg = new Buffer(len);
+    msg.fill('.');
+  } else {
+    msg = { cmd: 'bench', data: Array(len + 1).join('.') };
+  }
+
+  // Send until the channel pushes back, then give it a chance to drain.
+  (function send() {
+    for (var i = 0; i < 1000 && process.send(msg); i++);
+    setImmediate(send);
+  })();
+}
@@ -0,0 +1,47 @@
+// Callbacks from C++ into JS per second, through MakeCallback(), with and
+// without domains around.
+//
+// none:     the domain module isn't loaded
+// loaded:   it's loaded, but no domain was ever created
+// created:  a domain exists, the callback's object isn't in one
+// active:   the callbacks run while a domain is active
+// attached: the object making the callbacks belongs to a domain
+var common = require('../common.js');
+var Timer = process.binding('timer_wrap').Timer;
+
+var bench = common.createBenchmark(main, {
+  domains: ['none', 'loaded', 'created', 'active', 'attached'],
+  n: [1e6]
+});
+
+function main(conf) {
+  var n = +conf.n;
+  var domain = conf.domains === 'none' ? null : require('domain');
+
+  if (conf.domains === 'created')
+    domain.create();
+
+  if (conf.domains === 'active')
+    domain.create().run(run);
+  else
+    run();
+
+  function run() {
+    var timer = new Timer();
+    if (conf.domains === 'attached')
+      timer.domain = domain.create();
+
+    var i = 0;
+    timer[0] = function() {
+      if (++i === n) {
+        timer.close();
+        bench.end(n / 1e6);
+        return;
+      }
+      timer.start(0, 0);
+    };
+
+    bench.start();
+    timer.start(0, 0);
+  }
+}
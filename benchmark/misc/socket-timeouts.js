@@ -0,0 +1,42 @@
+// The idle timeouts of a server with many open connections, each of which
+// refreshes its timeout on every chunk it reads, the way net.Socket does.
+// Refreshes per second.
+//
+// timeouts=same: every connection has the same timeout
+// timeouts=mixed: a handful of different timeouts
+var common = require('../common.js');
+var timers = require('timers');
+
+var bench = common.createBenchmark(main, {
+  sockets: [1e3, 1e5],
+  timeouts: ['same', 'mixed'],
+  n: [1e6]
+});
+
+function main(conf) {
+  var sockets = [];
+  for (var i = 0; i < +conf.sockets; i++) {
+    var socket = { _onTimeout: onTimeout };
+    var msecs = conf.timeouts === 'same' ? 120000 : 60000 + (i % 5) * 15000;
+    timers.enroll(socket, msecs);
+    timers._unrefActive(socket);
+    sockets.push(socket);
+  }
+
+  // Chunks arrive for the connections in a scattered order.
+  var n = +conf.n;
+  var step = 7919;  // Prime, so every socket gets its turn.
+  var j = 0;
+  bench.start();
+  for (var i = 0; i < n; i++) {
+    j = (j + step) % sockets.length;
+    timers._unrefActive(sockets[j]);
+  }
+  bench.end(n);
+
+  sockets.forEach(timers.unenroll);
+}
+
+function onTimeout() {
+  throw new Error('socket timed out');
+}
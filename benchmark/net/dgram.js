@@ -6,9 +6,12 @@ var PORT = common.PORT;
 // `num` is the number of send requests to queue up each time.
 // Keep it reasonably high (>10) otherwise you're benchmarking the speed of
 // event loop cycles more than anything else.
+// `batch` is the number of datagrams per sendBatch() call and per read.
+// 1 means plain send() and one datagram per read.
 var bench = common.createBenchmark(main, {
   len: [1, 64, 256, 1024],
   num: [100],
+  batch: [1, 16, 64],
   type: ['send', 'recv'],
   dur: [5]
 });
@@ -16,6 +19,7 @@ var bench = common.createBenchmark(main, {
 var dur;
 var len;
 var num;
+var batch;
 var type;
 var chunk;
 var encoding;
@@ -24,6 +28,7 @@ function main(conf) {
   dur = +conf.dur;
   len = +conf.len;
   num = +conf.num;
+  batch = +conf.batch;
   type = conf.type;
   chunk = new Buffer(len);
   server();
@@ -35,6 +40,12 @@ function server() {
   var sent = 0;
   var received = 0;
   var socket = dgram.createSocket('udp4');
+  var chunks = [];
+  var nbatches = Math.ceil(num / batch);
+  var batches = 0;
+
+  for (var i = 0; i < batch; i++)
+    chunks.push(chunk);
 
   function onsend() {
     if (sent++ % num == 0)
@@ -42,9 +53,21 @@ function server() {
         socket.send(chunk, 0, chunk.length, PORT, '127.0.0.1', onsend);
   }
 
+  function onsendbatch() {
+    sent += batch;
+    if (batches++ % nbatches == 0)
+      for (var i = 0; i < nbatches; i++)
+        socket.sendBatch(chunks, PORT, '127.0.0.1', onsendbatch);
+  }
+
   socket.on('listening', function() {
     bench.start();
-    onsend();
+    if (batch > 1) {
+      socket.setRecvBatch(batch);
+      onsendbatch();
+    } else {
+      onsend();
+    }
 
     setTimeout(function() {
       var bytes = (type === 'send' ? sent : received) * chunk.length;
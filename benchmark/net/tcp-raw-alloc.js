@@ -0,0 +1,103 @@
+// In this benchmark, we connect a client to the server and write as many
+// bytes as we can in the specified time, then report how many read slabs
+// the server had to allocate per MB received.
+
+var common = require('../common.js');
+var util = require('util');
+
+var bench = common.createBenchmark(main, {
+  len: [1024, 102400, 1024 * 1024 * 16],
+  dur: [5]
+});
+
+var binding = process.binding('tcp_wrap');
+var TCP = binding.TCP;
+var PORT = common.PORT;
+
+var dur;
+var len;
+
+function main(conf) {
+  dur = +conf.dur;
+  len = +conf.len;
+  server();
+}
+
+
+function fail(err, syscall) {
+  throw util._errnoException(err, syscall);
+}
+
+function server() {
+  var serverHandle = new TCP();
+  var err = serverHandle.bind('127.0.0.1', PORT);
+  if (err)
+    fail(err, 'bind');
+
+  err = serverHandle.listen(511);
+  if (err)
+    fail(err, 'listen');
+
+  serverHandle.onconnection = function(err, clientHandle) {
+    if (err)
+      fail(err, 'connect');
+
+    var before = binding.getSlabStats();
+    var bytes = 0;
+
+    setTimeout(function() {
+      var after = binding.getSlabStats();
+      var slabs = after.slabs - before.slabs;
+      // report allocations per MB received
+      bench.report(slabs / (bytes / (1024 * 1024)));
+    }, dur * 1000);
+
+    clientHandle.onread = function(nread, buffer) {
+      // we're not expecting to ever get an EOF from the client.
+      // just lots of data forever.
+      if (nread < 0)
+        fail(nread, 'read');
+
+      bytes += buffer.length;
+    };
+
+    clientHandle.readStart();
+  };
+
+  client();
+}
+
+function client() {
+  var chunk = new Buffer(len);
+  chunk.fill('x');
+
+  var clientHandle = new TCP();
+  var connectReq = {};
+  var err = clientHandle.connect(connectReq, '127.0.0.1', PORT);
+
+  if (err)
+    fail(err, 'connect');
+
+  connectReq.oncomplete = function(err) {
+    if (err)
+      fail(err, 'connect');
+
+    while (clientHandle.writeQueueSize === 0)
+      write();
+  };
+
+  function write() {
+    var writeReq = { oncomplete: afterWrite };
+    var err = clientHandle.writeBuffer(writeReq, chunk);
+    if (err)
+      fail(err, 'write');
+  }
+
+  function afterWrite(err, handle, req) {
+    if (err)
+      fail(err, 'write');
+
+    while (clientHandle.writeQueueSize === 0)
+      write();
+  }
+}
@@ -1,44 +1,112 @@
+// Serves a static file and reports how much CPU time the server spent.
+//
+//   node benchmark/static_http_server.js [sendfile|stream|buffer] [bytes]
+//
+// sendfile: fs.ReadStream piped into the socket, the data goes out with
+//           sendfile(2) and never enters JS land.
+// stream:   fs.ReadStream piped into the response, every byte is read into
+//           a Buffer and written out again.
+// buffer:   the original benchmark, the body is a string held in memory.
+//
+// The client runs in a child process so only the server's CPU time counts.
+
+var child_process = require('child_process');
+var fs = require('fs');
 var http = require('http');
+var os = require('os');
+var path = require('path');
 
 var concurrency = 30;
 var port = 12346;
 var n = 700;
-var bytes = 1024*5;
 
-var requests = 0;
-var responses = 0;
+if (process.argv[2] === 'client')
+  return client(+process.argv[3]);
 
-var body = '';
-for (var i = 0; i < bytes; i++) {
-  body += 'C';
-}
+var mode = process.argv[2] || 'sendfile';
+var bytes = +process.argv[3] || 1024 * 1024;
+
+var filename = path.join(os.tmpdir(), 'static_http_server.' + process.pid);
+var body = new Buffer(bytes);
+body.fill('C');
+fs.writeFileSync(filename, body);
+body = body.toString();
 
 var server = http.createServer(function(req, res) {
   res.writeHead(200, {
     'Content-Type': 'text/plain',
-    'Content-Length': body.length
+    'Content-Length': bytes
+  });
+
+  if (mode === 'buffer')
+    return res.end(body);
+
+  if (mode === 'stream')
+    return fs.createReadStream(filename).pipe(res);
+
+  // Flush the headers, then hand the body to the socket directly.
+  res._send('');
+  var rs = fs.createReadStream(filename);
+  rs.pipe(res.connection, { end: false });
+  rs.on('end', function() {
+    res.end();
   });
-  res.end(body);
-})
+});
 
 server.listen(port, function() {
+  var start = cpuTime();
+  var hrtime = process.hrtime();
+  var child = child_process.fork(__filename, ['client', n]);
+
+  child.on('exit', function() {
+    var elapsed = process.hrtime(hrtime);
+    var cpu = cpuTime();
+    server.close();
+    fs.unlinkSync(filename);
+
+    elapsed = elapsed[0] + elapsed[1] / 1e9;
+    console.log('mode=%s bytes=%d requests=%d', mode, bytes, n);
+    console.log('elapsed: %d s, %d req/s', elapsed.toFixed(3),
+                (n / elapsed).toFixed(1));
+    if (start && cpu) {
+      console.log('server cpu: user %d s, system %d s',
+                  (cpu.user - start.user).toFixed(3),
+                  (cpu.system - start.system).toFixed(3));
+    }
+  });
+});
+
+
+// Returns the process's CPU time in seconds, if the platform tells us.
+function cpuTime() {
+  try {
+    var stat = fs.readFileSync('/proc/self/stat', 'utf8');
+  } catch (e) {
+    return null;
+  }
+  // Skip past the command name, it may contain spaces.
+  var fields = stat.slice(stat.lastIndexOf(')') + 2).split(' ');
+  var hz = 100;  // USER_HZ, the same on practically every Linux system.
+  return { user: fields[11] / hz, system: fields[12] / hz };
+}
+
+
+function client(n) {
   var agent = new http.Agent();
   agent.maxSockets = concurrency;
 
+  var responses = 0;
   for (var i = 0; i < n; i++) {
-    var req = http.get({
-      port:  port,
-      path:  '/',
+    http.get({
+      port: port,
+      path: '/',
       agent: agent
     }, function(res) {
       res.resume();
       res.on('end', function() {
-        if (++responses === n) {
-          server.close();
-        }
+        if (++responses === n)
+          process.exit(0);
       });
     });
-    req.id = i;
-    requests++;
   }
-});
+}
@@ -2,7 +2,7 @@ var common = require('../common.js');
 var bench = common.createBenchmark(main, {
   dur: [5],
   type: ['buf', 'asc', 'utf'],
-  size: [2, 1024, 1024 * 1024]
+  size: [2, 1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024]
 });
 
 var dur, type, encoding, size;
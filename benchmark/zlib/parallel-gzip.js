@@ -0,0 +1,36 @@
+// Gzips a large buffer in one go, MB of input per second. parallel=0 is the
+// ordinary single stream. With more blocks in flight than there are threads
+// in the pool (UV_THREADPOOL_SIZE, 4 by default) nothing gets faster.
+var common = require('../common.js');
+var zlib = require('zlib');
+
+var bench = common.createBenchmark(main, {
+  parallel: [0, 2, 4],
+  blockSize: [128 * 1024, 1024 * 1024],
+  mb: [64]
+});
+
+function main(conf) {
+  var len = conf.mb * 1024 * 1024;
+  var opts = {};
+  if (+conf.parallel > 0) {
+    opts.parallel = +conf.parallel;
+    opts.blockSize = +conf.blockSize;
+  }
+
+  // Log-like lines, compressible but not trivially so.
+  var data = new Buffer(len);
+  var line = '';
+  for (var i = 0; i < data.length; i += line.length) {
+    line = '127.0.0.1 - - [' + i + '] "GET /item/' + (i * 7919 % 10007) +
+           ' HTTP/1.1" 200 ' + (i % 4096) + '\n';
+    data.write(line, i, 'binary');
+  }
+
+  bench.start();
+  zlib.gzip(data, opts, function(err, out) {
+    if (err)
+      throw err;
+    bench.end(conf.mb);
+  });
+}
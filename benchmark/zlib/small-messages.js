@@ -0,0 +1,61 @@
+// Compresses or decompresses small messages one at a time, messages per
+// second. With concurrent=1 every message waits for the previous one, so
+// that's the latency of a single call. With more in flight it's throughput.
+//
+// inline:     every write is done on the main thread
+// threadpool: every write goes to the thread pool
+// sync:       zlib.deflateSync() and friends, concurrent is ignored
+var common = require('../common.js');
+var zlib = require('zlib');
+
+var bench = common.createBenchmark(main, {
+  method: ['inline', 'threadpool', 'sync'],
+  type: ['deflate', 'inflate'],
+  len: [300, 4096],
+  concurrent: [1, 50],
+  n: [2e4]
+});
+
+function main(conf) {
+  var n = +conf.n;
+  var opts = { inlineThreshold: conf.method === 'inline' ? Infinity : 0 };
+
+  // Something that looks like a JSON body.
+  var message = new Buffer(conf.len);
+  var json = JSON.stringify({ id: 1, name: 'benchmark', tags: ['a', 'b'] });
+  for (var i = 0; i < message.length; i++)
+    message[i] = json.charCodeAt((i * 7) % json.length);
+
+  var fn = conf.type === 'deflate' ? 'deflate' : 'inflate';
+  var input = conf.type === 'deflate' ? message : zlib.deflateSync(message);
+
+  if (conf.method === 'sync') {
+    fn += 'Sync';
+    bench.start();
+    for (var i = 0; i < n; i++)
+      zlib[fn](input);
+    bench.end(n);
+    return;
+  }
+
+  var started = 0;
+  var done = 0;
+
+  bench.start();
+  for (var i = 0; i < +conf.concurrent; i++)
+    next();
+
+  function next() {
+    if (started === n)
+      return;
+    started++;
+    zlib[fn](input, opts, function(err) {
+      if (err)
+        throw err;
+      if (++done === n)
+        bench.end(n);
+      else
+        next();
+    });
+  }
+}
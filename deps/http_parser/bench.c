@@ -0,0 +1,119 @@
+/* Copyright Joyent, Inc. and other Node contributors. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/* Parser throughput, in MB/s and requests/s.
+ *
+ *   make bench && ./bench [iterations]
+ *
+ * Parses a browser-like request with a long URL and a handful of long
+ * header values, followed by a small chunked body, over and over again.
+ */
+#include "http_parser.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+static const char data[] =
+    "GET /joyent/http-parser/blob/master/http_parser.c"
+    "?utm_source=feed&utm_medium=rss&utm_campaign=parser#L580 HTTP/1.1\r\n"
+    "Host: github.com\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.17 "
+    "(KHTML, like Gecko) Chrome/24.0.1312.57 Safari/537.17\r\n"
+    "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,"
+    "*/*;q=0.8\r\n"
+    "Accept-Language: en-US,en;q=0.8\r\n"
+    "Accept-Encoding: gzip,deflate,sdch\r\n"
+    "Accept-Charset: ISO-8859-1,utf-8;q=0.7,*;q=0.3\r\n"
+    "Referer: https://github.com/joyent/http-parser/commits/master\r\n"
+    "Cookie: _gh_sess=BAh7BzoQX2NzcmZfdG9rZW4iMUhQdHVVQWxlcEdYSG5JSjVhc1Rl; "
+    "logged_in=no; __utma=1.1384297423.1355912245.1355912245.1360012342.2\r\n"
+    "Connection: keep-alive\r\n"
+    "Transfer-Encoding: chunked\r\n"
+    "\r\n"
+    "1e\r\nall your base are belong to us\r\n"
+    "0\r\n"
+    "\r\n";
+static const size_t data_len = sizeof(data) - 1;
+
+static int
+on_data (http_parser *p, const char *at, size_t len)
+{
+  (void) p;
+  (void) at;
+  (void) len;
+  return 0;
+}
+
+static int
+on_info (http_parser *p)
+{
+  (void) p;
+  return 0;
+}
+
+static http_parser_settings settings =
+  {.on_message_begin = on_info
+  ,.on_url = on_data
+  ,.on_header_field = on_data
+  ,.on_header_value = on_data
+  ,.on_headers_complete = on_info
+  ,.on_body = on_data
+  ,.on_message_complete = on_info
+  };
+
+int
+main (int argc, char *argv[])
+{
+  http_parser parser;
+  struct timeval start, end;
+  double elapsed, bytes;
+  long iterations = 1000000;
+  long i;
+  size_t parsed;
+
+  if (argc > 1) {
+    iterations = atol(argv[1]);
+  }
+
+  gettimeofday(&start, NULL);
+
+  for (i = 0; i < iterations; i++) {
+    http_parser_init(&parser, HTTP_REQUEST);
+    parsed = http_parser_execute(&parser, &settings, data, data_len);
+    assert(parsed == data_len);
+    assert(HTTP_PARSER_ERRNO(&parser) == HPE_OK);
+  }
+
+  gettimeofday(&end, NULL);
+
+  elapsed = (end.tv_sec - start.tv_sec) +
+            (end.tv_usec - start.tv_usec) / 1e6;
+  bytes = (double) data_len * iterations;
+
+  printf("%ld requests of %lu bytes in %.3f s\n",
+         iterations, (unsigned long) data_len, elapsed);
+  printf("%.1f MB/s, %.0f req/s\n",
+         bytes / (1024 * 1024) / elapsed, iterations / elapsed);
+
+  return 0;
+}
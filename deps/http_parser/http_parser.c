@@ -29,6 +29,14 @@
 #include <string.h>
 #include <limits.h>
 
+#if defined(__SSE4_2__) && defined(__GNUC__)
+# include <nmmintrin.h>
+# define HTTP_PARSER_SSE42 1
+#elif defined(__SSE2__) && defined(__GNUC__)
+# include <emmintrin.h>
+# define HTTP_PARSER_SSE2 1
+#endif
+
 #ifndef ULLONG_MAX
 # define ULLONG_MAX ((uint64_t) -1) /* 2^64-1 */
 #endif
@@ -388,6 +396,118 @@ enum http_host_state
 #endif
 
 
+/* Scanners for the long runs of bytes in the request line and the header
+ * block that don't change the parser's state. Both return a pointer to the
+ * first byte in [p, end) that the state machine has to look at, or end.
+ * They're conservative: stopping early on a byte that turns out to be fine
+ * is harmless, the main loop simply handles it one byte at a time.
+ */
+
+/* Header values: anything but CR and LF. */
+static const char *
+scan_header_value(const char *p, const char *end)
+{
+#if HTTP_PARSER_SSE42
+  const __m128i crlf = _mm_setr_epi8(CR, LF, 0, 0, 0, 0, 0, 0,
+                                     0, 0, 0, 0, 0, 0, 0, 0);
+  int i;
+
+  for (; end - p >= 16; p += 16) {
+    i = _mm_cmpestri(crlf, 2, _mm_loadu_si128((const __m128i *) p), 16,
+                     _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY |
+                     _SIDD_LEAST_SIGNIFICANT);
+    if (i != 16) {
+      return p + i;
+    }
+  }
+#elif HTTP_PARSER_SSE2
+  const __m128i cr = _mm_set1_epi8(CR);
+  const __m128i lf = _mm_set1_epi8(LF);
+  __m128i v;
+  int mask;
+
+  for (; end - p >= 16; p += 16) {
+    v = _mm_loadu_si128((const __m128i *) p);
+    mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, cr),
+                                          _mm_cmpeq_epi8(v, lf)));
+    if (mask != 0) {
+      return p + __builtin_ctz(mask);
+    }
+  }
+#endif
+
+  for (; p != end; p++) {
+    if (*p == CR || *p == LF) {
+      break;
+    }
+  }
+
+  return p;
+}
+
+/* Path, query string and fragment: the URL characters that keep us in the
+ * same state, i.e. printable ASCII other than '#' and '?' (plus the high
+ * half in non-strict mode). Tabs and form feeds are left to
+ * parse_url_char().
+ */
+static const char *
+scan_url(const char *p, const char *end)
+{
+#if HTTP_PARSER_SSE42
+  const __m128i ranges = _mm_setr_epi8(0x21, 0x22, 0x24, 0x3e, 0x40, 0x7e,
+#if HTTP_PARSER_STRICT
+                                       0, 0,
+#else
+                                       (char) 0x80, (char) 0xff,
+#endif
+                                       0, 0, 0, 0, 0, 0, 0, 0);
+  int i;
+
+  for (; end - p >= 16; p += 16) {
+    i = _mm_cmpestri(ranges, HTTP_PARSER_STRICT ? 6 : 8,
+                     _mm_loadu_si128((const __m128i *) p), 16,
+                     _SIDD_UBYTE_OPS | _SIDD_CMP_RANGES |
+                     _SIDD_NEGATIVE_POLARITY | _SIDD_LEAST_SIGNIFICANT);
+    if (i != 16) {
+      return p + i;
+    }
+  }
+#elif HTTP_PARSER_SSE2
+  const __m128i lo = _mm_set1_epi8(0x20);
+  const __m128i hi = _mm_set1_epi8(0x7f);
+  const __m128i hash = _mm_set1_epi8('#');
+  const __m128i question = _mm_set1_epi8('?');
+  __m128i v, ok;
+  int mask;
+
+  for (; end - p >= 16; p += 16) {
+    v = _mm_loadu_si128((const __m128i *) p);
+    /* Signed compares: 0x21-0x7e is > 0x20 and < 0x7f, the high half is
+     * negative.
+     */
+    ok = _mm_and_si128(_mm_cmpgt_epi8(v, lo), _mm_cmplt_epi8(v, hi));
+    ok = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi8(v, hash),
+                                       _mm_cmpeq_epi8(v, question)), ok);
+#if !HTTP_PARSER_STRICT
+    ok = _mm_or_si128(ok, _mm_cmplt_epi8(v, _mm_setzero_si128()));
+#endif
+    mask = _mm_movemask_epi8(ok) ^ 0xffff;
+    if (mask != 0) {
+      return p + __builtin_ctz(mask);
+    }
+  }
+#endif
+
+  for (; p != end; p++) {
+    if (!IS_URL_CHAR(*p) || *p == '\t' || *p == '\f') {
+      break;
+    }
+  }
+
+  return p;
+}
+
+
 #define start_state (parser->type == HTTP_REQUEST ? s_start_req : s_start_res)
 
 
@@ -577,6 +697,24 @@ parse_url_char(enum state s, const char ch)
   return s_dead;
 }
 
+/* Move p to the last byte of the run that follows it, as found by SCAN.
+ * The run is cut short at the header size limit so that an overflow is
+ * still reported on exactly the same byte as without the scan.
+ */
+#define SKIP_RUN(SCAN)                                               \
+do {                                                                 \
+  const char *run_end = data + len;                                  \
+  uint32_t room = HTTP_MAX_HEADER_SIZE - parser->nread;              \
+                                                                     \
+  if ((size_t) (run_end - (p + 1)) > room) {                         \
+    run_end = p + 1 + room;                                          \
+  }                                                                  \
+                                                                     \
+  run_end = SCAN(p + 1, run_end);                                    \
+  parser->nread += run_end - (p + 1);                                \
+  p = run_end - 1;                                                   \
+} while (0)
+
 size_t http_parser_execute (http_parser *parser,
                             const http_parser_settings *settings,
                             const char *data,
@@ -1069,6 +1207,12 @@ size_t http_parser_execute (http_parser *parser,
               SET_ERRNO(HPE_INVALID_URL);
               goto error;
             }
+
+            if (parser->state == s_req_path ||
+                parser->state == s_req_query_string ||
+                parser->state == s_req_fragment) {
+              SKIP_RUN(scan_url);
+            }
         }
         break;
       }
@@ -1536,6 +1680,10 @@ size_t http_parser_execute (http_parser *parser,
             parser->header_state = h_general;
             break;
         }
+
+        if (parser->header_state == h_general) {
+          SKIP_RUN(scan_header_value);
+        }
         break;
       }
 
@@ -897,6 +897,46 @@ const struct message requests[] =
   }
 
 
+#define LONG_URL_AND_HEADER_VALUES 34
+, {.name= "long url and header values"
+  ,.type= HTTP_REQUEST
+  ,.raw= "GET /static/javascripts/prototype-1.6.0.3/effects.js"
+         "?v=1234567890&callback=jQuery17205836749738454819_1355"
+         "#section-with-a-rather-long-fragment HTTP/1.1\r\n"
+         "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.17 "
+         "(KHTML, like Gecko) Chrome/24.0.1312.57 Safari/537.17\r\n"
+         "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,"
+         "*/*;q=0.8\r\n"
+         "Connection: keep-alive, and some more text to skip\r\n"
+         "Transfer-Encoding: chunked\r\n"
+         "\r\n"
+         "1e\r\nall your base are belong to us\r\n"
+         "0\r\n"
+         "\r\n"
+  ,.should_keep_alive= TRUE
+  ,.message_complete_on_eof= FALSE
+  ,.http_major= 1
+  ,.http_minor= 1
+  ,.method= HTTP_GET
+  ,.query_string= "v=1234567890&callback=jQuery17205836749738454819_1355"
+  ,.fragment= "section-with-a-rather-long-fragment"
+  ,.request_path= "/static/javascripts/prototype-1.6.0.3/effects.js"
+  ,.request_url= "/static/javascripts/prototype-1.6.0.3/effects.js"
+                 "?v=1234567890&callback=jQuery17205836749738454819_1355"
+                 "#section-with-a-rather-long-fragment"
+  ,.num_headers= 4
+  ,.headers=
+    { { "User-Agent", "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.17 "
+                      "(KHTML, like Gecko) Chrome/24.0.1312.57 Safari/537.17" }
+    , { "Accept", "text/html,application/xhtml+xml,application/xml;q=0.9,"
+                  "*/*;q=0.8" }
+    , { "Connection", "keep-alive, and some more text to skip" }
+    , { "Transfer-Encoding", "chunked" }
+    }
+  ,.body= "all your base are belong to us"
+  }
+
+
 , {.name= NULL } /* sentinel */
 };
 
@@ -2679,6 +2719,30 @@ test_header_overflow_error (int req)
   abort();
 }
 
+/* A header that runs past the limit in a single buffer must be rejected on
+ * exactly the same byte, no matter how far ahead the parser can skip.
+ */
+void
+test_header_overflow_offset (enum http_parser_type type, const char *prefix)
+{
+  http_parser parser;
+  http_parser_init(&parser, type);
+  size_t prefix_len = strlen(prefix);
+  size_t buflen = HTTP_MAX_HEADER_SIZE + 100;
+  char *buf = malloc(buflen);
+  size_t parsed;
+
+  assert(buf != NULL);
+  memcpy(buf, prefix, prefix_len);
+  memset(buf + prefix_len, 'a', buflen - prefix_len);
+
+  parsed = http_parser_execute(&parser, &settings_null, buf, buflen);
+  assert(HTTP_PARSER_ERRNO(&parser) == HPE_HEADER_OVERFLOW);
+  assert(parsed == HTTP_MAX_HEADER_SIZE);
+
+  free(buf);
+}
+
 static void
 test_content_length_overflow (const char *buf, size_t buflen, int expect_ok)
 {
@@ -3045,6 +3109,10 @@ main (void)
   test_no_overflow_long_body(HTTP_RESPONSE, 1000);
   test_no_overflow_long_body(HTTP_RESPONSE, 100000);
 
+  test_header_overflow_offset(HTTP_REQUEST, "GET /");
+  test_header_overflow_offset(HTTP_REQUEST, "GET / HTTP/1.1\r\nX-Long: ");
+  test_header_overflow_offset(HTTP_RESPONSE, "HTTP/1.1 200 OK\r\nX-Long: ");
+
   test_header_content_length_overflow_error();
   test_chunk_content_length_overflow_error();
 
@@ -140,6 +140,7 @@ test/test-tcp-connect6-error.c
 test/test-tcp-flags.c
 test/test-tcp-open.c
 test/test-tcp-read-stop.c
+test/test-tcp-reuseport.c
 test/test-tcp-shutdown-after-write.c
 test/test-tcp-unexpected-read.c
 test/test-tcp-write-error.c
@@ -153,6 +154,7 @@ test/test-timer.c
 test/test-tty.c
 test/test-udp-dgram-too-big.c
 test/test-udp-ipv6.c
+test/test-udp-mmsg.c
 test/test-udp-multicast-join.c
 test/test-udp-multicast-ttl.c
 test/test-udp-open.c
@@ -96,6 +96,10 @@ struct uv__work {
   void (*done)(struct uv__work *w, int status);
   struct uv_loop_s* loop;
   void* wq[2];
+  unsigned int kind;
+  uint64_t queue_time;
+  uint64_t start_time;
+  uint64_t end_time;
 };
 
 #ifndef UV_PLATFORM_SEM_T
@@ -242,6 +246,7 @@ typedef struct {
   uv__io_t io_watcher;                                                        \
   void* write_queue[2];                                                       \
   void* write_completed_queue[2];                                             \
+  unsigned int recv_batch;                                                    \
 
 #define UV_PIPE_PRIVATE_FIELDS                                                \
   const char* pipe_fname; /* strdup'ed */
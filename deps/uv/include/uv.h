@@ -753,6 +753,18 @@ UV_EXTERN int uv_tcp_keepalive(uv_tcp_t* handle,
  */
 UV_EXTERN int uv_tcp_simultaneous_accepts(uv_tcp_t* handle, int enable);
 
+/*
+ * Enable/disable SO_REUSEPORT. Must be called before uv_tcp_bind().
+ *
+ * Lets several sockets, usually in different processes, bind to and listen
+ * on the same address and port. On Linux 3.9 and newer the kernel spreads
+ * incoming connections evenly over the listening sockets. Other platforms
+ * accept the option but may not balance connections.
+ *
+ * Returns UV_ENOTSUP when the platform doesn't have SO_REUSEPORT.
+ */
+UV_EXTERN int uv_tcp_reuseport(uv_tcp_t* handle, int enable);
+
 UV_EXTERN int uv_tcp_bind(uv_tcp_t* handle, struct sockaddr_in);
 UV_EXTERN int uv_tcp_bind6(uv_tcp_t* handle, struct sockaddr_in6);
 UV_EXTERN int uv_tcp_getsockname(uv_tcp_t* handle, struct sockaddr* name,
@@ -791,7 +803,12 @@ enum uv_udp_flags {
    * Indicates message was truncated because read buffer was too small. The
    * remainder was discarded by the OS. Used in uv_udp_recv_cb.
    */
-  UV_UDP_PARTIAL = 2
+  UV_UDP_PARTIAL = 2,
+  /*
+   * Indicates message was received as part of a batch, see
+   * uv_udp_set_recv_batch(). Used in uv_udp_recv_cb.
+   */
+  UV_UDP_MMSG_CHUNK = 4
 };
 
 /*
@@ -812,7 +829,12 @@ typedef void (*uv_udp_send_cb)(uv_udp_send_t* req, int status);
  *  addr    struct sockaddr_in or struct sockaddr_in6.
  *          Valid for the duration of the callback only.
  *  flags   One or more OR'ed UV_UDP_* constants.
- *          Right now only UV_UDP_PARTIAL is used.
+ *          Right now only UV_UDP_PARTIAL and UV_UDP_MMSG_CHUNK are used.
+ *
+ * When UV_UDP_MMSG_CHUNK is set, `buf` points into the buffer that was
+ * returned by the alloc callback and must not be freed. That buffer is
+ * handed back in a final call with nread == 0 and addr == NULL once all
+ * datagrams from the batch have been delivered.
  */
 typedef void (*uv_udp_recv_cb)(uv_udp_t* handle, ssize_t nread, uv_buf_t buf,
     struct sockaddr* addr, unsigned flags);
@@ -1004,6 +1026,26 @@ UV_EXTERN int uv_udp_send6(uv_udp_send_t* req, uv_udp_t* handle,
 UV_EXTERN int uv_udp_recv_start(uv_udp_t* handle, uv_alloc_cb alloc_cb,
     uv_udp_recv_cb recv_cb);
 
+/*
+ * Receive up to `count` datagrams with a single system call. The alloc
+ * callback is asked for `count` times 64 kB, every datagram is reported with
+ * the UV_UDP_MMSG_CHUNK flag set and the buffer is handed back when the batch
+ * has been delivered. A count of 0 or 1 restores the default of one datagram
+ * per system call.
+ *
+ * Outgoing datagrams are batched automatically where the platform supports
+ * it.
+ *
+ * Arguments:
+ *  handle    UDP handle. Should have been initialized with `uv_udp_init`.
+ *  count     Maximum number of datagrams per read, at most 64.
+ *
+ * Returns:
+ *  0 on success, or an error code < 0 on failure. UV_ENOSYS means that
+ *  batched reads are not supported on this platform.
+ */
+UV_EXTERN int uv_udp_set_recv_batch(uv_udp_t* handle, unsigned int count);
+
 /*
  * Stop listening for incoming datagrams.
  *
@@ -1483,10 +1525,63 @@ struct uv_work_s {
   UV_WORK_PRIVATE_FIELDS
 };
 
+/*
+ * Work on the thread pool is split into classes, each with its own queue.
+ * By default the 4 threads of the I/O class run everything, but one of them
+ * is kept free for I/O so that, for example, a burst of CPU-bound requests
+ * doesn't hold up file system requests. The CPU and DNS classes can be given
+ * threads of their own, which help out with I/O requests when idle.
+ *
+ * The number of threads per class can be changed with the UV_THREADPOOL_SIZE
+ * (I/O, at least 1), UV_THREADPOOL_CPU_SIZE and UV_THREADPOOL_DNS_SIZE
+ * (0 by default) environment variables or uv_threadpool_set_size().
+ */
+typedef enum {
+  UV_WORK_IO = 0,  /* File system requests. */
+  UV_WORK_CPU,     /* CPU-bound work, the default for uv_queue_work(). */
+  UV_WORK_DNS      /* Name resolution. */
+} uv_work_class;
+
 /* Queues a work request to execute asynchronously on the thread pool. */
 UV_EXTERN int uv_queue_work(uv_loop_t* loop, uv_work_t* req,
     uv_work_cb work_cb, uv_after_work_cb after_work_cb);
 
+/* Like uv_queue_work() but lets you pick the work class. */
+UV_EXTERN int uv_queue_work2(uv_loop_t* loop, uv_work_t* req,
+    uv_work_class kind, uv_work_cb work_cb, uv_after_work_cb after_work_cb);
+
+/*
+ * Set the number of threads for a work class. Only works before the first
+ * request is queued, returns UV_EBUSY after that.
+ *
+ * Returns 0 on success, or an error code < 0 on failure. On Windows the
+ * system thread pool is used and this always returns UV_ENOSYS.
+ */
+UV_EXTERN int uv_threadpool_set_size(uv_work_class kind, unsigned int size);
+
+typedef struct {
+  uint64_t queued;    /* When the request was submitted. */
+  uint64_t started;   /* When a thread started executing it. */
+  uint64_t finished;  /* When it was done executing. */
+} uv_work_times_t;
+
+/*
+ * Get the times, in nanoseconds relative to an arbitrary time in the past
+ * (see uv_hrtime()), at which a uv_fs_t, uv_getaddrinfo_t or uv_work_t
+ * request went through the thread pool. Only valid in the request's
+ * callback. `started` and `finished` are zero for cancelled requests.
+ *
+ * Returns 0 on success, or an error code < 0 on failure. On Windows it
+ * always returns UV_ENOSYS.
+ */
+UV_EXTERN int uv_work_times(const uv_req_t* req, uv_work_times_t* times);
+
+/*
+ * Get the number of requests that are waiting in the queue of a work class,
+ * not counting the ones that are executing.
+ */
+UV_EXTERN unsigned int uv_threadpool_queue_length(uv_work_class kind);
+
 /* Cancel a pending request. Fails if the request is executing or has finished
  * executing.
  *
@@ -111,7 +111,8 @@ enum {
   UV_STREAM_READ_EOF      = 0x200,  /* read(2) read EOF. */
   UV_TCP_NODELAY          = 0x400,  /* Disable Nagle. */
   UV_TCP_KEEPALIVE        = 0x800,  /* Turn on keep-alive. */
-  UV_TCP_SINGLE_ACCEPT    = 0x1000  /* Only accept() when idle. */
+  UV_TCP_SINGLE_ACCEPT    = 0x1000, /* Only accept() when idle. */
+  UV_TCP_REUSEPORT        = 0x10000 /* Set SO_REUSEPORT before bind(). */
 };
 
 /* core */
@@ -157,6 +158,7 @@ int uv__accept(int sockfd);
 int uv_tcp_listen(uv_tcp_t* tcp, int backlog, uv_connection_cb cb);
 int uv__tcp_nodelay(int fd, int on);
 int uv__tcp_keepalive(int fd, int on, unsigned int delay);
+int uv__tcp_reuseport(int fd, int on);
 
 /* pipe */
 int uv_pipe_listen(uv_pipe_t* handle, int backlog, uv_connection_cb cb);
@@ -173,6 +175,7 @@ void uv__signal_loop_cleanup(uv_loop_t* loop);
 /* thread pool */
 void uv__work_submit(uv_loop_t* loop,
                      struct uv__work *w,
+                     uv_work_class kind,
                      void (*work)(struct uv__work *w),
                      void (*done)(struct uv__work *w, int status));
 void uv__work_done(uv_async_t* handle, int status);
@@ -71,6 +71,12 @@ static int uv__bind(uv_tcp_t* tcp,
   if (setsockopt(tcp->io_watcher.fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on)))
     return -errno;
 
+  if (tcp->flags & UV_TCP_REUSEPORT) {
+    err = uv__tcp_reuseport(tcp->io_watcher.fd, 1);
+    if (err)
+      return err;
+  }
+
   errno = 0;
   if (bind(tcp->io_watcher.fd, addr, addrsize) && errno != EADDRINUSE)
     return -errno;
@@ -315,6 +321,40 @@ int uv_tcp_keepalive(uv_tcp_t* handle, int on, unsigned int delay) {
 }
 
 
+int uv__tcp_reuseport(int fd, int on) {
+#if defined(SO_REUSEPORT)
+  if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)))
+    return -errno;
+  return 0;
+#else
+  return -ENOTSUP;
+#endif
+}
+
+
+int uv_tcp_reuseport(uv_tcp_t* handle, int on) {
+  int err;
+
+#if !defined(SO_REUSEPORT)
+  if (on)
+    return -ENOTSUP;
+#endif
+
+  if (uv__stream_fd(handle) != -1) {
+    err = uv__tcp_reuseport(uv__stream_fd(handle), on);
+    if (err)
+      return err;
+  }
+
+  if (on)
+    handle->flags |= UV_TCP_REUSEPORT;
+  else
+    handle->flags &= ~UV_TCP_REUSEPORT;
+
+  return 0;
+}
+
+
 int uv_tcp_simultaneous_accepts(uv_tcp_t* handle, int enable) {
   if (enable)
     handle->flags &= ~UV_TCP_SINGLE_ACCEPT;
@@ -20,18 +20,43 @@
  */
 
 #include "internal.h"
+#include <assert.h>
 #include <stdlib.h>
 
 #define MAX_THREADPOOL_SIZE 128
 
+/* Every work class has its own queue. By default only the I/O class has
+ * threads, as many as the single pool used to have, and they run the work of
+ * the other classes too. One of them is held back for I/O though, so that a
+ * burst of CPU-bound or DNS work can't starve file system requests. The CPU
+ * and DNS classes can be given dedicated threads, those help out with I/O
+ * when they're idle but never take on each other's work.
+ */
+struct work_class {
+  unsigned int nthreads;
+  unsigned int steal_mask;  /* Classes whose work this class may take. */
+  const char* env;  /* NULL once the size has been set explicitly. */
+  unsigned int idle_threads;
+  unsigned int nqueued;
+  uv_cond_t cond;
+  QUEUE wq;
+  QUEUE exit_message;
+};
+
+static struct work_class classes[] = {
+  /* UV_WORK_IO */
+  { 4, (1 << UV_WORK_CPU) | (1 << UV_WORK_DNS), "UV_THREADPOOL_SIZE" },
+  /* UV_WORK_CPU */
+  { 0, 1 << UV_WORK_IO, "UV_THREADPOOL_CPU_SIZE" },
+  /* UV_WORK_DNS */
+  { 0, 1 << UV_WORK_IO, "UV_THREADPOOL_DNS_SIZE" }
+};
+
 static uv_once_t once = UV_ONCE_INIT;
-static uv_cond_t cond;
 static uv_mutex_t mutex;
 static unsigned int nthreads;
 static uv_thread_t* threads;
-static uv_thread_t default_threads[4];
-static QUEUE exit_message;
-static QUEUE wq;
+static uv_thread_t default_threads[8];
 static volatile int initialized;
 
 
@@ -40,26 +65,65 @@ static void uv__cancelled(struct uv__work* w) {
 }
 
 
+/* Return the next request for a worker of class `kind`, or NULL if there's
+ * nothing it may run. Must be called with the global mutex held.
+ */
+static QUEUE* next_work(unsigned int kind) {
+  unsigned int i;
+  QUEUE* q;
+
+  if (!QUEUE_EMPTY(&classes[kind].wq))
+    return QUEUE_HEAD(&classes[kind].wq);
+
+  /* An I/O thread only runs other work while another I/O thread is idle. */
+  if (kind == UV_WORK_IO &&
+      classes[kind].nthreads > 1 &&
+      classes[kind].idle_threads == 0) {
+    return NULL;
+  }
+
+  for (i = 0; i < ARRAY_SIZE(classes); i++) {
+    if (!(classes[kind].steal_mask & (1 << i)))
+      continue;
+
+    if (QUEUE_EMPTY(&classes[i].wq))
+      continue;
+
+    q = QUEUE_HEAD(&classes[i].wq);
+    if (q != &classes[i].exit_message)
+      return q;
+  }
+
+  return NULL;
+}
+
+
 /* To avoid deadlock with uv_cancel() it's crucial that the worker
  * never holds the global mutex and the loop-local mutex at the same time.
  */
 static void worker(void* arg) {
+  struct work_class* c;
   struct uv__work* w;
+  unsigned int kind;
   QUEUE* q;
 
-  (void) arg;
+  kind = (unsigned int) (uintptr_t) arg;
+  c = classes + kind;
 
   for (;;) {
     uv_mutex_lock(&mutex);
 
-    while (QUEUE_EMPTY(&wq))
-      uv_cond_wait(&cond, &mutex);
-
-    q = QUEUE_HEAD(&wq);
+    while ((q = next_work(kind)) == NULL) {
+      c->idle_threads++;
+      uv_cond_wait(&c->cond, &mutex);
+      c->idle_threads--;
+    }
 
-    if (q == &exit_message)
-      uv_cond_signal(&cond);
+    if (q == &c->exit_message)
+      uv_cond_signal(&c->cond);
     else {
+      w = QUEUE_DATA(q, struct uv__work, wq);
+      classes[w->kind].nqueued--;
       QUEUE_REMOVE(q);
       QUEUE_INIT(q);  /* Signal uv_cancel() that the work req is
                              executing. */
@@ -67,11 +131,13 @@ static void worker(void* arg) {
 
     uv_mutex_unlock(&mutex);
 
-    if (q == &exit_message)
+    if (q == &c->exit_message)
       break;
 
     w = QUEUE_DATA(q, struct uv__work, wq);
+    w->start_time = uv__hrtime();
     w->work(w);
+    w->end_time = uv__hrtime();
 
     uv_mutex_lock(&w->loop->wq_mutex);
     w->work = NULL;  /* Signal uv_cancel() that the work req is done
@@ -83,47 +149,76 @@ static void worker(void* arg) {
 }
 
 
-static void post(QUEUE* q) {
+static void post(QUEUE* q, unsigned int kind) {
+  unsigned int i;
+
   uv_mutex_lock(&mutex);
-  QUEUE_INSERT_TAIL(&wq, q);
-  uv_cond_signal(&cond);
+  QUEUE_INSERT_TAIL(&classes[kind].wq, q);
+  classes[kind].nqueued++;
+
+  if (classes[kind].idle_threads > 0)
+    uv_cond_signal(&classes[kind].cond);
+  else {
+    /* Wake up an idle worker of a class that's allowed to help out. */
+    for (i = 0; i < ARRAY_SIZE(classes); i++) {
+      if ((classes[i].steal_mask & (1 << kind)) && classes[i].idle_threads) {
+        uv_cond_signal(&classes[i].cond);
+        break;
+      }
+    }
+  }
+
   uv_mutex_unlock(&mutex);
 }
 
 
 static void init_once(void) {
+  struct work_class* c;
   unsigned int i;
+  unsigned int k;
+  unsigned int n;
   const char* val;
 
-  nthreads = ARRAY_SIZE(default_threads);
-  val = getenv("UV_THREADPOOL_SIZE");
-  if (val != NULL)
-    nthreads = atoi(val);
-  if (nthreads == 0)
-    nthreads = 1;
-  if (nthreads > MAX_THREADPOOL_SIZE)
-    nthreads = MAX_THREADPOOL_SIZE;
+  nthreads = 0;
+  for (k = 0; k < ARRAY_SIZE(classes); k++) {
+    c = classes + k;
+    val = c->env != NULL ? getenv(c->env) : NULL;
+    if (val != NULL)
+      c->nthreads = atoi(val);
+    if (c->nthreads == 0 && k == UV_WORK_IO)
+      c->nthreads = 1;
+    if (c->nthreads > MAX_THREADPOOL_SIZE)
+      c->nthreads = MAX_THREADPOOL_SIZE;
+    nthreads += c->nthreads;
+  }
 
   threads = default_threads;
   if (nthreads > ARRAY_SIZE(default_threads)) {
     threads = malloc(nthreads * sizeof(threads[0]));
-    if (threads == NULL) {
-      nthreads = ARRAY_SIZE(default_threads);
-      threads = default_threads;
-    }
+    if (threads == NULL)
+      abort();
   }
 
-  if (uv_cond_init(&cond))
-    abort();
-
   if (uv_mutex_init(&mutex))
     abort();
 
-  QUEUE_INIT(&wq);
-
-  for (i = 0; i < nthreads; i++)
-    if (uv_thread_create(threads + i, worker, NULL))
+  for (k = 0; k < ARRAY_SIZE(classes); k++) {
+    c = classes + k;
+    if (uv_cond_init(&c->cond))
       abort();
+    QUEUE_INIT(&c->wq);
+    QUEUE_INIT(&c->exit_message);
+  }
+
+  i = 0;
+  for (k = 0; k < ARRAY_SIZE(classes); k++) {
+    for (n = 0; n < classes[k].nthreads; n++) {
+      if (uv_thread_create(threads + i, worker, (void*) (uintptr_t) k))
+        abort();
+      i++;
+    }
+  }
+  assert(i == nthreads);
 
   initialized = 1;
 }
@@ -133,11 +228,14 @@ static void init_once(void) {
 __attribute__((destructor))
 static void cleanup(void) {
   unsigned int i;
+  unsigned int k;
 
   if (initialized == 0)
     return;
 
-  post(&exit_message);
+  for (k = 0; k < ARRAY_SIZE(classes); k++)
+    if (classes[k].nthreads > 0)
+      post(&classes[k].exit_message, k);
 
   for (i = 0; i < nthreads; i++)
     if (uv_thread_join(threads + i))
@@ -146,8 +244,9 @@ static void cleanup(void) {
   if (threads != default_threads)
     free(threads);
 
+  for (k = 0; k < ARRAY_SIZE(classes); k++)
+    uv_cond_destroy(&classes[k].cond);
   uv_mutex_destroy(&mutex);
-  uv_cond_destroy(&cond);
 
   threads = NULL;
   nthreads = 0;
@@ -156,15 +255,39 @@ static void cleanup(void) {
 #endif
 
 
+int uv_threadpool_set_size(uv_work_class kind, unsigned int size) {
+  if ((unsigned int) kind >= ARRAY_SIZE(classes))
+    return -EINVAL;
+
+  /* Somebody has to run the I/O requests, the other classes can do
+   * without threads of their own.
+   */
+  if (kind == UV_WORK_IO && size == 0)
+    return -EINVAL;
+
+  if (initialized)
+    return -EBUSY;
+
+  classes[kind].nthreads = size;
+  classes[kind].env = NULL;
+  return 0;
+}
+
+
 void uv__work_submit(uv_loop_t* loop,
                      struct uv__work* w,
+                     uv_work_class kind,
                      void (*work)(struct uv__work* w),
                      void (*done)(struct uv__work* w, int status)) {
   uv_once(&once, init_once);
   w->loop = loop;
   w->work = work;
   w->done = done;
-  post(&w->wq);
+  w->kind = kind;
+  w->queue_time = uv__hrtime();
+  w->start_time = 0;
+  w->end_time = 0;
+  post(&w->wq, kind);
 }
 
 
@@ -175,8 +298,10 @@ static int uv__work_cancel(uv_loop_t* loop, uv_req_t* req, struct uv__work* w) {
   uv_mutex_lock(&w->loop->wq_mutex);
 
   cancelled = !QUEUE_EMPTY(&w->wq) && w->work != NULL;
-  if (cancelled)
+  if (cancelled) {
     QUEUE_REMOVE(&w->wq);
+    classes[w->kind].nqueued--;
+  }
 
   uv_mutex_unlock(&w->loop->wq_mutex);
   uv_mutex_unlock(&mutex);
@@ -246,18 +371,72 @@ int uv_queue_work(uv_loop_t* loop,
                   uv_work_t* req,
                   uv_work_cb work_cb,
                   uv_after_work_cb after_work_cb) {
+  return uv_queue_work2(loop, req, UV_WORK_CPU, work_cb, after_work_cb);
+}
+
+
+int uv_queue_work2(uv_loop_t* loop,
+                   uv_work_t* req,
+                   uv_work_class kind,
+                   uv_work_cb work_cb,
+                   uv_after_work_cb after_work_cb) {
   if (work_cb == NULL)
     return -EINVAL;
 
+  if ((unsigned int) kind >= ARRAY_SIZE(classes))
+    return -EINVAL;
+
   uv__req_init(loop, req, UV_WORK);
   req->loop = loop;
   req->work_cb = work_cb;
   req->after_work_cb = after_work_cb;
-  uv__work_submit(loop, &req->work_req, uv__queue_work, uv__queue_done);
+  uv__work_submit(loop, &req->work_req, kind, uv__queue_work, uv__queue_done);
   return 0;
 }
 
 
+static struct uv__work* uv__work_from_req(const uv_req_t* req) {
+  switch (req->type) {
+  case UV_FS:
+    return &((uv_fs_t*) req)->work_req;
+  case UV_GETADDRINFO:
+    return &((uv_getaddrinfo_t*) req)->work_req;
+  case UV_WORK:
+    return &((uv_work_t*) req)->work_req;
+  default:
+    return NULL;
+  }
+}
+
+
+int uv_work_times(const uv_req_t* req, uv_work_times_t* times) {
+  struct uv__work* w;
+
+  w = uv__work_from_req(req);
+  if (w == NULL)
+    return -EINVAL;
+
+  times->queued = w->queue_time;
+  times->started = w->start_time;
+  times->finished = w->end_time;
+  return 0;
+}
+
+
+unsigned int uv_threadpool_queue_length(uv_work_class kind) {
+  unsigned int n;
+
+  if ((unsigned int) kind >= ARRAY_SIZE(classes) || !initialized)
+    return 0;
+
+  uv_mutex_lock(&mutex);
+  n = classes[kind].nqueued;
+  uv_mutex_unlock(&mutex);
+
+  return n;
+}
+
+
 int uv_cancel(uv_req_t* req) {
   struct uv__work* wreq;
   uv_loop_t* loop;
@@ -28,6 +28,9 @@
 #include <stdlib.h>
 #include <unistd.h>
 
+#define UV__UDP_DGRAM_MAXSIZE (64 * 1024)
+#define UV__UDP_MMSG_MAXWIDTH 64
+
 
 static void uv__udp_run_completed(uv_udp_t* handle);
 static void uv__udp_run_pending(uv_udp_t* handle);
@@ -83,6 +86,202 @@ void uv__udp_finish_close(uv_udp_t* handle) {
 }
 
 
+#if defined(__linux__)
+
+static int uv__udp_recvmmsg(int fd, struct uv__mmsghdr* msgs, unsigned int n) {
+  static int no_recvmmsg;
+  ssize_t size;
+  int r;
+
+  if (no_recvmmsg == 0) {
+    r = uv__recvmmsg(fd, msgs, n, 0, NULL);
+    if (r != -1 || errno != ENOSYS)
+      return r;
+    no_recvmmsg = 1;
+  }
+
+  /* Kernel too old, read one datagram at a time. */
+  size = recvmsg(fd, &msgs[0].msg_hdr, 0);
+  if (size == -1)
+    return -1;
+
+  msgs[0].msg_len = size;
+  return 1;
+}
+
+
+static int uv__udp_sendmmsg(int fd, struct uv__mmsghdr* msgs, unsigned int n) {
+  static int no_sendmmsg;
+  ssize_t size;
+  int r;
+
+  if (no_sendmmsg == 0) {
+    r = uv__sendmmsg(fd, msgs, n, 0);
+    if (r != -1 || errno != ENOSYS)
+      return r;
+    no_sendmmsg = 1;
+  }
+
+  /* Kernel too old, write one datagram at a time. */
+  size = sendmsg(fd, &msgs[0].msg_hdr, 0);
+  if (size == -1)
+    return -1;
+
+  msgs[0].msg_len = size;
+  return 1;
+}
+
+
+/* Like the generic version below but hands all queued datagrams to the kernel
+ * in one sendmmsg() call. The kernel stops at the first datagram that fails;
+ * that one is completed with the error and the rest is retried.
+ */
+static void uv__udp_run_pending(uv_udp_t* handle) {
+  struct uv__mmsghdr msgs[UV__UDP_MMSG_MAXWIDTH];
+  struct msghdr* h;
+  uv_udp_send_t* req;
+  QUEUE* q;
+  int npkts;
+  int nsent;
+  int i;
+
+  while (!QUEUE_EMPTY(&handle->write_queue)) {
+    npkts = 0;
+    q = QUEUE_HEAD(&handle->write_queue);
+
+    while (q != &handle->write_queue && npkts < UV__UDP_MMSG_MAXWIDTH) {
+      req = QUEUE_DATA(q, uv_udp_send_t, queue);
+
+      h = &msgs[npkts].msg_hdr;
+      memset(h, 0, sizeof(*h));
+      h->msg_name = &req->addr;
+      h->msg_namelen = (req->addr.sin6_family == AF_INET6 ?
+        sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in));
+      h->msg_iov = (struct iovec*) req->bufs;
+      h->msg_iovlen = req->bufcnt;
+      msgs[npkts].msg_len = 0;
+
+      npkts++;
+      q = QUEUE_NEXT(q);
+    }
+
+    do {
+      nsent = uv__udp_sendmmsg(handle->io_watcher.fd, msgs, npkts);
+    }
+    while (nsent == -1 && errno == EINTR);
+
+    if (nsent == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+      break;
+
+    if (nsent == -1) {
+      q = QUEUE_HEAD(&handle->write_queue);
+      req = QUEUE_DATA(q, uv_udp_send_t, queue);
+      req->status = -errno;
+      QUEUE_REMOVE(&req->queue);
+      QUEUE_INSERT_TAIL(&handle->write_completed_queue, &req->queue);
+      continue;
+    }
+
+    /* See the generic version on why partial writes are not an issue. */
+    for (i = 0; i < nsent; i++) {
+      q = QUEUE_HEAD(&handle->write_queue);
+      req = QUEUE_DATA(q, uv_udp_send_t, queue);
+      req->status = msgs[i].msg_len;
+      QUEUE_REMOVE(&req->queue);
+      QUEUE_INSERT_TAIL(&handle->write_completed_queue, &req->queue);
+    }
+  }
+}
+
+
+static void uv__udp_recvmmsg_batch(uv_udp_t* handle) {
+  struct sockaddr_in6 peers[UV__UDP_MMSG_MAXWIDTH];
+  struct uv__mmsghdr msgs[UV__UDP_MMSG_MAXWIDTH];
+  struct iovec iov[UV__UDP_MMSG_MAXWIDTH];
+  uv_udp_recv_cb recv_cb;
+  struct msghdr* h;
+  unsigned int nchunks;
+  unsigned int flags;
+  uv_buf_t buf;
+  int nread;
+  int count;
+  int k;
+
+  /* Same starvation guard as the one in uv__udp_recvmsg() below, only it
+   * counts system calls, not datagrams.
+   */
+  count = 32;
+
+  do {
+    buf = handle->alloc_cb((uv_handle_t*) handle,
+                           handle->recv_batch * UV__UDP_DGRAM_MAXSIZE);
+    if (buf.len == 0) {
+      handle->recv_cb(handle, UV_ENOBUFS, buf, NULL, 0);
+      return;
+    }
+    assert(buf.base != NULL);
+
+    nchunks = buf.len / UV__UDP_DGRAM_MAXSIZE;
+    if (nchunks > handle->recv_batch)
+      nchunks = handle->recv_batch;
+    if (nchunks == 0)
+      nchunks = 1;
+
+    for (k = 0; k < (int) nchunks; k++) {
+      iov[k].iov_base = buf.base + k * UV__UDP_DGRAM_MAXSIZE;
+      iov[k].iov_len = UV__UDP_DGRAM_MAXSIZE;
+      if (iov[k].iov_len > buf.len - k * UV__UDP_DGRAM_MAXSIZE)
+        iov[k].iov_len = buf.len - k * UV__UDP_DGRAM_MAXSIZE;
+
+      h = &msgs[k].msg_hdr;
+      memset(h, 0, sizeof(*h));
+      h->msg_name = &peers[k];
+      h->msg_namelen = sizeof(peers[k]);
+      h->msg_iov = &iov[k];
+      h->msg_iovlen = 1;
+      msgs[k].msg_len = 0;
+    }
+
+    do {
+      nread = uv__udp_recvmmsg(handle->io_watcher.fd, msgs, nchunks);
+    }
+    while (nread == -1 && errno == EINTR);
+
+    if (nread == -1) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+        handle->recv_cb(handle, 0, buf, NULL, 0);
+      else
+        handle->recv_cb(handle, -errno, buf, NULL, 0);
+      return;
+    }
+
+    /* The recv callback may stop or close the handle halfway through the
+     * batch. Hold on to it so the buffer is always handed back.
+     */
+    recv_cb = handle->recv_cb;
+
+    for (k = 0; k < nread && handle->recv_cb != NULL; k++) {
+      flags = UV_UDP_MMSG_CHUNK;
+      if (msgs[k].msg_hdr.msg_flags & MSG_TRUNC)
+        flags |= UV_UDP_PARTIAL;
+
+      handle->recv_cb(handle,
+                      msgs[k].msg_len,
+                      uv_buf_init(iov[k].iov_base, iov[k].iov_len),
+                      (struct sockaddr*) &peers[k],
+                      flags);
+    }
+
+    recv_cb(handle, 0, buf, NULL, 0);
+  }
+  while (nread == (int) nchunks
+      && count-- > 0
+      && handle->io_watcher.fd != -1
+      && handle->recv_cb != NULL);
+}
+
+#else  /* !defined(__linux__) */
+
 static void uv__udp_run_pending(uv_udp_t* handle) {
   uv_udp_send_t* req;
   QUEUE* q;
@@ -139,6 +338,8 @@ static void uv__udp_run_pending(uv_udp_t* handle) {
   }
 }
 
+#endif  /* defined(__linux__) */
+
 
 static void uv__udp_run_completed(uv_udp_t* handle) {
   uv_udp_send_t* req;
@@ -196,6 +397,13 @@ static void uv__udp_recvmsg(uv_loop_t* loop,
   assert(handle->recv_cb != NULL);
   assert(handle->alloc_cb != NULL);
 
+#if defined(__linux__)
+  if (handle->recv_batch > 1) {
+    uv__udp_recvmmsg_batch(handle);
+    return;
+  }
+#endif
+
   /* Prevent loop starvation when the data comes in as fast as (or faster than)
    * we can read it. XXX Need to rearm fd if we switch to edge-triggered I/O.
    */
@@ -438,6 +646,7 @@ int uv_udp_init(uv_loop_t* loop, uv_udp_t* handle) {
   uv__handle_init(loop, (uv_handle_t*)handle, UV_UDP);
   handle->alloc_cb = NULL;
   handle->recv_cb = NULL;
+  handle->recv_batch = 1;
   uv__io_init(&handle->io_watcher, uv__udp_io, -1);
   QUEUE_INIT(&handle->write_queue);
   QUEUE_INIT(&handle->write_completed_queue);
@@ -658,6 +867,23 @@ int uv__udp_recv_start(uv_udp_t* handle,
 }
 
 
+int uv_udp_set_recv_batch(uv_udp_t* handle, unsigned int count) {
+  if (count > UV__UDP_MMSG_MAXWIDTH)
+    return -EINVAL;
+
+  if (count == 0)
+    count = 1;
+
+#if !defined(__linux__)
+  if (count > 1)
+    return -ENOSYS;
+#endif
+
+  handle->recv_batch = count;
+  return 0;
+}
+
+
 int uv__udp_recv_stop(uv_udp_t* handle) {
   uv__io_stop(handle->loop, &handle->io_watcher, UV__POLLIN);
 
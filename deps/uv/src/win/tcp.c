@@ -1241,6 +1241,16 @@ int uv_tcp_duplicate_socket(uv_tcp_t* handle, int pid,
 }
 
 
+int uv_tcp_reuseport(uv_tcp_t* handle, int enable) {
+  /* Windows' SO_REUSEADDR already lets sockets steal each other's port but
+   * it doesn't balance connections. Don't pretend.
+   */
+  if (enable)
+    return UV_ENOTSUP;
+  return 0;
+}
+
+
 int uv_tcp_simultaneous_accepts(uv_tcp_t* handle, int enable) {
   if (handle->flags & UV_HANDLE_CONNECTION) {
     return UV_EINVAL;
@@ -55,9 +55,19 @@ static DWORD WINAPI uv_work_thread_proc(void* parameter) {
 
 int uv_queue_work(uv_loop_t* loop, uv_work_t* req, uv_work_cb work_cb,
     uv_after_work_cb after_work_cb) {
+  return uv_queue_work2(loop, req, UV_WORK_CPU, work_cb, after_work_cb);
+}
+
+
+/* Work classes aren't used, the system thread pool takes care of sizing. */
+int uv_queue_work2(uv_loop_t* loop, uv_work_t* req, uv_work_class kind,
+    uv_work_cb work_cb, uv_after_work_cb after_work_cb) {
   if (work_cb == NULL)
     return UV_EINVAL;
 
+  if ((unsigned int) kind > UV_WORK_DNS)
+    return UV_EINVAL;
+
   uv_work_req_init(loop, req, work_cb, after_work_cb);
 
   if (!QueueUserWorkItem(&uv_work_thread_proc, req, WT_EXECUTELONGFUNCTION)) {
@@ -69,6 +79,21 @@ int uv_queue_work(uv_loop_t* loop, uv_work_t* req, uv_work_cb work_cb,
 }
 
 
+int uv_threadpool_set_size(uv_work_class kind, unsigned int size) {
+  return UV_ENOSYS;
+}
+
+
+int uv_work_times(const uv_req_t* req, uv_work_times_t* times) {
+  return UV_ENOSYS;
+}
+
+
+unsigned int uv_threadpool_queue_length(uv_work_class kind) {
+  return 0;
+}
+
+
 int uv_cancel(uv_req_t* req) {
   return UV_ENOSYS;
 }
@@ -376,6 +376,17 @@ int uv__udp_recv_start(uv_udp_t* handle, uv_alloc_cb alloc_cb,
 }
 
 
+int uv_udp_set_recv_batch(uv_udp_t* handle, unsigned int count) {
+  if (count > 64)
+    return UV_EINVAL;
+
+  if (count > 1)
+    return UV_ENOSYS;
+
+  return 0;
+}
+
+
 int uv__udp_recv_stop(uv_udp_t* handle) {
   if (handle->flags & UV_HANDLE_READING) {
     handle->flags &= ~UV_HANDLE_READING;
@@ -0,0 +1,151 @@
+/* Copyright Joyent, Inc. and other Node contributors. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "uv.h"
+#include "task.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+
+static uv_tcp_t server1, server2;
+static uv_tcp_t client;
+static uv_tcp_t accepted;
+static uv_connect_t connect_req;
+static int connection_cb_called = 0;
+static int connect_cb_called = 0;
+static int close_cb_called = 0;
+
+
+static void close_cb(uv_handle_t* handle) {
+  ASSERT(handle != NULL);
+  close_cb_called++;
+}
+
+
+static void connection_cb(uv_stream_t* server, int status) {
+  ASSERT(status == 0);
+  ASSERT(server == (uv_stream_t*)&server1 || server == (uv_stream_t*)&server2);
+  ASSERT(0 == uv_tcp_init(server->loop, &accepted));
+  ASSERT(0 == uv_accept(server, (uv_stream_t*)&accepted));
+  connection_cb_called++;
+  uv_close((uv_handle_t*)&accepted, close_cb);
+  uv_close((uv_handle_t*)&server1, close_cb);
+  uv_close((uv_handle_t*)&server2, close_cb);
+}
+
+
+static void connect_cb(uv_connect_t* req, int status) {
+  ASSERT(req == &connect_req);
+  ASSERT(status == 0);
+  connect_cb_called++;
+  uv_close((uv_handle_t*)&client, close_cb);
+}
+
+
+TEST_IMPL(tcp_reuseport) {
+  struct sockaddr_in addr = uv_ip4_addr("127.0.0.1", TEST_PORT);
+  uv_loop_t* loop;
+  int r;
+
+  loop = uv_default_loop();
+
+  r = uv_tcp_init(loop, &server1);
+  ASSERT(r == 0);
+  r = uv_tcp_reuseport(&server1, 1);
+  if (r == UV_ENOTSUP)
+    RETURN_SKIP("SO_REUSEPORT not supported.");
+  ASSERT(r == 0);
+  r = uv_tcp_bind(&server1, addr);
+  ASSERT(r == 0);
+
+  r = uv_tcp_init(loop, &server2);
+  ASSERT(r == 0);
+  r = uv_tcp_reuseport(&server2, 1);
+  ASSERT(r == 0);
+  r = uv_tcp_bind(&server2, addr);
+  ASSERT(r == 0);
+
+  r = uv_listen((uv_stream_t*)&server1, 128, connection_cb);
+  if (r == UV_EADDRINUSE)
+    RETURN_SKIP("SO_REUSEPORT doesn't allow duplicate TCP listeners.");
+  ASSERT(r == 0);
+  r = uv_listen((uv_stream_t*)&server2, 128, connection_cb);
+  if (r == UV_EADDRINUSE)
+    RETURN_SKIP("SO_REUSEPORT doesn't allow duplicate TCP listeners.");
+  ASSERT(r == 0);
+
+  r = uv_tcp_init(loop, &client);
+  ASSERT(r == 0);
+  r = uv_tcp_connect(&connect_req, &client, addr, connect_cb);
+  ASSERT(r == 0);
+
+  uv_run(loop, UV_RUN_DEFAULT);
+
+  ASSERT(connection_cb_called == 1);
+  ASSERT(connect_cb_called == 1);
+  ASSERT(close_cb_called == 4);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+TEST_IMPL(tcp_reuseport_off) {
+  struct sockaddr_in addr = uv_ip4_addr("127.0.0.1", TEST_PORT);
+  uv_loop_t* loop;
+  int r;
+
+  loop = uv_default_loop();
+
+  /* Only one of the two sockets opts in, the second listen() must fail. */
+  r = uv_tcp_init(loop, &server1);
+  ASSERT(r == 0);
+  r = uv_tcp_reuseport(&server1, 1);
+  if (r == UV_ENOTSUP)
+    RETURN_SKIP("SO_REUSEPORT not supported.");
+  ASSERT(r == 0);
+  r = uv_tcp_bind(&server1, addr);
+  ASSERT(r == 0);
+
+  r = uv_tcp_init(loop, &server2);
+  ASSERT(r == 0);
+  r = uv_tcp_reuseport(&server2, 1);
+  ASSERT(r == 0);
+  r = uv_tcp_reuseport(&server2, 0);
+  ASSERT(r == 0);
+  r = uv_tcp_bind(&server2, addr);
+  ASSERT(r == 0);
+
+  r = uv_listen((uv_stream_t*)&server1, 128, NULL);
+  ASSERT(r == 0);
+  r = uv_listen((uv_stream_t*)&server2, 128, NULL);
+  ASSERT(r == UV_EADDRINUSE);
+
+  uv_close((uv_handle_t*)&server1, close_cb);
+  uv_close((uv_handle_t*)&server2, close_cb);
+
+  uv_run(loop, UV_RUN_DEFAULT);
+
+  ASSERT(close_cb_called == 2);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
@@ -68,7 +68,12 @@ static void done_cb(uv_work_t* req, int status) {
 
 
 static void saturate_threadpool(void) {
+  /* Saturate the CPU class first, the I/O threads take CPU work but hold
+   * one of them back that only I/O work gets to use.
+   */
+  static const uv_work_class kinds[] = { UV_WORK_CPU, UV_WORK_IO, UV_WORK_DNS };
   uv_work_t* req;
+  unsigned i;
 
   ASSERT(0 == uv_cond_init(&signal_cond));
   ASSERT(0 == uv_mutex_init(&signal_mutex));
@@ -77,18 +82,27 @@ static void saturate_threadpool(void) {
   uv_mutex_lock(&signal_mutex);
   uv_mutex_lock(&wait_mutex);
 
-  for (num_threads = 0; /* empty */; num_threads++) {
-    req = malloc(sizeof(*req));
-    ASSERT(req != NULL);
-    ASSERT(0 == uv_queue_work(uv_default_loop(), req, work_cb, done_cb));
-
-    /* Expect to get signalled within 350 ms, otherwise assume that
-     * the thread pool is saturated. As with any timing dependent test,
-     * this is obviously not ideal.
-     */
-    if (uv_cond_timedwait(&signal_cond, &signal_mutex, 350 * 1e6)) {
-      ASSERT(0 == uv_cancel((uv_req_t*) req));
-      break;
+  num_threads = 0;
+  for (i = 0; i < ARRAY_SIZE(kinds); i++) {
+    for (;;) {
+      req = malloc(sizeof(*req));
+      ASSERT(req != NULL);
+      ASSERT(0 == uv_queue_work2(uv_default_loop(),
+                                 req,
+                                 kinds[i],
+                                 work_cb,
+                                 done_cb));
+
+      /* Expect to get signalled within 350 ms, otherwise assume that
+       * the work class is saturated. As with any timing dependent test,
+       * this is obviously not ideal.
+       */
+      if (uv_cond_timedwait(&signal_cond, &signal_mutex, 350 * 1e6)) {
+        ASSERT(0 == uv_cancel((uv_req_t*) req));
+        break;
+      }
+
+      num_threads++;
     }
   }
 }
@@ -101,7 +115,8 @@ static void unblock_threadpool(void) {
 
 
 static void cleanup_threadpool(void) {
-  ASSERT(done_cb_called == num_threads + 1);  /* +1 == cancelled work req. */
+  /* +3 == one cancelled work req per work class. */
+  ASSERT(done_cb_called == num_threads + 3);
   ASSERT(work_cb_called == num_threads);
 
   uv_cond_destroy(&signal_cond);
@@ -74,3 +74,137 @@ TEST_IMPL(threadpool_queue_work_einval) {
   MAKE_VALGRIND_HAPPY();
   return 0;
 }
+
+
+TEST_IMPL(threadpool_queue_work2) {
+  static const uv_work_class kinds[] = { UV_WORK_IO, UV_WORK_CPU, UV_WORK_DNS };
+  unsigned i;
+  int r;
+
+  for (i = 0; i < ARRAY_SIZE(kinds); i++) {
+    work_req.data = &data;
+    r = uv_queue_work2(uv_default_loop(),
+                       &work_req,
+                       kinds[i],
+                       work_cb,
+                       after_work_cb);
+    ASSERT(r == 0);
+    uv_run(uv_default_loop(), UV_RUN_DEFAULT);
+
+    ASSERT(work_cb_count == (int) i + 1);
+    ASSERT(after_work_cb_count == (int) i + 1);
+  }
+
+  r = uv_queue_work2(uv_default_loop(),
+                     &work_req,
+                     (uv_work_class) 42,
+                     work_cb,
+                     after_work_cb);
+  ASSERT(r == UV_EINVAL);
+
+#ifndef _WIN32
+  /* Too late, the thread pool is up and running. */
+  r = uv_threadpool_set_size(UV_WORK_CPU, 8);
+  ASSERT(r == UV_EBUSY);
+#endif
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+static void times_after_work_cb(uv_work_t* req, int status) {
+  uv_work_times_t times;
+
+  ASSERT(status == 0);
+  ASSERT(0 == uv_work_times((uv_req_t*) req, &times));
+  ASSERT(times.queued > 0);
+  ASSERT(times.started >= times.queued);
+  ASSERT(times.finished >= times.started);
+  after_work_cb_count++;
+}
+
+
+TEST_IMPL(threadpool_work_times) {
+  uv_req_t other_req;
+  int r;
+
+#ifdef _WIN32
+  RETURN_SKIP("uv_work_times() is not implemented on Windows.");
+#endif
+
+  work_req.data = &data;
+  r = uv_queue_work(uv_default_loop(), &work_req, work_cb, times_after_work_cb);
+  ASSERT(r == 0);
+  uv_run(uv_default_loop(), UV_RUN_DEFAULT);
+  ASSERT(after_work_cb_count == 1);
+
+  ASSERT(0 == uv_threadpool_queue_length(UV_WORK_CPU));
+  other_req.type = UV_CONNECT;
+  ASSERT(UV_EINVAL == uv_work_times(&other_req, NULL));
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+/* By default the I/O threads run uv_queue_work() requests too, but they keep
+ * one of them free for file system requests.
+ */
+static uv_barrier_t cpu_barrier;
+static uv_sem_t cpu_sem;
+static uv_work_t cpu_reqs[3];
+static uv_fs_t stat_req;
+static int cpu_work_count;
+
+
+static void cpu_work_cb(uv_work_t* req) {
+  /* Only gets past the barrier if all three run at the same time. */
+  uv_barrier_wait(&cpu_barrier);
+  uv_sem_wait(&cpu_sem);
+}
+
+
+static void cpu_after_work_cb(uv_work_t* req, int status) {
+  ASSERT(status == 0);
+  cpu_work_count++;
+}
+
+
+static void stat_cb(uv_fs_t* req) {
+  unsigned i;
+
+  ASSERT(req == &stat_req);
+  ASSERT(req->result == 0);
+  uv_fs_req_cleanup(req);
+
+  for (i = 0; i < ARRAY_SIZE(cpu_reqs); i++)
+    uv_sem_post(&cpu_sem);
+}
+
+
+TEST_IMPL(threadpool_shared_io_threads) {
+  unsigned i;
+
+  ASSERT(0 == uv_barrier_init(&cpu_barrier, ARRAY_SIZE(cpu_reqs)));
+  ASSERT(0 == uv_sem_init(&cpu_sem, 0));
+
+  for (i = 0; i < ARRAY_SIZE(cpu_reqs); i++) {
+    ASSERT(0 == uv_queue_work(uv_default_loop(),
+                              cpu_reqs + i,
+                              cpu_work_cb,
+                              cpu_after_work_cb));
+  }
+
+  /* Stuck behind the CPU work if no thread is kept free for it. */
+  ASSERT(0 == uv_fs_stat(uv_default_loop(), &stat_req, ".", stat_cb));
+
+  ASSERT(0 == uv_run(uv_default_loop(), UV_RUN_DEFAULT));
+  ASSERT(cpu_work_count == ARRAY_SIZE(cpu_reqs));
+
+  uv_barrier_destroy(&cpu_barrier);
+  uv_sem_destroy(&cpu_sem);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
@@ -0,0 +1,134 @@
+/* Copyright Joyent, Inc. and other Node contributors. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "uv.h"
+#include "task.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_DATAGRAMS 10
+#define RECV_BATCH 4
+
+static uv_udp_t server;
+static uv_udp_t client;
+
+static uv_udp_send_t send_reqs[NUM_DATAGRAMS];
+static char slab[RECV_BATCH * 64 * 1024];
+
+static int send_cb_called;
+static int recv_cb_called;
+static int free_cb_called;
+static int close_cb_called;
+
+
+static uv_buf_t alloc_cb(uv_handle_t* handle, size_t suggested_size) {
+  ASSERT(handle == (uv_handle_t*) &server);
+  ASSERT(suggested_size == sizeof(slab));
+  return uv_buf_init(slab, sizeof(slab));
+}
+
+
+static void close_cb(uv_handle_t* handle) {
+  close_cb_called++;
+}
+
+
+static void send_cb(uv_udp_send_t* req, int status) {
+  ASSERT(status == 0);
+  send_cb_called++;
+}
+
+
+static void recv_cb(uv_udp_t* handle,
+                    ssize_t nread,
+                    uv_buf_t buf,
+                    struct sockaddr* addr,
+                    unsigned flags) {
+  ASSERT(handle == &server);
+
+  if (nread == 0) {
+    /* The batch buffer is handed back, or there was nothing to read. */
+    ASSERT(addr == NULL);
+    ASSERT(buf.base == slab);
+    free_cb_called++;
+    return;
+  }
+
+  ASSERT(nread == 4);
+  ASSERT(addr != NULL);
+  ASSERT(flags & UV_UDP_MMSG_CHUNK);
+  ASSERT(buf.base >= slab && buf.base < slab + sizeof(slab));
+  ASSERT(memcmp(buf.base, "PING", nread) == 0);
+
+  if (++recv_cb_called == NUM_DATAGRAMS) {
+    uv_close((uv_handle_t*) &server, close_cb);
+    uv_close((uv_handle_t*) &client, close_cb);
+  }
+}
+
+
+TEST_IMPL(udp_mmsg) {
+  struct sockaddr_in addr;
+  uv_buf_t buf;
+  int r;
+  int i;
+
+  r = uv_udp_init(uv_default_loop(), &server);
+  ASSERT(r == 0);
+
+  r = uv_udp_set_recv_batch(&server, 65);
+  ASSERT(r == UV_EINVAL);
+
+  r = uv_udp_set_recv_batch(&server, RECV_BATCH);
+  if (r == UV_ENOSYS)
+    RETURN_SKIP("Batched reads are not supported on this platform.");
+  ASSERT(r == 0);
+
+  r = uv_udp_bind(&server, uv_ip4_addr("0.0.0.0", TEST_PORT), 0);
+  ASSERT(r == 0);
+
+  r = uv_udp_recv_start(&server, alloc_cb, recv_cb);
+  ASSERT(r == 0);
+
+  r = uv_udp_init(uv_default_loop(), &client);
+  ASSERT(r == 0);
+
+  /* All sends are queued before the loop runs so they go out in one batch. */
+  addr = uv_ip4_addr("127.0.0.1", TEST_PORT);
+  buf = uv_buf_init("PING", 4);
+  for (i = 0; i < NUM_DATAGRAMS; i++) {
+    r = uv_udp_send(&send_reqs[i], &client, &buf, 1, addr, send_cb);
+    ASSERT(r == 0);
+  }
+
+  r = uv_run(uv_default_loop(), UV_RUN_DEFAULT);
+  ASSERT(r == 0);
+
+  ASSERT(send_cb_called == NUM_DATAGRAMS);
+  ASSERT(recv_cb_called == NUM_DATAGRAMS);
+  ASSERT(free_cb_called > 0);
+  ASSERT(close_cb_called == 2);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
@@ -38,6 +38,8 @@ var kOnHeaders = HTTPParser.kOnHeaders | 0;
 var kOnHeadersComplete = HTTPParser.kOnHeadersComplete | 0;
 var kOnBody = HTTPParser.kOnBody | 0;
 var kOnMessageComplete = HTTPParser.kOnMessageComplete | 0;
+var kOnExecute = HTTPParser.kOnExecute | 0;
+exports.kOnExecute = kOnExecute;
 
 // Only called in the slow case where slow means
 // that the request headers were either fragmented
@@ -54,7 +56,8 @@ function parserOnHeaders(headers, url) {
 }
 
 // info.headers and info.url are set only if .onHeaders()
-// has not been called for this request.
+// has not been called for this request. The same goes for
+// info.headersObject, the headers merged like _addHeaderLines() does.
 //
 // info.url is not set for response parsers but that's not
 // applicable here since all our parsers are request parsers.
@@ -87,7 +90,13 @@ function parserOnHeadersComplete(info) {
     n = Math.min(n, parser.maxHeaderPairs);
   }
 
-  parser.incoming._addHeaderLines(headers, n);
+  // In the fast case the parser already merged the headers into an object.
+  if (info.headersObject && n === headers.length) {
+    parser.incoming.rawHeaders = headers;
+    parser.incoming.headers = info.headersObject;
+  } else {
+    parser.incoming._addHeaderLines(headers, n);
+  }
 
   if (info.method) {
     // server only
@@ -196,6 +205,11 @@ function freeParser(parser, req) {
   if (parser) {
     parser._headers = [];
     parser.onIncoming = null;
+    if (parser._consumed) {
+      parser.unconsume();
+      parser._consumed = false;
+    }
+    parser[kOnExecute] = null;
     if (parser.socket)
       parser.socket.parser = null;
     parser.socket = null;
@@ -22,15 +22,35 @@
 var util = require('util');
 var Stream = require('stream');
 
+// A socket whose handle is consumed by the parser never sees any data
+// itself, pausing it would not stop the reads. Go to the handle instead.
 function readStart(socket) {
-  if (socket)
+  if (socket && socket.parser && socket.parser._consumed) {
+    var handle = socket._handle;
+    if (handle && !handle.reading) {
+      handle.reading = true;
+      var err = handle.readStart();
+      if (err)
+        socket._destroy(util._errnoException(err, 'read'));
+    }
+  } else if (socket) {
     socket.resume();
+  }
 }
 exports.readStart = readStart;
 
 function readStop(socket) {
-  if (socket)
+  if (socket && socket.parser && socket.parser._consumed) {
+    var handle = socket._handle;
+    if (handle && handle.reading) {
+      handle.reading = false;
+      var err = handle.readStop();
+      if (err)
+        socket._destroy(util._errnoException(err, 'read'));
+    }
+  } else if (socket) {
     socket.pause();
+  }
 }
 exports.readStop = readStop;
 
@@ -21,22 +21,16 @@
 
 var assert = require('assert').ok;
 var Stream = require('stream');
-var timers = require('timers');
 var util = require('util');
 
 var common = require('_http_common');
+var binding = process.binding('http_parser');
 
 var CRLF = common.CRLF;
-var chunkExpression = common.chunkExpression;
 var debug = common.debug;
 
-
-var connectionExpression = /Connection/i;
-var transferEncodingExpression = /Transfer-Encoding/i;
-var closeExpression = /close/i;
-var contentLengthExpression = /Content-Length/i;
-var dateExpression = /Date/i;
-var expectExpression = /Expect/i;
+var serializeHeaders = binding.serializeHeaders;
+var outgoingState = binding.outgoingState;
 
 var automaticHeaders = {
   connection: true,
@@ -46,21 +40,6 @@ var automaticHeaders = {
 };
 
 
-var dateCache;
-function utcDate() {
-  if (!dateCache) {
-    var d = new Date();
-    dateCache = d.toUTCString();
-    timers.enroll(utcDate, 1000 - d.getMilliseconds());
-    timers._unrefActive(utcDate);
-  }
-  return dateCache;
-}
-utcDate._onTimeout = function() {
-  dateCache = undefined;
-};
-
-
 function OutgoingMessage() {
   Stream.call(this);
 
@@ -188,49 +167,27 @@ OutgoingMessage.prototype._buffer = function(data, encoding, callback) {
 };
 
 
-OutgoingMessage.prototype._storeHeader = function(firstLine, headers) {
-  // firstLine in the case of request is: 'GET /index.html HTTP/1.1\r\n'
-  // in the case of response it is: 'HTTP/1.1 200 OK\r\n'
-  var state = {
-    sentConnectionHeader: false,
-    sentContentLengthHeader: false,
-    sentTransferEncodingHeader: false,
-    sentDateHeader: false,
-    sentExpect: false,
-    messageHeader: firstLine
-  };
-
-  var field, value;
-
-  if (headers) {
-    var keys = Object.keys(headers);
-    var isArray = util.isArray(headers);
-    var field, value;
-
-    for (var i = 0, l = keys.length; i < l; i++) {
-      var key = keys[i];
-      if (isArray) {
-        field = headers[key][0];
-        value = headers[key][1];
-      } else {
-        field = key;
-        value = headers[key];
-      }
-
-      if (util.isArray(value)) {
-        for (var j = 0; j < value.length; j++) {
-          storeHeader(this, state, field, value[j]);
-        }
-      } else {
-        storeHeader(this, state, field, value);
-      }
-    }
-  }
-
-  // Date header
-  if (this.sendDate == true && state.sentDateHeader == false) {
-    state.messageHeader += 'Date: ' + utcDate() + CRLF;
-  }
+// firstLine in the case of request is: 'GET /index.html HTTP/1.1\r\n'
+// in the case of response it is the status code and reason is its reason
+// phrase.
+OutgoingMessage.prototype._storeHeader = function(firstLine, headers, reason) {
+  var flags = 0;
+  if (this.sendDate == true)
+    flags |= binding.kSendDate;
+  if (this.shouldKeepAlive)
+    flags |= binding.kShouldKeepAlive;
+  if (this.chunkedEncoding)
+    flags |= binding.kChunkedEncoding;
+  if (this.useChunkedEncodingByDefault)
+    flags |= binding.kUseChunkedEncodingByDefault;
+  if (this.agent)
+    flags |= binding.kHasAgent;
+  if (this._removedHeader.connection)
+    flags |= binding.kRemovedConnection;
+  if (this._removedHeader['transfer-encoding'])
+    flags |= binding.kRemovedTransferEncoding;
+  if (this._hasBody)
+    flags |= binding.kHasBody;
 
   // Force the connection to close when the response is a 204 No Content or
   // a 304 Not Modified and the user has set a "Transfer-Encoding: chunked"
@@ -244,83 +201,27 @@ OutgoingMessage.prototype._storeHeader = function(firstLine, headers) {
   // of creating security liabilities, so suppress the zero chunk and force
   // the connection to close.
   var statusCode = this.statusCode;
-  if ((statusCode == 204 || statusCode === 304) &&
-      this.chunkedEncoding === true) {
+  if (statusCode == 204 || statusCode === 304)
+    flags |= binding.kNoBodyStatus;
+
+  this._header = serializeHeaders(firstLine, reason, headers, flags);
+  this._headerSent = false;
+
+  flags = outgoingState[0];
+  if (flags & binding.kForcedClose) {
     debug(statusCode + ' response should not use chunked encoding,' +
           ' closing connection.');
-    this.chunkedEncoding = false;
-    this.shouldKeepAlive = false;
   }
-
-  // keep-alive logic
-  if (this._removedHeader.connection) {
+  if (flags & binding.kLast)
     this._last = true;
-    this.shouldKeepAlive = false;
-  } else if (state.sentConnectionHeader === false) {
-    var shouldSendKeepAlive = this.shouldKeepAlive &&
-        (state.sentContentLengthHeader ||
-         this.useChunkedEncodingByDefault ||
-         this.agent);
-    if (shouldSendKeepAlive) {
-      state.messageHeader += 'Connection: keep-alive\r\n';
-    } else {
-      this._last = true;
-      state.messageHeader += 'Connection: close\r\n';
-    }
-  }
-
-  if (state.sentContentLengthHeader == false &&
-      state.sentTransferEncodingHeader == false) {
-    if (this._hasBody && !this._removedHeader['transfer-encoding']) {
-      if (this.useChunkedEncodingByDefault) {
-        state.messageHeader += 'Transfer-Encoding: chunked\r\n';
-        this.chunkedEncoding = true;
-      } else {
-        this._last = true;
-      }
-    } else {
-      // Make sure we don't end the 0\r\n\r\n at the end of the message.
-      this.chunkedEncoding = false;
-    }
-  }
-
-  this._header = state.messageHeader + CRLF;
-  this._headerSent = false;
+  this.shouldKeepAlive = !!(flags & binding.kShouldKeepAlive);
+  this.chunkedEncoding = !!(flags & binding.kChunkedEncoding);
 
   // wait until the first body chunk, or close(), is sent to flush,
   // UNLESS we're sending Expect: 100-continue.
-  if (state.sentExpect) this._send('');
+  if (flags & binding.kSentExpect) this._send('');
 };
 
-function storeHeader(self, state, field, value) {
-  // Protect against response splitting. The if statement is there to
-  // minimize the performance impact in the common case.
-  if (/[\r\n]/.test(value))
-    value = value.replace(/[\r\n]+[ \t]*/g, '');
-
-  state.messageHeader += field + ': ' + value + CRLF;
-
-  if (connectionExpression.test(field)) {
-    state.sentConnectionHeader = true;
-    if (closeExpression.test(value)) {
-      self._last = true;
-    } else {
-      self.shouldKeepAlive = true;
-    }
-
-  } else if (transferEncodingExpression.test(field)) {
-    state.sentTransferEncodingHeader = true;
-    if (chunkExpression.test(value)) self.chunkedEncoding = true;
-
-  } else if (contentLengthExpression.test(field)) {
-    state.sentContentLengthHeader = true;
-  } else if (dateExpression.test(field)) {
-    state.sentDateHeader = true;
-  } else if (expectExpression.test(field)) {
-    state.sentExpect = true;
-  }
-}
-
 
 OutgoingMessage.prototype.setHeader = function(name, value) {
   if (arguments.length < 2) {
@@ -23,6 +23,7 @@ var util = require('util');
 var net = require('net');
 var EventEmitter = require('events').EventEmitter;
 var HTTPParser = process.binding('http_parser').HTTPParser;
+var timers = require('timers');
 var assert = require('assert').ok;
 
 var common = require('_http_common');
@@ -33,6 +34,7 @@ var CRLF = common.CRLF;
 var continueExpression = common.continueExpression;
 var chunkExpression = common.chunkExpression;
 var httpSocketSetup = common.httpSocketSetup;
+var kOnExecute = common.kOnExecute;
 
 var OutgoingMessage = require('_http_outgoing').OutgoingMessage;
 
@@ -216,9 +218,6 @@ ServerResponse.prototype.writeHead = function(statusCode) {
     headers = obj;
   }
 
-  var statusLine = 'HTTP/1.1 ' + statusCode.toString() + ' ' +
-                   reasonPhrase + CRLF;
-
   if (statusCode === 204 || statusCode === 304 ||
       (100 <= statusCode && statusCode <= 199)) {
     // RFC 2616, 10.2.5:
@@ -240,7 +239,13 @@ ServerResponse.prototype.writeHead = function(statusCode) {
     this.shouldKeepAlive = false;
   }
 
-  this._storeHeader(statusLine, headers);
+  if (util.isNumber(statusCode)) {
+    this._storeHeader(statusCode, headers, reasonPhrase);
+  } else {
+    var statusLine = 'HTTP/1.1 ' + statusCode.toString() + ' ' +
+                     reasonPhrase + CRLF;
+    this._storeHeader(statusLine, headers);
+  }
 };
 
 ServerResponse.prototype.writeHeader = function() {
@@ -345,6 +350,18 @@ function connectionListener(socket) {
   socket.on('end', socketOnEnd);
   socket.on('data', socketOnData);
 
+  // Let the parser read from the handle directly when it can. The 'data'
+  // listener above then never fires, it's the fallback for TLS sockets and
+  // for sockets that somebody else is reading from too.
+  if (socket._handle &&
+      EventEmitter.listenerCount(socket, 'data') === 1 &&
+      EventEmitter.listenerCount(socket, 'readable') === 0 &&
+      parser.consume(socket._handle)) {
+    parser._consumed = true;
+    parser[kOnExecute] = onParserExecute;
+    socket.on = socket.addListener = socketOnWrap;
+  }
+
   // TODO(isaacs): Move all these functions out of here
   function socketOnError(e) {
     self.emit('clientError', e, this);
@@ -353,6 +370,18 @@ function connectionListener(socket) {
   function socketOnData(d) {
     debug('SERVER socketOnData %d', d.length);
     var ret = parser.execute(d);
+    onExecute(ret, d);
+  }
+
+  // Called after each read the parser consumed, in place of the socket's
+  // onread. `d` is only passed when the connection is upgraded.
+  function onParserExecute(ret, nread, d) {
+    socket.bytesRead += nread;
+    timers._unrefActive(socket);
+    onExecute(ret, d);
+  }
+
+  function onExecute(ret, d) {
     if (ret instanceof Error) {
       debug('parse error');
       socket.destroy(ret);
@@ -474,3 +503,24 @@ function connectionListener(socket) {
   }
 }
 exports._connectionListener = connectionListener;
+
+
+// Listening for 'data' or 'readable' on a socket whose handle is consumed
+// by the parser hands the reads back to the socket, so the listener sees
+// the request bytes like it always did.
+function socketOnWrap(ev, fn) {
+  var res = net.Socket.prototype.on.call(this, ev, fn);
+  var parser = this.parser;
+  if ((ev === 'data' || ev === 'readable') && parser && parser._consumed) {
+    parser.unconsume();
+    parser._consumed = false;
+    parser[kOnExecute] = null;
+    delete this.on;
+    delete this.addListener;
+    // the parser may have stopped the reads to hold off a pipelined
+    // request, leave the socket paused in that case.
+    if (this._handle && !this._handle.reading)
+      this.pause();
+  }
+  return res;
+}
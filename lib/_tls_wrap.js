@@ -151,6 +151,9 @@ function TLSSocket(socket, options) {
 util.inherits(TLSSocket, net.Socket);
 exports.TLSSocket = TLSSocket;
 
+// sendfile() would bypass the encryption layer.
+TLSSocket.prototype._sendFileSupported = false;
+
 TLSSocket.prototype._init = function() {
   assert(this._handle);
 
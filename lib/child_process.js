@@ -318,16 +318,34 @@ function handleMessage(target, message, handle) {
   target.emit(eventName, message, handle);
 }
 
-function setupChannel(target, channel) {
+// Binary channels exchange length-prefixed frames instead of lines of JSON:
+// a 32 bits big endian payload length, one type byte, then the payload.
+// Buffers are sent as-is, everything else is JSON encoded.
+var FRAME_HEADER_SIZE = 5;
+var FRAME_JSON = 0;
+var FRAME_BUFFER = 1;
+
+function frameHeader(type, size) {
+  var header = new Buffer(FRAME_HEADER_SIZE);
+  header.writeUInt32BE(size, 0, true);
+  header[4] = type;
+  return header;
+}
+
+function setupChannel(target, channel, serialization) {
   target._channel = channel;
   target._handleQueue = null;
 
+  var binary = serialization === 'binary';
   var decoder = new StringDecoder('utf8');
   var jsonBuffer = '';
   channel.buffering = false;
   channel.onread = function(nread, pool, recvHandle) {
     // TODO(bnoordhuis) Check that nread > 0.
-    if (pool) {
+    if (pool && binary) {
+      readFrames(pool, recvHandle);
+
+    } else if (pool) {
       jsonBuffer += decoder.write(pool);
 
       var i, start = 0;
@@ -359,6 +377,113 @@ function setupChannel(target, channel) {
     }
   };
 
+  // Incomplete frame data from previous reads. Nothing is copied until
+  // there is enough data to complete the frame.
+  var chunks = [];
+  var chunksLength = 0;
+  var needed = FRAME_HEADER_SIZE;
+  var pendingHandle;
+
+  function readFrames(pool, recvHandle) {
+    // The handle arrives with the first chunk of its NODE_HANDLE frame.
+    if (recvHandle)
+      pendingHandle = recvHandle;
+
+    var buf = pool;
+    if (chunksLength !== 0) {
+      chunks.push(pool);
+      chunksLength += pool.length;
+      if (chunksLength < needed) return;
+      buf = Buffer.concat(chunks, chunksLength);
+      chunks = [];
+      chunksLength = 0;
+    }
+
+    var offset = 0;
+    while (buf.length - offset >= FRAME_HEADER_SIZE) {
+      var end = offset + FRAME_HEADER_SIZE + buf.readUInt32BE(offset, true);
+      if (end > buf.length) break;
+
+      var type = buf[offset + 4];
+      var payload = buf.slice(offset + FRAME_HEADER_SIZE, end);
+      var message = payload;
+      if (type === FRAME_JSON)
+        message = JSON.parse(payload.toString('utf8'));
+      offset = end;
+
+      if (message && message.cmd === 'NODE_HANDLE') {
+        handleMessage(target, message, pendingHandle);
+        pendingHandle = undefined;
+      } else {
+        handleMessage(target, message, undefined);
+      }
+    }
+
+    needed = FRAME_HEADER_SIZE;
+    if (offset < buf.length) {
+      var rest = buf.slice(offset);
+      if (rest.length >= FRAME_HEADER_SIZE)
+        needed += rest.readUInt32BE(0, true);
+      chunks.push(rest);
+      chunksLength = rest.length;
+    }
+    channel.buffering = chunksLength !== 0;
+  }
+
+  // Frames that are waiting for the next tick. Small messages that are sent
+  // in one go are written out with a single writev().
+  var frames = [];
+  var framesLength = 0;
+
+  function queueFrame(message) {
+    if (frames.length === 0)
+      process.nextTick(onflush);
+
+    if (util.isBuffer(message)) {
+      frames.push(frameHeader(FRAME_BUFFER, message.length), 'buffer',
+                  message, 'buffer');
+      framesLength += FRAME_HEADER_SIZE + message.length;
+    } else {
+      var string = JSON.stringify(message);
+      var size = Buffer.byteLength(string, 'utf8');
+      frames.push(frameHeader(FRAME_JSON, size), 'buffer', string, 'utf8');
+      framesLength += FRAME_HEADER_SIZE + size;
+    }
+  }
+
+  function onflush() {
+    var err = flushFrames();
+    if (err) target.emit('error', errnoException(err, 'write'));
+  }
+
+  function flushFrames() {
+    if (frames.length === 0)
+      return 0;
+    var req = { oncomplete: nop };
+    var err = channel.writev(req, frames);
+    if (err === 0) req._chunks = frames;  // Keep the buffers alive.
+    frames = [];
+    framesLength = 0;
+    return err;
+  }
+
+  // A NODE_HANDLE frame is written on its own so the handle can't end up
+  // with the chunk of an earlier message on the receiving end.
+  function writeHandleFrame(req, message, handle) {
+    var err = flushFrames();
+    if (err) return err;
+    var string = JSON.stringify(message);
+    var size = Buffer.byteLength(string, 'utf8');
+    var buf = new Buffer(FRAME_HEADER_SIZE + size);
+    frameHeader(FRAME_JSON, size).copy(buf);
+    buf.write(string, FRAME_HEADER_SIZE, size, 'utf8');
+    req.buffer = buf;  // Keep reference alive.
+    return channel.writeBuffer(req, buf, handle);
+  }
+
+  if (binary && target === process)
+    process.on('exit', flushFrames);
+
   // object where socket lists will live
   channel.sockets = { got: {}, send: {} };
 
@@ -450,8 +575,15 @@ function setupChannel(target, channel) {
     }
 
     var req = { oncomplete: nop };
-    var string = JSON.stringify(message) + '\n';
-    var err = channel.writeUtf8String(req, string, handle);
+    var err = 0;
+    if (!binary) {
+      var string = JSON.stringify(message) + '\n';
+      err = channel.writeUtf8String(req, string, handle);
+    } else if (handle) {
+      err = writeHandleFrame(req, message, handle);
+    } else {
+      queueFrame(message);
+    }
 
     if (err) {
       this.emit('error', errnoException(err, 'write'));
@@ -464,7 +596,7 @@ function setupChannel(target, channel) {
     }
 
     /* If the master is > 2 read() calls behind, please stop sending. */
-    return channel.writeQueueSize < (65536 * 2);
+    return channel.writeQueueSize + framesLength < (65536 * 2);
   };
 
   target.connected = true;
@@ -475,6 +607,8 @@ function setupChannel(target, channel) {
     }
 
     // do not allow messages to be written
+    var err = flushFrames();
+    if (err) this.emit('error', errnoException(err, 'write'));
     this.connected = false;
     this._channel = null;
 
@@ -531,12 +665,12 @@ exports.fork = function(modulePath /*, args, options*/) {
 };
 
 
-exports._forkChild = function(fd) {
+exports._forkChild = function(fd, serialization) {
   // set process.send()
   var p = createPipe(true);
   p.open(fd);
   p.unref();
-  setupChannel(process, p);
+  setupChannel(process, p, serialization);
 
   var refs = 0;
   process.on('newListener', function(name) {
@@ -721,6 +855,7 @@ var spawn = exports.spawn = function(file, args, options) {
     detached: !!(options && options.detached),
     envPairs: envPairs,
     stdio: options ? options.stdio : null,
+    serialization: options ? options.serialization : null,
     uid: options ? options.uid : null,
     gid: options ? options.gid : null
   });
@@ -832,7 +967,13 @@ ChildProcess.prototype.spawn = function(options) {
       ipc,
       ipcFd,
       // If no `stdio` option was given - use default
-      stdio = options.stdio || 'pipe';
+      stdio = options.stdio || 'pipe',
+      serialization = options.serialization || 'json';
+
+  if (serialization !== 'json' && serialization !== 'binary') {
+    throw new TypeError('Incorrect value of serialization option: ' +
+                        serialization);
+  }
 
   // Replace shortcut with an array
   if (util.isString(stdio)) {
@@ -911,6 +1052,8 @@ ChildProcess.prototype.spawn = function(options) {
     // Let child process know about opened IPC channel
     options.envPairs = options.envPairs || [];
     options.envPairs.push('NODE_CHANNEL_FD=' + ipcFd);
+    if (serialization === 'binary')
+      options.envPairs.push('NODE_CHANNEL_SERIALIZATION=binary');
   }
 
   var err = this._handle.spawn(options);
@@ -964,7 +1107,7 @@ ChildProcess.prototype.spawn = function(options) {
   });
 
   // Add .send() method and start listening for IPC data
-  if (!util.isUndefined(ipc)) setupChannel(this, ipc);
+  if (!util.isUndefined(ipc)) setupChannel(this, ipc, serialization);
 
   return err;
 };
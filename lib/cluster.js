@@ -25,8 +25,10 @@ var dgram = require('dgram');
 var fork = require('child_process').fork;
 var net = require('net');
 var util = require('util');
+var uv = process.binding('uv');
 var SCHED_NONE = 1;
 var SCHED_RR = 2;
+var SCHED_REUSEPORT = 3;
 
 var cluster = new EventEmitter;
 module.exports = cluster;
@@ -90,6 +92,59 @@ SharedHandle.prototype.remove = function(worker) {
 };
 
 
+// SO_REUSEPORT. Every worker binds and listens on a socket of its own and
+// the kernel spreads incoming connections over them. The master holds on to
+// a bound but not listening socket. That reserves the port and makes sure
+// that listen(0) resolves to the same port in all workers. Sockets that are
+// not listening don't take part in the kernel's load balancing.
+function ReusePortHandle(key, address, port, addressType, backlog, fd) {
+  this.key = key;
+  this.workers = [];
+  this.handle = null;
+  this.sockname = null;
+  this.errno = 0;
+
+  var rval = net._createServerHandle(address, port, addressType, fd, true);
+  if (util.isNumber(rval)) {
+    this.errno = rval;
+    return;
+  }
+
+  // bind() reports EADDRINUSE when listen() is called, which we don't do.
+  // A socket that failed to bind is unbound, look at the port instead.
+  var out = {};
+  this.errno = rval.getsockname(out);
+  if (this.errno === 0 && port > 0 && out.port !== port)
+    this.errno = uv.UV_EADDRINUSE;
+  if (this.errno === 0) {
+    this.handle = rval;
+    this.sockname = out;
+  } else {
+    rval.close();
+  }
+}
+
+ReusePortHandle.prototype.add = function(worker, send) {
+  assert(this.workers.indexOf(worker) === -1);
+  this.workers.push(worker);
+  send(this.errno, { reuseport: true, sockname: this.sockname }, null);
+};
+
+ReusePortHandle.prototype.remove = SharedHandle.prototype.remove;
+
+// Probes once whether the kernel lets multiple TCP sockets listen on the
+// same port. Linux didn't until 3.9, the setsockopt() call fails there.
+var reusePortSupported;
+ReusePortHandle.isSupported = function() {
+  if (util.isUndefined(reusePortSupported)) {
+    var rval = net._createServerHandle('127.0.0.1', 0, 4, undefined, true);
+    reusePortSupported = !util.isNumber(rval);
+    if (reusePortSupported) rval.close();
+  }
+  return reusePortSupported;
+};
+
+
 // Start a round-robin server. Master accepts connections and distributes
 // them over the workers.
 function RoundRobinHandle(key, address, port, addressType, backlog, fd) {
@@ -225,7 +280,8 @@ function masterInit() {
   // XXX(bnoordhuis) Fold cluster.schedulingPolicy into cluster.settings?
   var schedulingPolicy = {
     'none': SCHED_NONE,
-    'rr': SCHED_RR
+    'rr': SCHED_RR,
+    'reuseport': SCHED_REUSEPORT
   }[process.env.NODE_CLUSTER_SCHED_POLICY];
 
   if (util.isUndefined(schedulingPolicy)) {
@@ -237,6 +293,7 @@ function masterInit() {
   cluster.schedulingPolicy = schedulingPolicy;
   cluster.SCHED_NONE = SCHED_NONE;  // Leave it to the operating system.
   cluster.SCHED_RR = SCHED_RR;      // Master distributes connections.
+  cluster.SCHED_REUSEPORT = SCHED_REUSEPORT;  // Kernel balances listeners.
 
   // Keyed on address:port:etc. When a worker dies, we walk over the handles
   // and remove() the worker from each one. remove() may do a linear scan
@@ -258,7 +315,9 @@ function masterInit() {
       settings.execArgv = settings.execArgv.concat(['--logfile=v8-%p.log']);
     }
     schedulingPolicy = cluster.schedulingPolicy;  // Freeze policy.
-    assert(schedulingPolicy === SCHED_NONE || schedulingPolicy === SCHED_RR,
+    assert(schedulingPolicy === SCHED_NONE ||
+           schedulingPolicy === SCHED_RR ||
+           schedulingPolicy === SCHED_REUSEPORT,
            'Bad cluster.schedulingPolicy: ' + schedulingPolicy);
     cluster.settings = settings;
 
@@ -283,6 +342,7 @@ function masterInit() {
     worker.process = fork(settings.exec, settings.args, {
       env: workerEnv,
       silent: settings.silent,
+      serialization: settings.serialization,
       execArgv: createWorkerExecArgv(settings.execArgv, worker)
     });
     worker.process.once('exit', function(exitCode, signalCode) {
@@ -376,10 +436,17 @@ function masterInit() {
       // UDP is exempt from round-robin connection balancing for what should
       // be obvious reasons: it's connectionless. There is nothing to send to
       // the workers except raw datagrams and that's pointless.
-      if (schedulingPolicy !== SCHED_RR ||
-          message.addressType === 'udp4' ||
+      if (message.addressType === 'udp4' ||
           message.addressType === 'udp6') {
         constructor = SharedHandle;
+      } else if (schedulingPolicy === SCHED_NONE) {
+        constructor = SharedHandle;
+      } else if (schedulingPolicy === SCHED_REUSEPORT &&
+                 message.addressType !== -1 &&  // Not a UNIX socket.
+                 !(message.fd >= 0) &&
+                 ReusePortHandle.isSupported()) {
+        // Falls back to round-robin where the kernel can't do it.
+        constructor = ReusePortHandle;
       }
       handles[key] = handle = new constructor(key,
                                               message.address,
@@ -466,6 +533,8 @@ function workerInit() {
 
       if (handle)
         shared(reply, handle, cb);  // Shared listen socket.
+      else if (reply.reuseport)
+        reuseport(reply, address, addressType, cb);  // SO_REUSEPORT.
       else
         rr(reply, cb);              // Round-robin.
     });
@@ -493,6 +562,20 @@ function workerInit() {
     cb(message.errno, handle);
   }
 
+  // SO_REUSEPORT. Bind our own listen socket to the port the master reserved.
+  function reuseport(message, address, addressType, cb) {
+    if (message.errno)
+      return cb(message.errno, null);
+
+    var port = message.sockname.port;
+    var handle = net._createServerHandle(address, port, addressType,
+                                         undefined, true);
+    if (util.isNumber(handle))
+      return cb(handle, null);
+
+    shared(message, handle, cb);
+  }
+
   // Round-robin. Master distributes handles across workers.
   function rr(message, cb) {
     if (message.errno)
@@ -52,6 +52,18 @@ function toBuf(str, encoding) {
 }
 
 
+// Wraps a callback that gets a buffer so it gets a string in `encoding`.
+function encodeResult(encoding, callback) {
+  if (!encoding || encoding === 'buffer')
+    return callback;
+  return function(err, ret) {
+    if (ret)
+      ret = ret.toString(encoding);
+    callback(err, ret);
+  };
+}
+
+
 var assert = require('assert');
 var StringDecoder = require('string_decoder').StringDecoder;
 
@@ -382,8 +394,18 @@ Sign.prototype._write = function(chunk, encoding, callback) {
 
 Sign.prototype.update = Hash.prototype.update;
 
-Sign.prototype.sign = function(key, encoding) {
+Sign.prototype.sign = function(key, encoding, callback) {
+  if (util.isFunction(encoding)) {
+    callback = encoding;
+    encoding = null;
+  }
   encoding = encoding || exports.DEFAULT_ENCODING;
+
+  if (callback) {
+    this._binding.sign(toBuf(key), encodeResult(encoding, callback));
+    return;
+  }
+
   var ret = this._binding.sign(toBuf(key));
 
   if (encoding && encoding !== 'buffer')
@@ -410,8 +432,20 @@ util.inherits(Verify, stream.Writable);
 Verify.prototype._write = Sign.prototype._write;
 Verify.prototype.update = Sign.prototype.update;
 
-Verify.prototype.verify = function(object, signature, sigEncoding) {
+Verify.prototype.verify = function(object, signature, sigEncoding, callback) {
+  if (util.isFunction(sigEncoding)) {
+    callback = sigEncoding;
+    sigEncoding = null;
+  }
   sigEncoding = sigEncoding || exports.DEFAULT_ENCODING;
+
+  if (callback) {
+    this._binding.verify(toBuf(object),
+                         toBuf(signature, sigEncoding),
+                         callback);
+    return;
+  }
+
   return this._binding.verify(toBuf(object), toBuf(signature, sigEncoding));
 };
 
@@ -448,9 +482,19 @@ DiffieHellmanGroup.prototype.generateKeys =
     DiffieHellman.prototype.generateKeys =
     dhGenerateKeys;
 
-function dhGenerateKeys(encoding) {
-  var keys = this._binding.generateKeys();
+function dhGenerateKeys(encoding, callback) {
+  if (util.isFunction(encoding)) {
+    callback = encoding;
+    encoding = null;
+  }
   encoding = encoding || exports.DEFAULT_ENCODING;
+
+  if (callback) {
+    this._binding.generateKeys(encodeResult(encoding, callback));
+    return;
+  }
+
+  var keys = this._binding.generateKeys();
   if (encoding && encoding !== 'buffer')
     keys = keys.toString(encoding);
   return keys;
@@ -461,9 +505,23 @@ DiffieHellmanGroup.prototype.computeSecret =
     DiffieHellman.prototype.computeSecret =
     dhComputeSecret;
 
-function dhComputeSecret(key, inEnc, outEnc) {
+function dhComputeSecret(key, inEnc, outEnc, callback) {
+  if (util.isFunction(inEnc)) {
+    callback = inEnc;
+    inEnc = outEnc = null;
+  } else if (util.isFunction(outEnc)) {
+    callback = outEnc;
+    outEnc = null;
+  }
   inEnc = inEnc || exports.DEFAULT_ENCODING;
   outEnc = outEnc || exports.DEFAULT_ENCODING;
+
+  if (callback) {
+    this._binding.computeSecret(toBuf(key, inEnc),
+                                encodeResult(outEnc, callback));
+    return;
+  }
+
   var ret = this._binding.computeSecret(toBuf(key, inEnc));
   if (outEnc && outEnc !== 'buffer')
     ret = ret.toString(outEnc);
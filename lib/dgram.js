@@ -65,6 +65,7 @@ function newHandle(type) {
     handle.lookup = lookup6;
     handle.bind = handle.bind6;
     handle.send = handle.send6;
+    handle.sendBatch = handle.sendBatch6;
     return handle;
   }
 
@@ -119,6 +120,9 @@ exports.createSocket = function(type, listener) {
 
 function startListening(socket) {
   socket._handle.onmessage = onMessage;
+  socket._handle.onmessages = onMessages;
+  if (socket._recvBatch)
+    socket._handle.setRecvBatch(socket._recvBatch);
   // Todo: handle errors
   socket._handle.recvStart();
   socket._receiving = true;
@@ -134,6 +138,7 @@ function replaceHandle(self, newHandle) {
   newHandle.lookup = self._handle.lookup;
   newHandle.bind = self._handle.bind;
   newHandle.send = self._handle.send;
+  newHandle.sendBatch = self._handle.sendBatch;
   newHandle.owner = self;
 
   // Replace the existing handle by the handle we got from master.
@@ -320,6 +325,147 @@ function afterSend(err) {
 }
 
 
+// sendBatch(messages, [callback]) where messages is an array of
+// { buffer, port, address } objects, or
+// sendBatch(buffers, port, [address], [callback]) to send several datagrams to
+// the same destination.
+Socket.prototype.sendBatch = function(messages, port, address, callback) {
+  var self = this;
+
+  if (!util.isArray(messages))
+    throw new TypeError('First argument must be an array.');
+
+  if (util.isFunction(port)) {
+    callback = port;
+    port = undefined;
+  } else if (util.isFunction(address)) {
+    callback = address;
+    address = undefined;
+  }
+
+  // Like send(), no address means this host. Grouping by address below
+  // mustn't turn it into a host called "undefined".
+  var defaultAddress = self.type === 'udp6' ? '::0' : '0.0.0.0';
+
+  var buffers = new Array(messages.length);
+  var ports = new Array(messages.length);
+  var addresses = new Array(messages.length);
+
+  for (var i = 0; i < messages.length; i++) {
+    var message = messages[i];
+    var buffer = message;
+
+    if (!util.isBuffer(message)) {
+      if (!util.isObject(message))
+        throw new TypeError('Messages must be buffers or objects.');
+      buffer = message.buffer;
+      ports[i] = message.port | 0;
+      addresses[i] = message.address || defaultAddress;
+    } else {
+      ports[i] = port | 0;
+      addresses[i] = address || defaultAddress;
+    }
+
+    if (!util.isBuffer(buffer))
+      throw new TypeError('Message ' + i + ' is not a buffer.');
+
+    if (ports[i] <= 0 || ports[i] > 65535)
+      throw new RangeError('Port should be > 0 and < 65536');
+
+    buffers[i] = buffer;
+  }
+
+  if (!util.isFunction(callback))
+    callback = undefined;
+
+  self._healthCheck();
+
+  if (buffers.length === 0) {
+    if (callback)
+      process.nextTick(function() { callback(null); });
+    return;
+  }
+
+  if (self._bindState == BIND_STATE_UNBOUND)
+    self.bind(0, null);
+
+  if (self._bindState != BIND_STATE_BOUND) {
+    self.once('listening', function() {
+      self.sendBatch(messages, port, address, callback);
+    });
+    return;
+  }
+
+  // Resolve every distinct address once.
+  var ips = {};
+  var pending = 0;
+
+  for (var i = 0; i < addresses.length; i++) {
+    var host = addresses[i];
+    if (ips.hasOwnProperty(host))
+      continue;
+    ips[host] = null;
+    pending++;
+  }
+
+  Object.keys(ips).forEach(function(host) {
+    self._handle.lookup(host, function(ex, ip) {
+      if (pending === 0)
+        return;  // An earlier lookup failed.
+
+      if (ex) {
+        pending = 0;
+        if (callback) callback(ex);
+        self.emit('error', ex);
+        return;
+      }
+
+      ips[host] = ip;
+      if (--pending === 0)
+        doSendBatch(self, buffers, ports, addresses, ips, callback);
+    });
+  });
+};
+
+
+function doSendBatch(self, buffers, ports, addresses, ips, callback) {
+  if (!self._handle)
+    return;
+
+  for (var i = 0; i < addresses.length; i++)
+    addresses[i] = ips[addresses[i]];
+
+  var req = { buffers: buffers };  // Keep references alive.
+  if (callback) {
+    req.callback = callback;
+    req.oncomplete = afterSend;
+  }
+
+  var err = self._handle.sendBatch(req, buffers, ports, addresses, !!callback);
+  if (err && callback) {
+    process.nextTick(function() {
+      callback(errnoException(err, 'send'));
+    });
+  }
+}
+
+
+// Read up to `count` datagrams per system call and deliver them to JS land in
+// one go. A no-op on platforms that can't do batched reads.
+Socket.prototype.setRecvBatch = function(count) {
+  if (!util.isNumber(count))
+    throw new TypeError('Argument must be a number');
+
+  this._healthCheck();
+
+  var err = this._handle.setRecvBatch(count);
+  if (err)
+    throw errnoException(err, 'setRecvBatch');
+
+  this._recvBatch = count;
+};
+
+
 Socket.prototype.close = function() {
   this._healthCheck();
   this._stopReceiving();
@@ -444,6 +590,18 @@ function onMessage(nread, handle, buf, rinfo) {
 }
 
 
+function onMessages(handle, buf, rinfos) {
+  var self = handle.owner;
+  var offset = 0;
+  for (var i = 0; i < rinfos.length && self._handle; i++) {
+    var rinfo = rinfos[i];
+    var end = offset + rinfo.size;
+    self.emit('message', buf.slice(offset, end), rinfo);
+    offset = end;
+  }
+}
+
+
 Socket.prototype.ref = function() {
   if (this._handle)
     this._handle.ref();
@@ -78,18 +78,133 @@ function makeAsync(callback) {
 }
 
 
-function onlookup(err, addresses) {
-  if (err) {
-    return this.callback(errnoException(err, 'getaddrinfo'));
+// Results of lookup(), and of resolve4() and resolve6(), are kept for a
+// while when a cache TTL is set with dns.setCacheOptions(). Lookups of a
+// name that is already being looked up wait for that query instead of
+// taking another thread pool thread, whether or not caching is on.
+var cacheOptions = {
+  ttl: 0,
+  negativeTtl: 0,
+  maxEntries: 1000
+};
+var cache = {};
+var cacheSize = 0;
+var pending = {};
+var stats = {
+  hits: 0,
+  misses: 0,
+  coalesced: 0
+};
+
+// The loop's time in milliseconds, the same clock the timers use.
+var loopTime = process.binding('timer_wrap').Timer.loopTime;
+
+
+function cacheGet(key) {
+  var entry = cache[key];
+  if (!entry)
+    return null;
+  if (entry.expires <= loopTime[0]) {
+    delete cache[key];
+    cacheSize--;
+    return null;
   }
-  if (this.family) {
-    this.callback(null, addresses[0], this.family);
-  } else {
-    this.callback(null, addresses[0], addresses[0].indexOf(':') >= 0 ? 6 : 4);
+  return entry;
+}
+
+
+function cacheSet(key, err, result, extra, ttl) {
+  if (!(ttl > 0) || cacheOptions.maxEntries < 1)
+    return;
+  if (!cache[key]) {
+    // Keys come back in insertion order, the first one is the oldest.
+    while (cacheSize >= cacheOptions.maxEntries) {
+      for (var oldest in cache) break;
+      delete cache[oldest];
+      cacheSize--;
+    }
+    cacheSize++;
+  }
+  cache[key] = {
+    err: err,
+    result: result,
+    extra: extra,
+    expires: loopTime[0] + ttl
+  };
+}
+
+
+function isNotFound(err) {
+  return err === uv.UV_EAI_NODATA || err === uv.UV_EAI_NONAME;
+}
+
+
+// Every waiter is called in the domain it was in when it called lookup(),
+// or in none, not in the one of the lookup that made the query. It gets its
+// own error object, and one that throws doesn't keep the others from
+// getting their answer.
+function callWaiters(waiters, start, err, address, family) {
+  // Leave the domains MakeCallback() entered, for now.
+  var entered = [];
+  while (process.domain && !process.domain._disposed &&
+         entered.indexOf(process.domain) === -1) {
+    entered.push(process.domain);
+    process.domain.exit();
+  }
+
+  var i = start;
+  var threw = true;
+  try {
+    for (; i < waiters.length; i++) {
+      var waiter = waiters[i];
+      var domain = waiter.domain;
+      if (domain) {
+        if (domain._disposed) continue;
+        domain.enter();
+      }
+      waiter.callback.apply(null, lookupResult(err, address, family));
+      if (domain) domain.exit();
+    }
+    threw = false;
+  } finally {
+    if (threw) {
+      // The domain stack is left for process._fatalException() to sort out.
+      if (i + 1 < waiters.length) {
+        process.nextTick(function() {
+          callWaiters(waiters, i + 1, err, address, family);
+        });
+      }
+    } else {
+      while (entered.length > 0)
+        entered.pop().enter();
+    }
   }
 }
 
 
+function lookupResult(err, address, family) {
+  if (err)
+    return [errnoException(err, 'getaddrinfo')];
+  if (!family)
+    family = address.indexOf(':') >= 0 ? 6 : 4;
+  return [null, address, family];
+}
+
+
+function onlookup(err, addresses) {
+  var address = err ? null : addresses[0];
+  if (!err)
+    cacheSet(this.key, 0, address, this.family, cacheOptions.ttl);
+  else if (isNotFound(err))
+    cacheSet(this.key, err, null, 0, cacheOptions.negativeTtl);
+
+  var waiters = pending[this.key];
+  delete pending[this.key];
+  waiters.unshift({ callback: this.callback, domain: this.domain });
+  callWaiters(waiters, 0, err, address, this.family);
+}
+
+
 // Easy DNS A/AAAA look up
 // lookup(domain, [family,] callback)
 exports.lookup = function(domain, family, callback) {
@@ -127,20 +242,84 @@ exports.lookup = function(domain, family, callback) {
     return {};
   }
 
+  var key = family + ':' + domain;
+  var entry = cacheGet(key);
+  if (entry) {
+    stats.hits++;
+    callback.apply(null, lookupResult(entry.err, entry.result, entry.extra));
+    return {};
+  }
+
+  var waiters = pending[key];
+  if (waiters) {
+    stats.coalesced++;
+    waiters.push({ callback: callback, domain: process.domain });
+    callback.immediately = true;
+    return {};
+  }
+
+  stats.misses++;
   var req = {
     callback: callback,
+    domain: process.domain,
     family: family,
+    key: key,
     oncomplete: onlookup
   };
   var err = cares.getaddrinfo(req, domain, family);
   if (err) throw errnoException(err, 'getaddrinfo');
+  pending[key] = [];
 
   callback.immediately = true;
   return req;
 };
 
 
-function onresolve(err, result) {
+// Sets how long results are cached, in milliseconds. `ttl` applies to
+// addresses found by lookup(), and is the longest resolve4() and resolve6()
+// results are kept; they're dropped sooner when their records' TTL is
+// shorter. `negativeTtl` is for names that don't exist. Zero turns caching
+// off, which is the default.
+exports.setCacheOptions = function(options) {
+  ['ttl', 'negativeTtl', 'maxEntries'].forEach(function(name) {
+    if (util.isUndefined(options[name]))
+      return;
+    var value = options[name];
+    if (!util.isNumber(value) || !(value >= 0))
+      throw new TypeError('`' + name + '` must be a non-negative number');
+    cacheOptions[name] = value;
+  });
+  if (cacheOptions.ttl === 0 && cacheOptions.negativeTtl === 0)
+    exports.clearCache();
+};
+
+
+exports.clearCache = function() {
+  cache = {};
+  cacheSize = 0;
+};
+
+
+exports.getCacheStats = function() {
+  return {
+    hits: stats.hits,
+    misses: stats.misses,
+    coalesced: stats.coalesced,
+    entries: cacheSize
+  };
+};
+
+
+function onresolve(err, result, ttl) {
+  if (this.cacheKey) {
+    if (err) {
+      if (err === cares.ARES_ENOTFOUND || err === cares.ARES_ENODATA)
+        cacheSet(this.cacheKey, err, null, 0, cacheOptions.negativeTtl);
+    } else {
+      ttl = Math.min(ttl * 1000, cacheOptions.ttl);
+      cacheSet(this.cacheKey, 0, result.slice(), 0, ttl);
+    }
+  }
   if (err)
     this.callback(errnoException(err, this.bindingName));
   else
@@ -148,14 +327,30 @@ function onresolve(err, result) {
 }
 
 
-function resolver(bindingName) {
+function resolver(bindingName, cacheable) {
   var binding = cares[bindingName];
 
   return function query(name, callback) {
     callback = makeAsync(callback);
+
+    var cacheKey = cacheable ? bindingName + ':' + name : null;
+    if (cacheKey) {
+      var entry = cacheGet(cacheKey);
+      if (entry) {
+        stats.hits++;
+        if (entry.err)
+          callback(errnoException(entry.err, bindingName));
+        else
+          callback(null, entry.result.slice());
+        return {};
+      }
+      stats.misses++;
+    }
+
     var req = {
       bindingName: bindingName,
       callback: callback,
+      cacheKey: cacheKey,
       oncomplete: onresolve
     };
     var err = binding(req, name);
@@ -167,8 +362,8 @@ function resolver(bindingName) {
 
 
 var resolveMap = {};
-exports.resolve4 = resolveMap.A = resolver('queryA');
-exports.resolve6 = resolveMap.AAAA = resolver('queryAaaa');
+exports.resolve4 = resolveMap.A = resolver('queryA', true);
+exports.resolve6 = resolveMap.AAAA = resolver('queryAaaa', true);
 exports.resolveCname = resolveMap.CNAME = resolver('queryCname');
 exports.resolveMx = resolveMap.MX = resolver('queryMx');
 exports.resolveNs = resolveMap.NS = resolver('queryNs');
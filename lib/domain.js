@@ -32,25 +32,24 @@ var endMethods = ['end', 'abort', 'destroy', 'destroySoon'];
 // a few side effects.
 events.usingDomains = true;
 
-// overwrite process.domain with a getter/setter that will allow for more
-// effective optimizations
-var _domain = [null];
-Object.defineProperty(process, 'domain', {
-  enumerable: true,
-  get: function() {
-    return _domain[0];
-  },
-  set: function(arg) {
-    return _domain[0] = arg;
-  }
-});
-
 // objects with external array data are excellent ways to communicate state
 // between js and c++ w/o much overhead
+// order is [stack depth, a domain was created]
 var _domain_flag = {};
 
+// MakeCallback() hands callbacks on objects that have a domain to this, so
+// entering and exiting doesn't take two more calls out of C++. A throw
+// leaves the domain entered, process._fatalException() deals with that.
+function callWithDomain(domain, object, callback, args) {
+  if (domain._disposed) return;
+  domain.enter();
+  var ret = callback.apply(object, args);
+  domain.exit();
+  return ret;
+}
+
 // let the process know we're using domains
-process._setupDomainUse(_domain, _domain_flag);
+process._setupDomainUse(_domain_flag, callWithDomain);
 
 exports.Domain = Domain;
 
@@ -72,6 +71,8 @@ function Domain() {
   EventEmitter.call(this);
 
   this.members = [];
+  // MakeCallback() can skip looking for domains until there is one.
+  _domain_flag[1] = 1;
 }
 
 Domain.prototype.enter = function() {
@@ -94,7 +95,8 @@ Domain.prototype.exit = function() {
   } while (d && d !== this);
   _domain_flag[0] = stack.length;
 
-  exports.active = stack[stack.length - 1];
+  // Not stack[-1], a negative index is a slow, dictionary style lookup.
+  exports.active = stack.length ? stack[stack.length - 1] : undefined;
   process.domain = exports.active;
 };
 
@@ -116,7 +116,93 @@ function nullCheck(path, callback) {
   return true;
 }
 
-fs.Stats = binding.Stats;
+// The layout of the numbers a stat call leaves in binding.statValues, and
+// statMany() returns for each path, see StatField in src/node_file.cc.
+var kStatError = 0;
+var kStatDev = 1;
+var kStatMode = 2;
+var kStatNlink = 3;
+var kStatUid = 4;
+var kStatGid = 5;
+var kStatRdev = 6;
+var kStatBlksize = 7;
+var kStatIno = 8;
+var kStatSize = 9;
+var kStatBlocks = 10;
+var kStatAtime = 11;
+var kStatMtime = 12;
+var kStatCtime = 13;
+var kStatFields = 14;
+
+// stat(), lstat() and fstat() results. The numbers are copied out of a
+// shared array, the Date objects are only made when they're first used.
+// Without one, new fs.Stats() is an empty object, like it always was.
+function Stats(fields, offset) {
+  if (!fields)
+    return;
+  var f = fields;
+  var o = offset || 0;
+  this.dev = f[o + kStatDev];
+  this.mode = f[o + kStatMode];
+  this.nlink = f[o + kStatNlink];
+  this.uid = f[o + kStatUid];
+  this.gid = f[o + kStatGid];
+  this.rdev = f[o + kStatRdev];
+  if (!isWindows)
+    this.blksize = f[o + kStatBlksize];
+  this.ino = f[o + kStatIno];
+  this.size = f[o + kStatSize];
+  if (!isWindows)
+    this.blocks = f[o + kStatBlocks];
+  this.atimeMs = f[o + kStatAtime];
+  this.mtimeMs = f[o + kStatMtime];
+  this.ctimeMs = f[o + kStatCtime];
+}
+fs.Stats = Stats;
+
+binding.FSInitialize(Stats);
+
+function defineDate(name) {
+  var ms = name + 'Ms';
+  Object.defineProperty(Stats.prototype, name, {
+    enumerable: true,
+    configurable: true,
+    get: function() {
+      if (util.isUndefined(this[ms]))
+        return undefined;  // An empty new fs.Stats().
+      var date = new Date(this[ms]);
+      Object.defineProperty(this, name, {
+        value: date,
+        writable: true,
+        enumerable: true,
+        configurable: true
+      });
+      return date;
+    },
+    set: function(value) {
+      Object.defineProperty(this, name, {
+        value: value,
+        writable: true,
+        enumerable: true,
+        configurable: true
+      });
+    }
+  });
+}
+defineDate('atime');
+defineDate('mtime');
+defineDate('ctime');
+
+// JSON.stringify() and util.inspect() only look at own properties, make
+// them see the dates too.
+Stats.prototype.toJSON = Stats.prototype.inspect = function() {
+  var obj = {};
+  for (var key in this) {
+    if (typeof this[key] !== 'function')
+      obj[key] = this[key];
+  }
+  return obj;
+};
 
 fs.Stats.prototype._checkModeProperty = function(property) {
   return ((this.mode & constants.S_IFMT) === property);
@@ -673,6 +759,184 @@ fs.statSync = function(path) {
   return binding.stat(pathModule._makeLong(path));
 };
 
+// Stats a list of paths with a single thread pool request. Paths that can't
+// be stat'ed don't fail the call, the result tells which ones failed.
+function statMany(paths, lstat, callback) {
+  var syscall = lstat ? 'lstat' : 'stat';
+  if (!util.isArray(paths))
+    throw new TypeError('paths must be an array');
+  var longPaths = new Array(paths.length);
+  for (var i = 0; i < paths.length; i++) {
+    if (!nullCheck(paths[i], callback)) return;
+    longPaths[i] = pathModule._makeLong(paths[i]);
+  }
+
+  if (!callback)
+    return new StatsList(paths, binding.statMany(longPaths, lstat), syscall);
+
+  var req = {
+    oncomplete: function(err, fields) {
+      if (err)
+        return callback(err);
+      callback(null, new StatsList(paths, fields, syscall));
+    }
+  };
+  binding.statMany(longPaths, lstat, req);
+}
+
+fs.statMany = function(paths, callback) {
+  statMany(paths, false, makeCallback(callback));
+};
+
+fs.lstatMany = function(paths, callback) {
+  statMany(paths, true, makeCallback(callback));
+};
+
+fs.statManySync = function(paths) {
+  return statMany(paths, false);
+};
+
+fs.lstatManySync = function(paths) {
+  return statMany(paths, true);
+};
+
+// The result of fs.statMany(). Everything stays in one array of numbers,
+// a fs.Stats object or an Error is only made for the paths that ask for it.
+function StatsList(paths, fields, syscall) {
+  this.paths = paths;
+  this.length = paths.length;
+  this._fields = fields;
+  this._syscall = syscall;
+}
+fs.StatsList = StatsList;
+
+StatsList.prototype.exists = function(i) {
+  return this._fields[i * kStatFields + kStatError] === 0;
+};
+
+StatsList.prototype.error = function(i) {
+  var err = this._fields[i * kStatFields + kStatError];
+  if (err === 0)
+    return null;
+  return binding.uvError(err, this._syscall, this.paths[i]);
+};
+
+StatsList.prototype.get = function(i) {
+  if (!this.exists(i))
+    return null;
+  return new Stats(this._fields, i * kStatFields);
+};
+
+StatsList.prototype._checkModeProperty = function(i, property) {
+  return this.exists(i) &&
+         (this._fields[i * kStatFields + kStatMode] & constants.S_IFMT) ===
+             property;
+};
+
+StatsList.prototype.isFile = function(i) {
+  return this._checkModeProperty(i, constants.S_IFREG);
+};
+
+StatsList.prototype.isDirectory = function(i) {
+  return this._checkModeProperty(i, constants.S_IFDIR);
+};
+
+StatsList.prototype.isSymbolicLink = function(i) {
+  return this._checkModeProperty(i, constants.S_IFLNK);
+};
+
+StatsList.prototype.size = function(i) {
+  return this.exists(i) ? this._fields[i * kStatFields + kStatSize] : NaN;
+};
+
+StatsList.prototype.mtime = function(i) {
+  return this.exists(i) ? this._fields[i * kStatFields + kStatMtime] : NaN;
+};
+
+var walkTypes = ['other', 'file', 'directory', 'symlink'];
+
+fs.walk = function(path, options) {
+  return new Walker(path, options);
+};
+
+// Walks a directory tree on the thread pool, depth first, directories
+// before what's in them. Every chunk is an array of entries, an entry is
+// { path, type, depth } where type is one of 'file', 'directory',
+// 'symlink' or 'other' and the entries of `path` itself have depth 1.
+// Symbolic links are reported, not followed.
+//
+// Options:
+//   depth       the deepest entries to go, Infinity by default
+//   types       the types of entries to report, all by default. Directories
+//               are walked whether they're reported or not.
+//   ignore      names of entries to skip, with everything below them
+//   extensions  only report files with one of these extensions
+//   batchSize   maximum number of entries in a chunk, 256 by default
+function Walker(path, options) {
+  if (!(this instanceof Walker))
+    return new Walker(path, options);
+
+  options = options || {};
+  Readable.call(this, { objectMode: true, highWaterMark: 4 });
+
+  nullCheck(path);
+
+  var depth = options.depth;
+  if (util.isUndefined(depth) || depth === Infinity)
+    depth = undefined;
+  else if (!util.isNumber(depth) || depth < 0)
+    throw new TypeError('depth must be a positive number');
+
+  var types = 0;
+  (options.types || walkTypes).forEach(function(type) {
+    var index = walkTypes.indexOf(type);
+    if (index === -1)
+      throw new TypeError('Unknown entry type: ' + type);
+    types |= 1 << index;
+  });
+
+  this.path = path;
+  this._batchSize = options.batchSize || 256;
+  this._handle = new binding.Walker(pathModule._makeLong(path),
+                                    depth,
+                                    types,
+                                    options.ignore,
+                                    options.extensions);
+  this._handle.onbatch = onbatch;
+  this._reading = false;
+
+  var self = this;
+  function onbatch(err, entries, done) {
+    self._reading = false;
+    if (err)
+      return self.emit('error', err);
+
+    if (entries.length > 0) {
+      var batch = new Array(entries.length / 3);
+      for (var i = 0; i < batch.length; i++) {
+        batch[i] = {
+          path: entries[i * 3],
+          type: walkTypes[entries[i * 3 + 1]],
+          depth: entries[i * 3 + 2]
+        };
+      }
+      self.push(batch);
+    }
+
+    if (done)
+      self.push(null);
+  }
+}
+util.inherits(Walker, Readable);
+fs.Walker = Walker;
+
+Walker.prototype._read = function() {
+  if (this._reading)
+    return;
+  this._reading = true;
+  this._handle.read(this._batchSize);
+};
+
 fs.readlink = function(path, callback) {
   callback = makeCallback(callback);
   if (!nullCheck(path, callback)) return;
@@ -1485,7 +1749,7 @@ ReadStream.prototype._read = function(n) {
       this._read(n);
     });
 
-  if (this.destroyed)
+  if (this.destroyed || this._sendFileDest)
     return;
 
   if (!pool || pool.length - pool.used < kMinPoolSpace) {
@@ -1535,6 +1799,159 @@ ReadStream.prototype._read = function(n) {
 };
 
 
+// Piping a file into a plain TCP socket doesn't need to go through JS land,
+// the socket can send it straight from the page cache with sendfile(2).
+// That only works as long as nobody else has started consuming the stream.
+function canSendFile(src, dest) {
+  var state = src._readableState;
+  return !src._sendFileDest &&
+         util.isFunction(dest._canSendFile) &&
+         dest._canSendFile() &&
+         state.pipesCount === 0 &&
+         !state.flowing &&
+         !state.reading &&
+         !state.decoder &&
+         state.length === 0 &&
+         EventEmitter.listenerCount(src, 'data') === 0 &&
+         // Without a start position, only a file we open ourselves has a
+         // known offset.
+         (!util.isUndefined(src.pos) || !util.isNumber(src.fd));
+}
+
+
+ReadStream.prototype.pipe = function(dest, options) {
+  if (!canSendFile(this, dest))
+    return Readable.prototype.pipe.call(this, dest, options);
+
+  var self = this;
+  var doEnd = !options || options.end !== false;
+  var req = null;
+  var aborted = false;
+  var offset;
+
+  this._sendFileDest = dest;
+
+  // Like Readable.prototype.pipe(): an error on the destination is thrown
+  // when there's nobody else to hear about it, and the destination going
+  // away or being unpiped stops the transfer.
+  function onerror(er) {
+    abort();
+    dest.removeListener('error', onerror);
+    if (EventEmitter.listenerCount(dest, 'error') === 0)
+      dest.emit('error', er);
+  }
+  dest.on('error', onerror);
+  dest.once('close', abort);
+  dest.on('unpipe', onunpipe);
+
+  function onunpipe(src) {
+    if (src === self)
+      abort();
+  }
+
+  function cleanup() {
+    dest.removeListener('error', onerror);
+    dest.removeListener('close', abort);
+    dest.removeListener('unpipe', onunpipe);
+  }
+
+  function abort() {
+    cleanup();
+    aborted = true;
+    if (req)
+      return dest._abortSendFile(req);
+    // Nothing was sent yet.
+    self._sendFileDest = null;
+    if (!dest.writable && self.autoClose)
+      self.destroy();
+  }
+
+  dest.emit('pipe', this);
+
+  if (util.isNumber(this.fd))
+    start();
+  else
+    this.once('open', start);
+
+  function start() {
+    if (self.destroyed || aborted)
+      return;
+
+    fs.fstat(self.fd, function(er, stat) {
+      if (aborted)
+        return;
+
+      if (er)
+        return onreaderror(er);
+
+      offset = util.isUndefined(self.pos) ? 0 : self.pos;
+      var end = util.isUndefined(self.end) ? stat.size :
+                                             Math.min(stat.size, self.end + 1);
+
+      var length = Math.max(end - offset, 0);
+      req = dest._sendFile(self.fd, offset, length, onsent);
+    });
+  }
+
+  function onsent(er, bytesSent) {
+    cleanup();
+    self._sendFileDest = null;
+
+    // Reads pick up where the transfer stopped.
+    self.pos = offset + bytesSent;
+    if (util.isUndefined(self.end))
+      self.end = Infinity;
+
+    if (req.aborted) {
+      // The destination went away. Unpiped, the file can still be read,
+      // starting with a read() that may have come in during the transfer.
+      if (!dest.writable) {
+        if (self.autoClose)
+          self.destroy();
+      } else if (self._readableState.reading) {
+        self._read(self._readableState.highWaterMark);
+      }
+      return;
+    }
+
+    // The destination went away, that's not an error on our side.
+    if (er && dest.destroyed) {
+      if (self.autoClose)
+        self.destroy();
+      return;
+    }
+
+    if (er)
+      return onreaderror(er);
+
+    self.push(null);
+    self.read(0);
+
+    if (doEnd)
+      dest.end();
+  }
+
+  function onreaderror(er) {
+    cleanup();
+    self._sendFileDest = null;
+    if (self.autoClose)
+      self.destroy();
+    self.emit('error', er);
+  }
+
+  return dest;
+};
+
+
+ReadStream.prototype.unpipe = function(dest) {
+  var target = this._sendFileDest;
+  if (!target || (dest && dest !== target))
+    return Readable.prototype.unpipe.call(this, dest);
+  target.emit('unpipe', this);
+  return this;
+};
+
+
 ReadStream.prototype.destroy = function() {
   if (this.destroyed)
     return;
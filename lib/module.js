@@ -81,10 +81,14 @@ var debug = Module._debug;
 //   -> a.<ext>
 //   -> a/index.<ext>
 
+// Most of the paths tried don't exist, statManySync() says so without
+// building and throwing an exception the way statSync() does. It still
+// throws for paths it won't look at, like ones with null bytes.
 function statPath(path) {
   var fs = NativeModule.require('fs');
   try {
-    return fs.statSync(path);
+    var stats = fs.statManySync([path]);
+    return stats.exists(0) && stats;
   } catch (ex) {}
   return false;
 }
@@ -134,7 +138,7 @@ Module._realpathCache = {};
 function tryFile(requestPath) {
   var fs = NativeModule.require('fs');
   var stats = statPath(requestPath);
-  if (stats && !stats.isDirectory()) {
+  if (stats && !stats.isDirectory(0)) {
     return fs.realpathSync(requestPath, Module._realpathCache);
   }
   return false;
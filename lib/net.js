@@ -28,6 +28,7 @@ var cares = process.binding('cares_wrap');
 var uv = process.binding('uv');
 
 var cluster;
+var FSBinding;  // lazily loaded
 var errnoException = util._errnoException;
 
 function noop() {}
@@ -453,10 +454,32 @@ Socket.prototype._destroy = function(exception, cb) {
     if (this !== process.stderr)
       debug('close handle');
     var isException = exception ? true : false;
-    this._handle.close(function() {
-      debug('emit close');
-      self.emit('close', isException);
-    });
+    var handle = this._handle;
+    var closeHandle = function() {
+      handle.close(function() {
+        debug('emit close');
+        self.emit('close', isException);
+      });
+    };
+    // A sendfile() on the thread pool is still using the file descriptor.
+    // Closing it now would let the kernel hand out the same number to another
+    // socket while the data is still on its way.
+    if (this._sendFileInFlight) {
+      // Until then it mustn't read either, libuv insists that a read error
+      // either closes the handle or stops reading.
+      handle.readStop();
+      this._afterSendFile = closeHandle;
+    } else {
+      closeHandle();
+      // A transfer waiting for a write won't hear back, afterWrite() drops
+      // callbacks of destroyed sockets.
+      var req = this._sendFileReq;
+      if (req) {
+        process.nextTick(function() {
+          finishSendFile(self, req, new Error('This socket is closed.'));
+        });
+      }
+    }
     this._handle.onread = noop;
     this._handle = null;
   }
@@ -618,6 +641,9 @@ Socket.prototype._writeGeneric = function(writev, data, encoding, cb) {
 
   timers._unrefActive(this);
 
+  if (!writev && data._sendFile)
+    return startSendFile(this, data._sendFile, cb);
+
   if (!this._handle) {
     this._destroy(new Error('This socket is closed.'), cb);
     return false;
@@ -665,14 +691,244 @@ Socket.prototype._writeGeneric = function(writev, data, encoding, cb) {
 
 
 Socket.prototype._writev = function(chunks, cb) {
+  for (var i = 0; i < chunks.length; i++) {
+    if (chunks[i].chunk._sendFile)
+      return writeInOrder(this, chunks, 0, cb);
+  }
   this._writeGeneric(true, chunks, '', cb);
 };
 
 
+// A file transfer among corked writes. One at a time, each waits for the
+// one before it.
+function writeInOrder(self, chunks, i, cb) {
+  if (i === chunks.length)
+    return cb();
+  var entry = chunks[i];
+  self._writeGeneric(false, entry.chunk, entry.encoding, function(err) {
+    if (err)
+      return cb(err);
+    writeInOrder(self, chunks, i + 1, cb);
+  });
+}
+
+
 Socket.prototype._write = function(data, encoding, cb) {
   this._writeGeneric(false, data, encoding, cb);
 };
 
+
+// Bytes per read() when sendfile() can't be used or the socket's send buffer
+// is full.
+var kSendFileCopySize = 16 * 1024;
+
+// sendfile() writes straight to the file descriptor. Subclasses that
+// transform outgoing data, like tls.TLSSocket, turn it off.
+Socket.prototype._sendFileSupported = true;
+
+function sendFileFd(socket) {
+  var handle = socket._handle;
+  if (!socket._sendFileSupported || !handle)
+    return -1;
+  if (!(handle instanceof process.binding('tcp_wrap').TCP))
+    return -1;
+  if (!util.isNumber(handle.fd))
+    return -1;  // Windows.
+  return handle.fd;
+}
+
+
+// Send `length` bytes from file descriptor `fd`, starting at `offset`. The
+// data goes from the page cache to the socket with sendfile(2) on the thread
+// pool, without being copied into JS land. It is queued like a write: data
+// written before is flushed first, and data written after, end() included,
+// waits until the file has been sent. Calls cb(err, bytesSent) once
+// everything has been handed to the operating system.
+Socket.prototype.sendFile = function(fd, offset, length, cb) {
+  if (!util.isNumber(fd) || fd < 0)
+    throw new TypeError('fd must be a file descriptor');
+  if (!util.isNumber(offset) || offset < 0)
+    throw new RangeError('offset should be >= 0');
+  if (!util.isNumber(length) || length < 0)
+    throw new RangeError('length should be >= 0');
+  if (!util.isFunction(cb))
+    cb = noop;
+
+  this._sendFile(fd, offset, length, cb);
+};
+
+
+// Returns the request, which _abortSendFile() takes.
+Socket.prototype._sendFile = function(fd, offset, length, cb) {
+  var req = {
+    fd: fd,
+    offset: offset,
+    remaining: length,
+    sent: 0,
+    cb: cb,
+    writeCb: null,
+    busy: false,
+    aborted: false,
+    done: false
+  };
+
+  if (!this.writable) {
+    var er = new Error('This socket is not writable.');
+    process.nextTick(function() {
+      finishSendFile(null, req, er);
+    });
+    return req;
+  }
+
+  // An empty buffer takes the transfer's place in the write queue,
+  // _writeGeneric() starts it once it's its turn.
+  var marker = new Buffer(0);
+  marker._sendFile = req;
+  this.write(marker);
+  return req;
+};
+
+
+// Stops a transfer. One that hasn't started won't, a running one stops
+// after the chunk it's working on. Either way its callback is called, with
+// the number of bytes that were sent.
+Socket.prototype._abortSendFile = function(req) {
+  req.aborted = true;
+  if (!req.busy)
+    finishSendFile(this, req, null);
+};
+
+
+function startSendFile(self, req, cb) {
+  if (req.done)
+    return cb();
+  req.writeCb = cb;
+  self._sendFileReq = req;
+  sendFileChunk(self, req);
+}
+
+
+function finishSendFile(self, req, err) {
+  if (req.done)
+    return;
+  req.done = true;
+  req.busy = false;
+  if (self && self._sendFileReq === req)
+    self._sendFileReq = null;
+
+  var writeCb = req.writeCb;
+  req.writeCb = null;
+  req.cb(err, req.sent);
+  // Let the writes queued behind the transfer go.
+  if (writeCb)
+    writeCb();
+}
+
+
+function advanceSendFile(self, req, n) {
+  req.offset += n;
+  req.remaining -= n;
+  req.sent += n;
+  sendFileChunk(self, req);
+}
+
+
+function sendFileChunk(self, req) {
+  if (req.aborted || req.remaining === 0)
+    return finishSendFile(self, req, null);
+
+  if (self.destroyed || !self._handle)
+    return finishSendFile(self, req, new Error('This socket is closed.'));
+
+  var out = sendFileFd(self);
+  if (out === -1)
+    return copyFileChunk(self, req);
+
+  if (!FSBinding)
+    FSBinding = process.binding('fs');
+
+  req.busy = true;
+  self._sendFileInFlight = true;
+  FSBinding.sendfile(out, req.fd, req.offset, req.remaining, function(err, n) {
+    req.busy = false;
+    self._sendFileInFlight = false;
+
+    if (self._afterSendFile) {
+      // Destroyed while sendfile() was running, close the handle now.
+      var closeHandle = self._afterSendFile;
+      self._afterSendFile = null;
+      closeHandle();
+      return finishSendFile(self, req, new Error('This socket is closed.'));
+    }
+
+    // The send buffer is full. Push the next bit through the regular write
+    // path, its completion tells us when the socket can take more data.
+    if (err && (err.code === 'EAGAIN' || err.code === 'EWOULDBLOCK'))
+      return copyFileChunk(self, req);
+
+    if (err) {
+      self._destroy(err);
+      return finishSendFile(self, req, err);
+    }
+
+    if (n === 0)  // EOF, the file is shorter than expected.
+      return finishSendFile(self, req, null);
+
+    timers._unrefActive(self);
+    self._bytesDispatched += n;
+    advanceSendFile(self, req, n);
+  });
+}
+
+
+function copyFileChunk(self, req) {
+  if (req.aborted)
+    return finishSendFile(self, req, null);
+
+  if (!FSBinding)
+    FSBinding = process.binding('fs');
+
+  var size = Math.min(req.remaining, kSendFileCopySize);
+  var buffer = new Buffer(size);
+
+  req.busy = true;
+  FSBinding.read(req.fd, buffer, 0, size, req.offset, function(err, n) {
+    if (req.done)
+      return;  // The socket was destroyed.
+    req.busy = false;
+
+    if (err)
+      return finishSendFile(self, req, err);
+
+    if (n === 0 || req.aborted)
+      return finishSendFile(self, req, null);
+
+    if (self.destroyed || !self._handle)
+      return finishSendFile(self, req, new Error('This socket is closed.'));
+
+    // The transfer holds the write queue, go around it.
+    req.busy = true;
+    self._writeGeneric(false, buffer.slice(0, n), 'buffer', function(err) {
+      if (req.done)
+        return;
+      req.busy = false;
+      if (err)
+        return finishSendFile(self, req, err);
+      advanceSendFile(self, req, n);
+    });
+  });
+}
+
+
+// Used by fs.ReadStream.prototype.pipe() to decide whether it can hand the
+// file over to sendFile().
+Socket.prototype._canSendFile = function() {
+  return this._sendFileSupported &&
+         !this._connecting &&
+         this.writable &&
+         sendFileFd(this) !== -1;
+};
+
 // Important: this should have the same values as in src/stream_wrap.h
 function getEncodingId(encoding) {
   switch (encoding) {
@@ -989,7 +1245,7 @@ function toNumber(x) { return (x = Number(x)) >= 0 ? x : false; }
 
 
 var createServerHandle = exports._createServerHandle =
-    function(address, port, addressType, fd) {
+    function(address, port, addressType, fd, reusePort) {
   var err = 0;
   // assign handle in listen, and clean up if bind or listen fails
   var handle;
@@ -1023,9 +1279,9 @@ var createServerHandle = exports._createServerHandle =
   if (address || port) {
     debug('bind to ' + address);
     if (addressType == 6) {
-      err = handle.bind6(address, port);
+      err = handle.bind6(address, port, !!reusePort);
     } else {
-      err = handle.bind(address, port);
+      err = handle.bind(address, port, !!reusePort);
     }
   }
 
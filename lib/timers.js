@@ -20,11 +20,17 @@
 // USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 var Timer = process.binding('timer_wrap').Timer;
+var TimerWheel = process.binding('timer_wrap').TimerWheel;
 var L = require('_linklist');
 var assert = require('assert').ok;
 
 var kOnTimeout = Timer.kOnTimeout | 0;
 
+// The loop's cached time, the same as Timer.now() returns but without the
+// call into C++. It's updated whenever the loop calls into JS. Use
+// Timer.preciseNow() for the actual current time.
+var loopTime = Timer.loopTime;
+
 // Timeout values > TIMEOUT_MAX are set to 1.
 var TIMEOUT_MAX = 2147483647; // 2^31-1
 
@@ -47,7 +53,7 @@ var lists = {};
 // the main function - creates lists on demand and the watchers associated
 // with them.
 function insert(item, msecs) {
-  item._idleStart = Timer.now();
+  item._idleStart = loopTime[0];
   item._idleTimeout = msecs;
 
   if (msecs < 0) return;
@@ -77,7 +83,7 @@ function listOnTimeout() {
 
   debug('timeout callback %d', msecs);
 
-  var now = Timer.now();
+  var now = loopTime[0];
   debug('now: %s', now);
 
   var first;
@@ -125,8 +131,20 @@ function listOnTimeout() {
 }
 
 
+// An item is either in one of the lists or in the unref'd wheel, never in
+// both, or it would time out twice.
+function removeFromWheel(item) {
+  if (item._wheelId >= 0) {
+    unrefWheel.remove(item._wheelId);
+    unrefItems[item._wheelId] = undefined;
+    item._wheelId = -1;
+  }
+}
+
+
 var unenroll = exports.unenroll = function(item) {
   L.remove(item);
+  removeFromWheel(item);
 
   var list = lists[item._idleTimeout];
   // if empty then stop the watcher
@@ -145,7 +163,7 @@ var unenroll = exports.unenroll = function(item) {
 exports.enroll = function(item, msecs) {
   // if this item was already in a list somewhere
   // then we should unenroll it from that
-  if (item._idleNext) unenroll(item);
+  if (item._idleNext || item._wheelId >= 0) unenroll(item);
 
   // Ensure that msecs fits into signed int32
   if (msecs > 0x7fffffff) {
@@ -153,6 +171,7 @@ exports.enroll = function(item, msecs) {
   }
 
   item._idleTimeout = msecs;
+  item._wheelId = -1;
   L.init(item);
 };
 
@@ -162,12 +181,13 @@ exports.enroll = function(item, msecs) {
 exports.active = function(item) {
   var msecs = item._idleTimeout;
   if (msecs >= 0) {
+    removeFromWheel(item);
 
     var list = lists[msecs];
     if (!list || L.isEmpty(list)) {
       insert(item, msecs);
     } else {
-      item._idleStart = Timer.now();
+      item._idleStart = loopTime[0];
       L.append(list, item);
     }
   }
@@ -279,7 +299,7 @@ var Timeout = function(after) {
 
 Timeout.prototype.unref = function() {
   if (!this._handle) {
-    var now = Timer.now();
+    var now = loopTime[0];
     if (!this._idleStart) this._idleStart = now;
     var delay = this._idleStart + this._idleTimeout - now;
     if (delay < 0) delay = 0;
@@ -380,28 +400,41 @@ exports.clearImmediate = function(immediate) {
 
 // Internal APIs that need timeouts should use timers._unrefActive isntead of
 // timers.active as internal timeouts shouldn't hold the loop open
+//
+// A server has one of these per connection and refreshes it on every read,
+// so they live in a timing wheel (src/timer_wheel.cc) where adding,
+// refreshing and removing one doesn't depend on how many there are. The
+// ones that expire together come back in one batch. They may fire up to
+// UNREF_RESOLUTION ms late, never early.
 
-var unrefList, unrefTimer;
+var UNREF_RESOLUTION = 10;
 
+var unrefWheel = null;
+var unrefItems = [];  // wheel id -> item
+var expired = [];
+var expiredIndex = 0;
 
-function unrefTimeout() {
-  var now = Timer.now();
 
-  debug('unrefTimer fired');
+function unrefTimeout(ids) {
+  debug('unrefWheel fired, %d expired', ids.length);
 
-  var first;
-  while (first = L.peek(unrefList)) {
-    var diff = now - first._idleStart;
+  for (var i = 0; i < ids.length; i++) {
+    var item = unrefItems[ids[i]];
+    unrefItems[ids[i]] = undefined;
+    item._wheelId = -1;
+    expired.push(item);
+  }
 
-    if (diff < first._idleTimeout) {
-      diff = first._idleTimeout - diff;
-      unrefTimer.start(diff, 0);
-      unrefTimer.when = now + diff;
-      debug('unrefTimer rescheudling for later');
-      return;
-    }
+  runExpired();
+}
 
-    L.remove(first);
+
+function runExpired() {
+  while (expiredIndex < expired.length) {
+    var first = expired[expiredIndex++];
+
+    // Refreshed or unenrolled by a timeout earlier in the batch.
+    if (first._wheelId !== -1 || first._idleTimeout < 0) continue;
 
     var domain = first.domain;
 
@@ -416,12 +449,12 @@ function unrefTimeout() {
       threw = false;
       if (domain) domain.exit();
     } finally {
-      if (threw) process.nextTick(unrefTimeout);
+      if (threw) process.nextTick(runExpired);
     }
   }
 
-  debug('unrefList is empty');
-  unrefTimer.when = -1;
+  expired = [];
+  expiredIndex = 0;
 }
 
 
@@ -432,55 +465,19 @@ exports._unrefActive = function(item) {
 
   L.remove(item);
 
-  if (!unrefList) {
-    debug('unrefList initialized');
-    unrefList = {};
-    L.init(unrefList);
-
-    debug('unrefTimer initialized');
-    unrefTimer = new Timer();
-    unrefTimer.unref();
-    unrefTimer.when = -1;
-    unrefTimer[kOnTimeout] = unrefTimeout;
+  if (!unrefWheel) {
+    debug('unrefWheel initialized');
+    unrefWheel = new TimerWheel(UNREF_RESOLUTION);
+    unrefWheel.unref();
+    unrefWheel[kOnTimeout] = unrefTimeout;
   }
 
-  var now = Timer.now();
-  item._idleStart = now;
+  item._idleStart = loopTime[0];
 
-  if (L.isEmpty(unrefList)) {
-    debug('unrefList empty');
-    L.append(unrefList, item);
-
-    unrefTimer.start(msecs, 0);
-    unrefTimer.when = now + msecs;
-    debug('unrefTimer scheduled');
-    return;
-  }
-
-  var when = now + msecs;
-
-  debug('unrefList find where we can insert');
-
-  var cur, them;
-
-  for (cur = unrefList._idlePrev; cur != unrefList; cur = cur._idlePrev) {
-    them = cur._idleStart + cur._idleTimeout;
-
-    if (when < them) {
-      debug('unrefList inserting into middle of list');
-
-      L.append(cur, item);
-
-      if (unrefTimer.when > when) {
-        debug('unrefTimer is scheduled to fire too late, reschedule');
-        unrefTimer.start(msecs, 0);
-        unrefTimer.when = when;
-      }
-
-      return;
-    }
+  if (item._wheelId >= 0) {
+    unrefWheel.refresh(item._wheelId, msecs);
+  } else {
+    item._wheelId = unrefWheel.add(msecs);
+    unrefItems[item._wheelId] = item;
   }
-
-  debug('unrefList append to end');
-  L.append(unrefList, item);
 };
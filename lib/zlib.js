@@ -38,6 +38,15 @@ binding.Z_MIN_CHUNK = 64;
 binding.Z_MAX_CHUNK = Infinity;
 binding.Z_DEFAULT_CHUNK = (16 * 1024);
 
+// writes with less input than this are done on the main thread, for small
+// inputs the thread pool round trip costs more than the (de)compression.
+binding.Z_DEFAULT_INLINE_THRESHOLD = 1024;
+
+// parallel compression cuts the input into blocks of this size. A block
+// should be a good deal bigger than the 32K window it's primed with.
+binding.Z_MIN_BLOCKSIZE = (32 * 1024);
+binding.Z_DEFAULT_BLOCKSIZE = (128 * 1024);
+
 binding.Z_MIN_MEMLEVEL = 1;
 binding.Z_MAX_MEMLEVEL = 9;
 binding.Z_DEFAULT_MEMLEVEL = 8;
@@ -163,6 +172,34 @@ exports.inflateRaw = function(buffer, opts, callback) {
   zlibBuffer(new InflateRaw(opts), buffer, callback);
 };
 
+exports.deflateSync = function(buffer, opts) {
+  return zlibBufferSync(new Deflate(opts), buffer);
+};
+
+exports.gzipSync = function(buffer, opts) {
+  return zlibBufferSync(new Gzip(opts), buffer);
+};
+
+exports.deflateRawSync = function(buffer, opts) {
+  return zlibBufferSync(new DeflateRaw(opts), buffer);
+};
+
+exports.unzipSync = function(buffer, opts) {
+  return zlibBufferSync(new Unzip(opts), buffer);
+};
+
+exports.inflateSync = function(buffer, opts) {
+  return zlibBufferSync(new Inflate(opts), buffer);
+};
+
+exports.gunzipSync = function(buffer, opts) {
+  return zlibBufferSync(new Gunzip(opts), buffer);
+};
+
+exports.inflateRawSync = function(buffer, opts) {
+  return zlibBufferSync(new InflateRaw(opts), buffer);
+};
+
 function zlibBuffer(engine, buffer, callback) {
   var buffers = [];
   var nread = 0;
@@ -196,6 +233,23 @@ function zlibBuffer(engine, buffer, callback) {
   }
 }
 
+function zlibBufferSync(engine, buffer) {
+  // the engine drops its handle when zlib reports an error, keep our own
+  // reference so it's closed no matter how we get out of here.
+  var handle = engine._binding;
+  try {
+    if (util.isString(buffer))
+      buffer = new Buffer(buffer);
+    if (!util.isBuffer(buffer))
+      throw new TypeError('Not a string or buffer');
+
+    return engine._processChunk(buffer, binding.Z_FINISH);
+  } finally {
+    engine._closed = true;
+    handle.close();
+  }
+}
+
 
 // generic zlib
 // minimal 2-byte header
@@ -266,6 +320,13 @@ function Zlib(opts, mode) {
   }
   this._flushFlag = opts.flush || binding.Z_NO_FLUSH;
 
+  this._inlineThreshold = exports.Z_DEFAULT_INLINE_THRESHOLD;
+  if (!util.isUndefined(opts.inlineThreshold)) {
+    if (!util.isNumber(opts.inlineThreshold) || opts.inlineThreshold < 0)
+      throw new Error('Invalid inlineThreshold: ' + opts.inlineThreshold);
+    this._inlineThreshold = opts.inlineThreshold;
+  }
+
   if (opts.chunkSize) {
     if (opts.chunkSize < exports.Z_MIN_CHUNK ||
         opts.chunkSize > exports.Z_MAX_CHUNK) {
@@ -273,6 +334,22 @@ function Zlib(opts, mode) {
     }
   }
 
+  if (!util.isUndefined(opts.parallel)) {
+    if (mode !== binding.GZIP && mode !== binding.DEFLATERAW)
+      throw new Error('parallel is only supported by Gzip and DeflateRaw');
+    if (!util.isNumber(opts.parallel) || opts.parallel < 0 ||
+        opts.parallel % 1 !== 0) {
+      throw new Error('Invalid parallel: ' + opts.parallel);
+    }
+  }
+
+  if (!util.isUndefined(opts.blockSize)) {
+    if (!util.isNumber(opts.blockSize) || !isFinite(opts.blockSize) ||
+        opts.blockSize < exports.Z_MIN_BLOCKSIZE) {
+      throw new RangeError('Invalid block size: ' + opts.blockSize);
+    }
+  }
+
   if (opts.windowBits) {
     if (opts.windowBits < exports.Z_MIN_WINDOWBITS ||
         opts.windowBits > exports.Z_MAX_WINDOWBITS) {
@@ -344,6 +421,10 @@ function Zlib(opts, mode) {
   this._level = level;
   this._strategy = strategy;
 
+  this._parallel = null;
+  if (opts.parallel)
+    this._parallel = new ParallelState(this, mode);
+
   this.once('end', this.close);
 }
 
@@ -378,6 +459,15 @@ Zlib.prototype.params = function(level, strategy, callback) {
 };
 
 Zlib.prototype.reset = function() {
+  var parallel = this._parallel;
+  if (parallel) {
+    // Blocks still on the thread pool see that they belong to an old state
+    // and are dropped. The write that was waiting for them is done.
+    this._parallel = new ParallelState(this, parallel.mode);
+    var cb = parallel.callback;
+    parallel.callback = null;
+    if (cb) cb();
+  }
   return this._binding.reset();
 };
 
@@ -453,25 +543,92 @@ Zlib.prototype._transform = function(chunk, encoding, cb) {
     }
   }
 
+  if (this._parallel)
+    this._parallel.transform(chunk, flushFlag, cb);
+  else
+    this._processChunk(chunk, flushFlag, cb);
+};
+
+// Feeds chunk through zlib, pushing the output as it's produced. Without
+// a callback it's done synchronously and the output is returned instead.
+Zlib.prototype._processChunk = function(chunk, flushFlag, cb) {
   var availInBefore = chunk && chunk.length;
   var availOutBefore = this._chunkSize - this._offset;
   var inOff = 0;
 
-  var req = this._binding.write(flushFlag,
-                                chunk, // in
-                                inOff, // in_off
-                                availInBefore, // in_len
-                                this._buffer, // out
-                                this._offset, //out_off
-                                availOutBefore); // out_len
+  var self = this;
+  var async = util.isFunction(cb);
+
+  if (!async) {
+    var buffers = [];
+    var nread = 0;
+    var error;
+    this.on('error', function(er) {
+      error = er;
+    });
 
-  req.buffer = chunk;
-  req.callback = callback;
+    do {
+      this._binding.writeSync(flushFlag,
+                              chunk, // in
+                              inOff, // in_off
+                              availInBefore, // in_len
+                              this._buffer, // out
+                              this._offset, //out_off
+                              availOutBefore); // out_len
+    } while (!this._hadError && callback(this._binding[0], this._binding[1]));
 
-  var self = this;
+    if (this._hadError)
+      throw error;
+
+    return Buffer.concat(buffers, nread);
+  }
+
+  // small writes are done on the main thread, but on the next tick so the
+  // output still comes after write() returns, as with the thread pool.
+  if (availInBefore < this._inlineThreshold)
+    process.nextTick(writeInline);
+  else
+    write();
+
+  function writeInline() {
+    // the stream may have been closed in the meantime.
+    if (self._closed || self._hadError)
+      return;
+
+    // loop for as long as the output buffer keeps filling up.
+    do {
+      self._binding.writeSync(flushFlag,
+                              chunk,
+                              inOff,
+                              availInBefore,
+                              self._buffer,
+                              self._offset,
+                              availOutBefore);
+    } while (!self._hadError && callback(self._binding[0], self._binding[1]));
+  }
+
+  function write() {
+    var req = self._binding.write(flushFlag,
+                                  chunk, // in
+                                  inOff, // in_off
+                                  availInBefore, // in_len
+                                  self._buffer, // out
+                                  self._offset, //out_off
+                                  availOutBefore); // out_len
+
+    req.buffer = chunk;
+    req.callback = afterWrite;
+  }
+
+  function afterWrite(availInAfter, availOutAfter) {
+    if (callback(availInAfter, availOutAfter))
+      write();
+  }
+
+  // Returns true if there's more output to collect for this chunk.
   function callback(availInAfter, availOutAfter) {
     if (self._hadError)
-      return;
+      return false;
 
     var have = availOutBefore - availOutAfter;
     assert(have >= 0, 'have should not go down');
@@ -480,7 +637,12 @@ Zlib.prototype._transform = function(chunk, encoding, cb) {
       var out = self._buffer.slice(self._offset, self._offset + have);
       self._offset += have;
       // serve some output to the consumer.
-      self.push(out);
+      if (async) {
+        self.push(out);
+      } else {
+        buffers.push(out);
+        nread += out.length;
+      }
     }
 
     // exhausted the output buffer, or used all the input create a new one.
@@ -497,22 +659,171 @@ Zlib.prototype._transform = function(chunk, encoding, cb) {
       // it'll have the correct byte counts.
       inOff += (availInBefore - availInAfter);
       availInBefore = availInAfter;
-
-      var newReq = self._binding.write(flushFlag,
-                                       chunk,
-                                       inOff,
-                                       availInBefore,
-                                       self._buffer,
-                                       self._offset,
-                                       self._chunkSize);
-      newReq.callback = callback; // this same function
-      newReq.buffer = chunk;
-      return;
+      return true;
     }
 
     // finished with the chunk.
-    cb();
+    if (async)
+      cb();
+    return false;
+  }
+};
+
+
+// Parallel compression, the way pigz does it. The input is cut into blocks
+// that are deflated on the thread pool at the same time, each one primed
+// with the window of input before it so the compression ratio hardly
+// suffers. Every block but the last one ends with a sync flush, which
+// leaves it on a byte boundary, so the output is simply concatenated into
+// one raw deflate stream. For gzip the CRC32 of the blocks is put together
+// with crc32_combine() for the trailer.
+function ParallelState(engine, mode) {
+  var opts = engine._opts;
+  this.engine = engine;
+  this.mode = mode;
+  this.max = opts.parallel;
+  this.blockSize = opts.blockSize || exports.Z_DEFAULT_BLOCKSIZE;
+  this.windowBits = opts.windowBits || exports.Z_DEFAULT_WINDOWBITS;
+  this.memLevel = opts.memLevel || exports.Z_DEFAULT_MEMLEVEL;
+  this.dictionary = mode === binding.DEFLATERAW && opts.dictionary || null;
+
+  this.pending = [];  // input that doesn't make a full block yet
+  this.pendingLength = 0;
+  this.blocks = [];  // dispatched blocks, in order
+  this.headerDone = mode !== binding.GZIP;
+  this.crc = 0;
+  this.length = 0;
+  this.callback = null;
+  this.waitForAll = false;
+  this.ended = false;
+}
+
+ParallelState.prototype.transform = function(chunk, flushFlag, cb) {
+  if (!this.headerDone) {
+    this.engine.push(this.header());
+    this.headerDone = true;
+  }
+
+  if (chunk && chunk.length > 0) {
+    this.pending.push(chunk);
+    this.pendingLength += chunk.length;
+  }
+
+  while (this.pendingLength >= this.blockSize)
+    this.dispatch(this.blockSize, false);
+
+  if (flushFlag === binding.Z_FINISH) {
+    this.dispatch(this.pendingLength, true);
+    this.ended = true;
+  } else if (flushFlag !== binding.Z_NO_FLUSH) {
+    if (this.pendingLength > 0)
+      this.dispatch(this.pendingLength, false);
+    // nothing after a full flush may refer back to what came before it.
+    if (flushFlag === binding.Z_FULL_FLUSH)
+      this.dictionary = null;
+  }
+
+  // a flush, or the end, only completes once everything is written out.
+  this.callback = cb;
+  this.waitForAll = flushFlag !== binding.Z_NO_FLUSH;
+  this.maybeContinue();
+};
+
+ParallelState.prototype.dispatch = function(length, last) {
+  var input = Buffer.concat(this.pending, this.pendingLength);
+  var rest = input.slice(length);
+  input = input.slice(0, length);
+  this.pending = rest.length > 0 ? [rest] : [];
+  this.pendingLength = rest.length;
+
+  var block = { input: input, output: null, crc: 0 };
+  this.blocks.push(block);
+
+  var self = this;
+  var engine = this.engine;
+  var req = {
+    oncomplete: function(errno, output, crc) {
+      if (engine._hadError || engine._parallel !== self)
+        return;
+      if (errno !== binding.Z_OK)
+        return engine._binding.onerror('Zlib error', errno);
+      block.output = output;
+      block.crc = crc;
+      self.flushBlocks();
+      self.maybeContinue();
+    },
+    input: input,
+    dictionary: this.dictionary
+  };
+
+  binding.deflateBlock(input,
+                       this.dictionary,
+                       engine._level,
+                       this.windowBits,
+                       this.memLevel,
+                       engine._strategy,
+                       last,
+                       req);
+
+  // the next block is primed with the end of this one.
+  var windowSize = 1 << this.windowBits;
+  if (input.length >= windowSize) {
+    this.dictionary = input.slice(input.length - windowSize);
+  } else if (this.dictionary) {
+    var dictionary = Buffer.concat([this.dictionary, input]);
+    this.dictionary = dictionary.slice(Math.max(0,
+                                                dictionary.length - windowSize));
+  } else {
+    this.dictionary = input;
+  }
+};
+
+// Push the output of the finished blocks at the front, in order.
+ParallelState.prototype.flushBlocks = function() {
+  while (this.blocks.length > 0 && this.blocks[0].output) {
+    var block = this.blocks.shift();
+    if (this.mode === binding.GZIP) {
+      this.crc = binding.crc32Combine(this.crc, block.crc, block.input.length);
+      this.length += block.input.length;
+    }
+    this.engine.push(block.output);
   }
+
+  if (this.ended && this.blocks.length === 0 && this.mode === binding.GZIP)
+    this.engine.push(this.trailer());
+};
+
+ParallelState.prototype.maybeContinue = function() {
+  var cb = this.callback;
+  if (!cb)
+    return;
+  if (this.waitForAll ? this.blocks.length > 0 :
+                        this.blocks.length >= this.max) {
+    return;
+  }
+  this.callback = null;
+  cb();
+};
+
+ParallelState.prototype.header = function() {
+  var level = this.engine._level;
+  var xfl = 0;
+  if (level === binding.Z_BEST_COMPRESSION)
+    xfl = 2;
+  else if (level === binding.Z_BEST_SPEED ||
+           level === binding.Z_NO_COMPRESSION ||
+           this.engine._strategy === binding.Z_HUFFMAN_ONLY ||
+           this.engine._strategy === binding.Z_RLE)
+    xfl = 4;
+  // magic, deflate, no flags, no mtime, xfl, unix.
+  return new Buffer([0x1f, 0x8b, 8, 0, 0, 0, 0, 0, xfl, 3]);
+};
+
+ParallelState.prototype.trailer = function() {
+  var trailer = new Buffer(8);
+  trailer.writeUInt32LE(this.crc, 0);
+  trailer.writeUInt32LE(this.length % 0x100000000, 4);
+  return trailer;
 };
 
 util.inherits(Deflate, Zlib);
@@ -0,0 +1,386 @@
+
+/*
+ * This file is generated by ../../tools/gen-postmortem-metadata.py.  Do not edit directly.
+ */
+
+#include "v8.h"
+#include "frames.h"
+#include "frames-inl.h" /* for architecture-specific frame constants */
+
+using namespace v8::internal;
+
+extern "C" {
+
+/* stack frame constants */
+#define FRAME_CONST(value, klass)           int v8dbg_frametype_##klass = StackFrame::value;
+
+STACK_FRAME_TYPE_LIST(FRAME_CONST)
+
+#undef FRAME_CONST
+
+/* miscellaneous constants */
+int v8dbg_FirstNonstringType = FIRST_NONSTRING_TYPE;
+int v8dbg_IsNotStringMask = kIsNotStringMask;
+int v8dbg_StringTag = kStringTag;
+int v8dbg_NotStringTag = kNotStringTag;
+int v8dbg_StringEncodingMask = kStringEncodingMask;
+int v8dbg_TwoByteStringTag = kTwoByteStringTag;
+int v8dbg_AsciiStringTag = kOneByteStringTag;
+int v8dbg_StringRepresentationMask = kStringRepresentationMask;
+int v8dbg_SeqStringTag = kSeqStringTag;
+int v8dbg_ConsStringTag = kConsStringTag;
+int v8dbg_ExternalStringTag = kExternalStringTag;
+int v8dbg_FailureTag = kFailureTag;
+int v8dbg_FailureTagMask = kFailureTagMask;
+int v8dbg_HeapObjectTag = kHeapObjectTag;
+int v8dbg_HeapObjectTagMask = kHeapObjectTagMask;
+int v8dbg_SmiTag = kSmiTag;
+int v8dbg_SmiTagMask = kSmiTagMask;
+int v8dbg_SmiValueShift = kSmiTagSize;
+int v8dbg_SmiShiftSize = kSmiShiftSize;
+int v8dbg_PointerSizeLog2 = kPointerSizeLog2;
+int v8dbg_prop_idx_first = DescriptorArray::kFirstIndex;
+int v8dbg_prop_type_field = FIELD;
+int v8dbg_prop_type_first_phantom = TRANSITION;
+int v8dbg_prop_type_mask = PropertyDetails::TypeField::kMask;
+int v8dbg_off_fp_context = StandardFrameConstants::kContextOffset;
+int v8dbg_off_fp_marker = StandardFrameConstants::kMarkerOffset;
+int v8dbg_off_fp_function = JavaScriptFrameConstants::kFunctionOffset;
+int v8dbg_off_fp_args = JavaScriptFrameConstants::kLastParameterOffset;
+
+/* class type information */
+int v8dbg_type_AccessorPair__ACCESSOR_PAIR_TYPE = ACCESSOR_PAIR_TYPE;
+int v8dbg_type_AccessCheckInfo__ACCESS_CHECK_INFO_TYPE = ACCESS_CHECK_INFO_TYPE;
+int v8dbg_type_AliasedArgumentsEntry__ALIASED_ARGUMENTS_ENTRY_TYPE = ALIASED_ARGUMENTS_ENTRY_TYPE;
+int v8dbg_type_AllocationMemento__ALLOCATION_MEMENTO_TYPE = ALLOCATION_MEMENTO_TYPE;
+int v8dbg_type_AllocationSite__ALLOCATION_SITE_TYPE = ALLOCATION_SITE_TYPE;
+int v8dbg_type_SeqOneByteString__ASCII_STRING_TYPE = ASCII_STRING_TYPE;
+int v8dbg_type_BreakPointInfo__BREAK_POINT_INFO_TYPE = BREAK_POINT_INFO_TYPE;
+int v8dbg_type_ByteArray__BYTE_ARRAY_TYPE = BYTE_ARRAY_TYPE;
+int v8dbg_type_CallHandlerInfo__CALL_HANDLER_INFO_TYPE = CALL_HANDLER_INFO_TYPE;
+int v8dbg_type_Cell__CELL_TYPE = CELL_TYPE;
+int v8dbg_type_CodeCache__CODE_CACHE_TYPE = CODE_CACHE_TYPE;
+int v8dbg_type_Code__CODE_TYPE = CODE_TYPE;
+int v8dbg_type_ConsString__CONS_ASCII_STRING_TYPE = CONS_ASCII_STRING_TYPE;
+int v8dbg_type_ConsString__CONS_STRING_TYPE = CONS_STRING_TYPE;
+int v8dbg_type_DebugInfo__DEBUG_INFO_TYPE = DEBUG_INFO_TYPE;
+int v8dbg_type_DeclaredAccessorDescriptor__DECLARED_ACCESSOR_DESCRIPTOR_TYPE = DECLARED_ACCESSOR_DESCRIPTOR_TYPE;
+int v8dbg_type_DeclaredAccessorInfo__DECLARED_ACCESSOR_INFO_TYPE = DECLARED_ACCESSOR_INFO_TYPE;
+int v8dbg_type_ExecutableAccessorInfo__EXECUTABLE_ACCESSOR_INFO_TYPE = EXECUTABLE_ACCESSOR_INFO_TYPE;
+int v8dbg_type_ExternalAsciiString__EXTERNAL_ASCII_STRING_TYPE = EXTERNAL_ASCII_STRING_TYPE;
+int v8dbg_type_ExternalByteArray__EXTERNAL_BYTE_ARRAY_TYPE = EXTERNAL_BYTE_ARRAY_TYPE;
+int v8dbg_type_ExternalDoubleArray__EXTERNAL_DOUBLE_ARRAY_TYPE = EXTERNAL_DOUBLE_ARRAY_TYPE;
+int v8dbg_type_ExternalFloatArray__EXTERNAL_FLOAT_ARRAY_TYPE = EXTERNAL_FLOAT_ARRAY_TYPE;
+int v8dbg_type_ExternalIntArray__EXTERNAL_INT_ARRAY_TYPE = EXTERNAL_INT_ARRAY_TYPE;
+int v8dbg_type_ExternalPixelArray__EXTERNAL_PIXEL_ARRAY_TYPE = EXTERNAL_PIXEL_ARRAY_TYPE;
+int v8dbg_type_ExternalShortArray__EXTERNAL_SHORT_ARRAY_TYPE = EXTERNAL_SHORT_ARRAY_TYPE;
+int v8dbg_type_ExternalTwoByteString__EXTERNAL_STRING_TYPE = EXTERNAL_STRING_TYPE;
+int v8dbg_type_ExternalUnsignedByteArray__EXTERNAL_UNSIGNED_BYTE_ARRAY_TYPE = EXTERNAL_UNSIGNED_BYTE_ARRAY_TYPE;
+int v8dbg_type_ExternalUnsignedIntArray__EXTERNAL_UNSIGNED_INT_ARRAY_TYPE = EXTERNAL_UNSIGNED_INT_ARRAY_TYPE;
+int v8dbg_type_ExternalUnsignedShortArray__EXTERNAL_UNSIGNED_SHORT_ARRAY_TYPE = EXTERNAL_UNSIGNED_SHORT_ARRAY_TYPE;
+int v8dbg_type_FixedArray__FIXED_ARRAY_TYPE = FIXED_ARRAY_TYPE;
+int v8dbg_type_FixedDoubleArray__FIXED_DOUBLE_ARRAY_TYPE = FIXED_DOUBLE_ARRAY_TYPE;
+int v8dbg_type_Foreign__FOREIGN_TYPE = FOREIGN_TYPE;
+int v8dbg_type_FreeSpace__FREE_SPACE_TYPE = FREE_SPACE_TYPE;
+int v8dbg_type_FunctionTemplateInfo__FUNCTION_TEMPLATE_INFO_TYPE = FUNCTION_TEMPLATE_INFO_TYPE;
+int v8dbg_type_HeapNumber__HEAP_NUMBER_TYPE = HEAP_NUMBER_TYPE;
+int v8dbg_type_InterceptorInfo__INTERCEPTOR_INFO_TYPE = INTERCEPTOR_INFO_TYPE;
+int v8dbg_type_JSArrayBuffer__JS_ARRAY_BUFFER_TYPE = JS_ARRAY_BUFFER_TYPE;
+int v8dbg_type_JSArray__JS_ARRAY_TYPE = JS_ARRAY_TYPE;
+int v8dbg_type_JSBuiltinsObject__JS_BUILTINS_OBJECT_TYPE = JS_BUILTINS_OBJECT_TYPE;
+int v8dbg_type_JSDataView__JS_DATA_VIEW_TYPE = JS_DATA_VIEW_TYPE;
+int v8dbg_type_JSDate__JS_DATE_TYPE = JS_DATE_TYPE;
+int v8dbg_type_JSFunctionProxy__JS_FUNCTION_PROXY_TYPE = JS_FUNCTION_PROXY_TYPE;
+int v8dbg_type_JSFunction__JS_FUNCTION_TYPE = JS_FUNCTION_TYPE;
+int v8dbg_type_JSGeneratorObject__JS_GENERATOR_OBJECT_TYPE = JS_GENERATOR_OBJECT_TYPE;
+int v8dbg_type_JSGlobalObject__JS_GLOBAL_OBJECT_TYPE = JS_GLOBAL_OBJECT_TYPE;
+int v8dbg_type_JSMap__JS_MAP_TYPE = JS_MAP_TYPE;
+int v8dbg_type_JSMessageObject__JS_MESSAGE_OBJECT_TYPE = JS_MESSAGE_OBJECT_TYPE;
+int v8dbg_type_JSModule__JS_MODULE_TYPE = JS_MODULE_TYPE;
+int v8dbg_type_JSObject__JS_OBJECT_TYPE = JS_OBJECT_TYPE;
+int v8dbg_type_JSProxy__JS_PROXY_TYPE = JS_PROXY_TYPE;
+int v8dbg_type_JSRegExp__JS_REGEXP_TYPE = JS_REGEXP_TYPE;
+int v8dbg_type_JSSet__JS_SET_TYPE = JS_SET_TYPE;
+int v8dbg_type_JSTypedArray__JS_TYPED_ARRAY_TYPE = JS_TYPED_ARRAY_TYPE;
+int v8dbg_type_JSValue__JS_VALUE_TYPE = JS_VALUE_TYPE;
+int v8dbg_type_JSWeakMap__JS_WEAK_MAP_TYPE = JS_WEAK_MAP_TYPE;
+int v8dbg_type_JSWeakSet__JS_WEAK_SET_TYPE = JS_WEAK_SET_TYPE;
+int v8dbg_type_Map__MAP_TYPE = MAP_TYPE;
+int v8dbg_type_ObjectTemplateInfo__OBJECT_TEMPLATE_INFO_TYPE = OBJECT_TEMPLATE_INFO_TYPE;
+int v8dbg_type_Oddball__ODDBALL_TYPE = ODDBALL_TYPE;
+int v8dbg_type_PolymorphicCodeCache__POLYMORPHIC_CODE_CACHE_TYPE = POLYMORPHIC_CODE_CACHE_TYPE;
+int v8dbg_type_PropertyCell__PROPERTY_CELL_TYPE = PROPERTY_CELL_TYPE;
+int v8dbg_type_Script__SCRIPT_TYPE = SCRIPT_TYPE;
+int v8dbg_type_SharedFunctionInfo__SHARED_FUNCTION_INFO_TYPE = SHARED_FUNCTION_INFO_TYPE;
+int v8dbg_type_SignatureInfo__SIGNATURE_INFO_TYPE = SIGNATURE_INFO_TYPE;
+int v8dbg_type_SlicedString__SLICED_ASCII_STRING_TYPE = SLICED_ASCII_STRING_TYPE;
+int v8dbg_type_SlicedString__SLICED_STRING_TYPE = SLICED_STRING_TYPE;
+int v8dbg_type_SeqTwoByteString__STRING_TYPE = STRING_TYPE;
+int v8dbg_type_SeqTwoByteString__SYMBOL_TYPE = SYMBOL_TYPE;
+int v8dbg_type_TypeFeedbackInfo__TYPE_FEEDBACK_INFO_TYPE = TYPE_FEEDBACK_INFO_TYPE;
+int v8dbg_type_TypeSwitchInfo__TYPE_SWITCH_INFO_TYPE = TYPE_SWITCH_INFO_TYPE;
+
+/* class hierarchy information */
+int v8dbg_parent_AccessCheckInfo__Struct = 0;
+int v8dbg_parent_AccessorInfo__Struct = 0;
+int v8dbg_parent_AccessorPair__Struct = 0;
+int v8dbg_parent_AliasedArgumentsEntry__Struct = 0;
+int v8dbg_parent_AllocationMemento__Struct = 0;
+int v8dbg_parent_AllocationSite__Struct = 0;
+int v8dbg_parent_BreakPointInfo__Struct = 0;
+int v8dbg_parent_ByteArray__FixedArrayBase = 0;
+int v8dbg_parent_CallHandlerInfo__Struct = 0;
+int v8dbg_parent_Cell__HeapObject = 0;
+int v8dbg_parent_Code__HeapObject = 0;
+int v8dbg_parent_CodeCache__Struct = 0;
+int v8dbg_parent_ConsString__String = 0;
+int v8dbg_parent_DebugInfo__Struct = 0;
+int v8dbg_parent_DeclaredAccessorDescriptor__Struct = 0;
+int v8dbg_parent_DeclaredAccessorInfo__AccessorInfo = 0;
+int v8dbg_parent_DeoptimizationInputData__FixedArray = 0;
+int v8dbg_parent_DeoptimizationOutputData__FixedArray = 0;
+int v8dbg_parent_DependentCode__FixedArray = 0;
+int v8dbg_parent_DescriptorArray__FixedArray = 0;
+int v8dbg_parent_ExecutableAccessorInfo__AccessorInfo = 0;
+int v8dbg_parent_ExternalArray__FixedArrayBase = 0;
+int v8dbg_parent_ExternalAsciiString__ExternalString = 0;
+int v8dbg_parent_ExternalByteArray__ExternalArray = 0;
+int v8dbg_parent_ExternalDoubleArray__ExternalArray = 0;
+int v8dbg_parent_ExternalFloatArray__ExternalArray = 0;
+int v8dbg_parent_ExternalIntArray__ExternalArray = 0;
+int v8dbg_parent_ExternalPixelArray__ExternalArray = 0;
+int v8dbg_parent_ExternalShortArray__ExternalArray = 0;
+int v8dbg_parent_ExternalString__String = 0;
+int v8dbg_parent_ExternalTwoByteString__ExternalString = 0;
+int v8dbg_parent_ExternalUnsignedByteArray__ExternalArray = 0;
+int v8dbg_parent_ExternalUnsignedIntArray__ExternalArray = 0;
+int v8dbg_parent_ExternalUnsignedShortArray__ExternalArray = 0;
+int v8dbg_parent_Failure__MaybeObject = 0;
+int v8dbg_parent_FixedArray__FixedArrayBase = 0;
+int v8dbg_parent_FixedArrayBase__HeapObject = 0;
+int v8dbg_parent_FixedDoubleArray__FixedArrayBase = 0;
+int v8dbg_parent_Foreign__HeapObject = 0;
+int v8dbg_parent_FreeSpace__HeapObject = 0;
+int v8dbg_parent_FunctionTemplateInfo__TemplateInfo = 0;
+int v8dbg_parent_GlobalObject__JSObject = 0;
+int v8dbg_parent_HashTable__FixedArray = 0;
+int v8dbg_parent_HeapNumber__HeapObject = 0;
+int v8dbg_parent_HeapObject__Object = 0;
+int v8dbg_parent_InterceptorInfo__Struct = 0;
+int v8dbg_parent_JSArray__JSObject = 0;
+int v8dbg_parent_JSArrayBuffer__JSObject = 0;
+int v8dbg_parent_JSArrayBufferView__JSObject = 0;
+int v8dbg_parent_JSBuiltinsObject__GlobalObject = 0;
+int v8dbg_parent_JSDataView__JSArrayBufferView = 0;
+int v8dbg_parent_JSDate__JSObject = 0;
+int v8dbg_parent_JSFunction__JSObject = 0;
+int v8dbg_parent_JSFunctionProxy__JSProxy = 0;
+int v8dbg_parent_JSFunctionResultCache__FixedArray = 0;
+int v8dbg_parent_JSGeneratorObject__JSObject = 0;
+int v8dbg_parent_JSGlobalObject__GlobalObject = 0;
+int v8dbg_parent_JSMap__JSObject = 0;
+int v8dbg_parent_JSMessageObject__JSObject = 0;
+int v8dbg_parent_JSModule__JSObject = 0;
+int v8dbg_parent_JSObject__JSReceiver = 0;
+int v8dbg_parent_JSProxy__JSReceiver = 0;
+int v8dbg_parent_JSReceiver__HeapObject = 0;
+int v8dbg_parent_JSRegExp__JSObject = 0;
+int v8dbg_parent_JSRegExpResult__JSArray = 0;
+int v8dbg_parent_JSSet__JSObject = 0;
+int v8dbg_parent_JSTypedArray__JSArrayBufferView = 0;
+int v8dbg_parent_JSValue__JSObject = 0;
+int v8dbg_parent_JSWeakCollection__JSObject = 0;
+int v8dbg_parent_JSWeakMap__JSWeakCollection = 0;
+int v8dbg_parent_JSWeakSet__JSWeakCollection = 0;
+int v8dbg_parent_Map__HeapObject = 0;
+int v8dbg_parent_Name__HeapObject = 0;
+int v8dbg_parent_NormalizedMapCache__FixedArray = 0;
+int v8dbg_parent_ObjectTemplateInfo__TemplateInfo = 0;
+int v8dbg_parent_Oddball__HeapObject = 0;
+int v8dbg_parent_PolymorphicCodeCache__Struct = 0;
+int v8dbg_parent_PropertyCell__Cell = 0;
+int v8dbg_parent_Script__Struct = 0;
+int v8dbg_parent_SeqOneByteString__SeqString = 0;
+int v8dbg_parent_SeqString__String = 0;
+int v8dbg_parent_SeqTwoByteString__SeqString = 0;
+int v8dbg_parent_SharedFunctionInfo__HeapObject = 0;
+int v8dbg_parent_SignatureInfo__Struct = 0;
+int v8dbg_parent_SlicedString__String = 0;
+int v8dbg_parent_Smi__Object = 0;
+int v8dbg_parent_String__Name = 0;
+int v8dbg_parent_Struct__HeapObject = 0;
+int v8dbg_parent_Symbol__Name = 0;
+int v8dbg_parent_TemplateInfo__Struct = 0;
+int v8dbg_parent_TypeFeedbackCells__FixedArray = 0;
+int v8dbg_parent_TypeFeedbackInfo__Struct = 0;
+int v8dbg_parent_TypeSwitchInfo__Struct = 0;
+
+/* field information */
+int v8dbg_class_JSObject__properties__FixedArray = JSObject::kPropertiesOffset;
+int v8dbg_class_Oddball__to_string__String = Oddball::kToStringOffset;
+int v8dbg_class_Oddball__to_number__Object = Oddball::kToNumberOffset;
+int v8dbg_class_PropertyCell__dependent_code__DependentCode = PropertyCell::kDependentCodeOffset;
+int v8dbg_class_FixedArrayBase__length__SMI = FixedArrayBase::kLengthOffset;
+int v8dbg_class_FreeSpace__size__SMI = FreeSpace::kSizeOffset;
+int v8dbg_class_String__length__SMI = String::kLengthOffset;
+int v8dbg_class_Symbol__name__Object = Symbol::kNameOffset;
+int v8dbg_class_SlicedString__offset__SMI = SlicedString::kOffsetOffset;
+int v8dbg_class_Map__instance_descriptors__DescriptorArray = Map::kDescriptorsOffset;
+int v8dbg_class_Map__code_cache__Object = Map::kCodeCacheOffset;
+int v8dbg_class_Map__dependent_code__DependentCode = Map::kDependentCodeOffset;
+int v8dbg_class_Map__constructor__Object = Map::kConstructorOffset;
+int v8dbg_class_JSFunction__shared__SharedFunctionInfo = JSFunction::kSharedFunctionInfoOffset;
+int v8dbg_class_JSFunction__literals_or_bindings__FixedArray = JSFunction::kLiteralsOffset;
+int v8dbg_class_JSFunction__next_function_link__Object = JSFunction::kNextFunctionLinkOffset;
+int v8dbg_class_GlobalObject__builtins__JSBuiltinsObject = GlobalObject::kBuiltinsOffset;
+int v8dbg_class_GlobalObject__native_context__Context = GlobalObject::kNativeContextOffset;
+int v8dbg_class_GlobalObject__global_context__Context = GlobalObject::kGlobalContextOffset;
+int v8dbg_class_GlobalObject__global_receiver__JSObject = GlobalObject::kGlobalReceiverOffset;
+int v8dbg_class_JSGlobalProxy__native_context__Object = JSGlobalProxy::kNativeContextOffset;
+int v8dbg_class_AccessorInfo__name__Object = AccessorInfo::kNameOffset;
+int v8dbg_class_AccessorInfo__expected_receiver_type__Object = AccessorInfo::kExpectedReceiverTypeOffset;
+int v8dbg_class_DeclaredAccessorDescriptor__serialized_data__ByteArray = DeclaredAccessorDescriptor::kSerializedDataOffset;
+int v8dbg_class_DeclaredAccessorInfo__descriptor__DeclaredAccessorDescriptor = DeclaredAccessorInfo::kDescriptorOffset;
+int v8dbg_class_ExecutableAccessorInfo__getter__Object = ExecutableAccessorInfo::kGetterOffset;
+int v8dbg_class_ExecutableAccessorInfo__setter__Object = ExecutableAccessorInfo::kSetterOffset;
+int v8dbg_class_ExecutableAccessorInfo__data__Object = ExecutableAccessorInfo::kDataOffset;
+int v8dbg_class_Box__value__Object = Box::kValueOffset;
+int v8dbg_class_AccessorPair__getter__Object = AccessorPair::kGetterOffset;
+int v8dbg_class_AccessorPair__setter__Object = AccessorPair::kSetterOffset;
+int v8dbg_class_AccessCheckInfo__named_callback__Object = AccessCheckInfo::kNamedCallbackOffset;
+int v8dbg_class_AccessCheckInfo__indexed_callback__Object = AccessCheckInfo::kIndexedCallbackOffset;
+int v8dbg_class_AccessCheckInfo__data__Object = AccessCheckInfo::kDataOffset;
+int v8dbg_class_InterceptorInfo__getter__Object = InterceptorInfo::kGetterOffset;
+int v8dbg_class_InterceptorInfo__setter__Object = InterceptorInfo::kSetterOffset;
+int v8dbg_class_InterceptorInfo__query__Object = InterceptorInfo::kQueryOffset;
+int v8dbg_class_InterceptorInfo__deleter__Object = InterceptorInfo::kDeleterOffset;
+int v8dbg_class_InterceptorInfo__enumerator__Object = InterceptorInfo::kEnumeratorOffset;
+int v8dbg_class_InterceptorInfo__data__Object = InterceptorInfo::kDataOffset;
+int v8dbg_class_CallHandlerInfo__callback__Object = CallHandlerInfo::kCallbackOffset;
+int v8dbg_class_CallHandlerInfo__data__Object = CallHandlerInfo::kDataOffset;
+int v8dbg_class_TemplateInfo__tag__Object = TemplateInfo::kTagOffset;
+int v8dbg_class_TemplateInfo__property_list__Object = TemplateInfo::kPropertyListOffset;
+int v8dbg_class_FunctionTemplateInfo__serial_number__Object = FunctionTemplateInfo::kSerialNumberOffset;
+int v8dbg_class_FunctionTemplateInfo__call_code__Object = FunctionTemplateInfo::kCallCodeOffset;
+int v8dbg_class_FunctionTemplateInfo__property_accessors__Object = FunctionTemplateInfo::kPropertyAccessorsOffset;
+int v8dbg_class_FunctionTemplateInfo__prototype_template__Object = FunctionTemplateInfo::kPrototypeTemplateOffset;
+int v8dbg_class_FunctionTemplateInfo__parent_template__Object = FunctionTemplateInfo::kParentTemplateOffset;
+int v8dbg_class_FunctionTemplateInfo__named_property_handler__Object = FunctionTemplateInfo::kNamedPropertyHandlerOffset;
+int v8dbg_class_FunctionTemplateInfo__indexed_property_handler__Object = FunctionTemplateInfo::kIndexedPropertyHandlerOffset;
+int v8dbg_class_FunctionTemplateInfo__instance_template__Object = FunctionTemplateInfo::kInstanceTemplateOffset;
+int v8dbg_class_FunctionTemplateInfo__class_name__Object = FunctionTemplateInfo::kClassNameOffset;
+int v8dbg_class_FunctionTemplateInfo__signature__Object = FunctionTemplateInfo::kSignatureOffset;
+int v8dbg_class_FunctionTemplateInfo__instance_call_handler__Object = FunctionTemplateInfo::kInstanceCallHandlerOffset;
+int v8dbg_class_FunctionTemplateInfo__access_check_info__Object = FunctionTemplateInfo::kAccessCheckInfoOffset;
+int v8dbg_class_ObjectTemplateInfo__constructor__Object = ObjectTemplateInfo::kConstructorOffset;
+int v8dbg_class_ObjectTemplateInfo__internal_field_count__Object = ObjectTemplateInfo::kInternalFieldCountOffset;
+int v8dbg_class_SignatureInfo__receiver__Object = SignatureInfo::kReceiverOffset;
+int v8dbg_class_SignatureInfo__args__Object = SignatureInfo::kArgsOffset;
+int v8dbg_class_TypeSwitchInfo__types__Object = TypeSwitchInfo::kTypesOffset;
+int v8dbg_class_AllocationSite__transition_info__Object = AllocationSite::kTransitionInfoOffset;
+int v8dbg_class_AllocationSite__weak_next__Object = AllocationSite::kWeakNextOffset;
+int v8dbg_class_AllocationMemento__allocation_site__Object = AllocationMemento::kAllocationSiteOffset;
+int v8dbg_class_Script__source__Object = Script::kSourceOffset;
+int v8dbg_class_Script__name__Object = Script::kNameOffset;
+int v8dbg_class_Script__id__Smi = Script::kIdOffset;
+int v8dbg_class_Script__data__Object = Script::kDataOffset;
+int v8dbg_class_Script__context_data__Object = Script::kContextOffset;
+int v8dbg_class_Script__wrapper__Foreign = Script::kWrapperOffset;
+int v8dbg_class_Script__line_ends__Object = Script::kLineEndsOffset;
+int v8dbg_class_Script__eval_from_shared__Object = Script::kEvalFromSharedOffset;
+int v8dbg_class_DebugInfo__shared__SharedFunctionInfo = DebugInfo::kSharedFunctionInfoIndex;
+int v8dbg_class_DebugInfo__original_code__Code = DebugInfo::kOriginalCodeIndex;
+int v8dbg_class_DebugInfo__code__Code = DebugInfo::kPatchedCodeIndex;
+int v8dbg_class_DebugInfo__break_points__FixedArray = DebugInfo::kBreakPointsStateIndex;
+int v8dbg_class_BreakPointInfo__break_point_objects__Object = BreakPointInfo::kBreakPointObjectsIndex;
+int v8dbg_class_SharedFunctionInfo__name__Object = SharedFunctionInfo::kNameOffset;
+int v8dbg_class_SharedFunctionInfo__optimized_code_map__Object = SharedFunctionInfo::kOptimizedCodeMapOffset;
+int v8dbg_class_SharedFunctionInfo__construct_stub__Code = SharedFunctionInfo::kConstructStubOffset;
+int v8dbg_class_SharedFunctionInfo__initial_map__Object = SharedFunctionInfo::kInitialMapOffset;
+int v8dbg_class_SharedFunctionInfo__instance_class_name__Object = SharedFunctionInfo::kInstanceClassNameOffset;
+int v8dbg_class_SharedFunctionInfo__function_data__Object = SharedFunctionInfo::kFunctionDataOffset;
+int v8dbg_class_SharedFunctionInfo__script__Object = SharedFunctionInfo::kScriptOffset;
+int v8dbg_class_SharedFunctionInfo__debug_info__Object = SharedFunctionInfo::kDebugInfoOffset;
+int v8dbg_class_SharedFunctionInfo__inferred_name__String = SharedFunctionInfo::kInferredNameOffset;
+int v8dbg_class_SharedFunctionInfo__ast_node_count__SMI = SharedFunctionInfo::kAstNodeCountOffset;
+int v8dbg_class_FunctionTemplateInfo__length__SMI = FunctionTemplateInfo::kLengthOffset;
+int v8dbg_class_SharedFunctionInfo__length__SMI = SharedFunctionInfo::kLengthOffset;
+int v8dbg_class_SharedFunctionInfo__formal_parameter_count__SMI = SharedFunctionInfo::kFormalParameterCountOffset;
+int v8dbg_class_SharedFunctionInfo__expected_nof_properties__SMI = SharedFunctionInfo::kExpectedNofPropertiesOffset;
+int v8dbg_class_SharedFunctionInfo__num_literals__SMI = SharedFunctionInfo::kNumLiteralsOffset;
+int v8dbg_class_SharedFunctionInfo__start_position_and_type__SMI = SharedFunctionInfo::kStartPositionAndTypeOffset;
+int v8dbg_class_SharedFunctionInfo__end_position__SMI = SharedFunctionInfo::kEndPositionOffset;
+int v8dbg_class_SharedFunctionInfo__function_token_position__SMI = SharedFunctionInfo::kFunctionTokenPositionOffset;
+int v8dbg_class_SharedFunctionInfo__compiler_hints__SMI = SharedFunctionInfo::kCompilerHintsOffset;
+int v8dbg_class_SharedFunctionInfo__opt_count__SMI = SharedFunctionInfo::kOptCountOffset;
+int v8dbg_class_SharedFunctionInfo__counters__SMI = SharedFunctionInfo::kCountersOffset;
+int v8dbg_class_CodeCache__default_cache__FixedArray = CodeCache::kDefaultCacheOffset;
+int v8dbg_class_CodeCache__normal_type_cache__Object = CodeCache::kNormalTypeCacheOffset;
+int v8dbg_class_PolymorphicCodeCache__cache__Object = PolymorphicCodeCache::kCacheOffset;
+int v8dbg_class_JSFunction__prototype_or_initial_map__Object = JSFunction::kPrototypeOrInitialMapOffset;
+int v8dbg_class_JSProxy__handler__Object = JSProxy::kHandlerOffset;
+int v8dbg_class_JSProxy__hash__Object = JSProxy::kHashOffset;
+int v8dbg_class_JSFunctionProxy__call_trap__Object = JSFunctionProxy::kCallTrapOffset;
+int v8dbg_class_JSFunctionProxy__construct_trap__Object = JSFunctionProxy::kConstructTrapOffset;
+int v8dbg_class_JSSet__table__Object = JSSet::kTableOffset;
+int v8dbg_class_JSMap__table__Object = JSMap::kTableOffset;
+int v8dbg_class_JSWeakCollection__table__Object = JSWeakCollection::kTableOffset;
+int v8dbg_class_JSWeakCollection__next__Object = JSWeakCollection::kNextOffset;
+int v8dbg_class_JSGeneratorObject__function__JSFunction = JSGeneratorObject::kFunctionOffset;
+int v8dbg_class_JSGeneratorObject__context__Context = JSGeneratorObject::kContextOffset;
+int v8dbg_class_JSGeneratorObject__receiver__Object = JSGeneratorObject::kReceiverOffset;
+int v8dbg_class_JSGeneratorObject__continuation__SMI = JSGeneratorObject::kContinuationOffset;
+int v8dbg_class_JSGeneratorObject__operand_stack__FixedArray = JSGeneratorObject::kOperandStackOffset;
+int v8dbg_class_JSGeneratorObject__stack_handler_index__SMI = JSGeneratorObject::kStackHandlerIndexOffset;
+int v8dbg_class_JSModule__context__Object = JSModule::kContextOffset;
+int v8dbg_class_JSModule__scope_info__ScopeInfo = JSModule::kScopeInfoOffset;
+int v8dbg_class_JSValue__value__Object = JSValue::kValueOffset;
+int v8dbg_class_JSDate__value__Object = JSDate::kValueOffset;
+int v8dbg_class_JSDate__cache_stamp__Object = JSDate::kCacheStampOffset;
+int v8dbg_class_JSDate__year__Object = JSDate::kYearOffset;
+int v8dbg_class_JSDate__month__Object = JSDate::kMonthOffset;
+int v8dbg_class_JSDate__day__Object = JSDate::kDayOffset;
+int v8dbg_class_JSDate__weekday__Object = JSDate::kWeekdayOffset;
+int v8dbg_class_JSDate__hour__Object = JSDate::kHourOffset;
+int v8dbg_class_JSDate__min__Object = JSDate::kMinOffset;
+int v8dbg_class_JSDate__sec__Object = JSDate::kSecOffset;
+int v8dbg_class_JSMessageObject__type__String = JSMessageObject::kTypeOffset;
+int v8dbg_class_JSMessageObject__arguments__JSArray = JSMessageObject::kArgumentsOffset;
+int v8dbg_class_JSMessageObject__script__Object = JSMessageObject::kScriptOffset;
+int v8dbg_class_JSMessageObject__stack_trace__Object = JSMessageObject::kStackTraceOffset;
+int v8dbg_class_JSMessageObject__stack_frames__Object = JSMessageObject::kStackFramesOffset;
+int v8dbg_class_JSMessageObject__start_position__SMI = JSMessageObject::kStartPositionOffset;
+int v8dbg_class_JSMessageObject__end_position__SMI = JSMessageObject::kEndPositionOffset;
+int v8dbg_class_Code__relocation_info__ByteArray = Code::kRelocationInfoOffset;
+int v8dbg_class_Code__handler_table__FixedArray = Code::kHandlerTableOffset;
+int v8dbg_class_Code__deoptimization_data__FixedArray = Code::kDeoptimizationDataOffset;
+int v8dbg_class_Code__gc_metadata__Object = Code::kGCMetadataOffset;
+int v8dbg_class_JSArray__length__Object = JSArray::kLengthOffset;
+int v8dbg_class_JSArrayBuffer__byte_length__Object = JSArrayBuffer::kByteLengthOffset;
+int v8dbg_class_JSArrayBuffer__weak_next__Object = JSArrayBuffer::kWeakNextOffset;
+int v8dbg_class_JSArrayBuffer__weak_first_view__Object = JSArrayBuffer::kWeakFirstViewOffset;
+int v8dbg_class_JSArrayBufferView__buffer__Object = JSArrayBufferView::kBufferOffset;
+int v8dbg_class_JSArrayBufferView__byte_offset__Object = JSArrayBufferView::kByteOffsetOffset;
+int v8dbg_class_JSArrayBufferView__byte_length__Object = JSArrayBufferView::kByteLengthOffset;
+int v8dbg_class_JSArrayBufferView__weak_next__Object = JSArrayBufferView::kWeakNextOffset;
+int v8dbg_class_JSTypedArray__length__Object = JSTypedArray::kLengthOffset;
+int v8dbg_class_JSRegExp__data__Object = JSRegExp::kDataOffset;
+int v8dbg_class_TypeFeedbackInfo__type_feedback_cells__TypeFeedbackCells = TypeFeedbackInfo::kTypeFeedbackCellsOffset;
+int v8dbg_class_AliasedArgumentsEntry__aliased_context_slot__SMI = AliasedArgumentsEntry::kAliasedContextSlot;
+int v8dbg_class_HeapObject__map__Map = HeapObject::kMapOffset;
+int v8dbg_class_JSObject__elements__Object = JSObject::kElementsOffset;
+int v8dbg_class_FixedArray__data__uintptr_t = FixedArray::kHeaderSize;
+int v8dbg_class_Map__instance_attributes__int = Map::kInstanceAttributesOffset;
+int v8dbg_class_Map__inobject_properties__int = Map::kInObjectPropertiesOffset;
+int v8dbg_class_Map__instance_size__int = Map::kInstanceSizeOffset;
+int v8dbg_class_HeapNumber__value__double = HeapNumber::kValueOffset;
+int v8dbg_class_ConsString__first__String = ConsString::kFirstOffset;
+int v8dbg_class_ConsString__second__String = ConsString::kSecondOffset;
+int v8dbg_class_ExternalString__resource__Object = ExternalString::kResourceOffset;
+int v8dbg_class_SeqOneByteString__chars__char = SeqOneByteString::kHeaderSize;
+int v8dbg_class_SharedFunctionInfo__code__Code = SharedFunctionInfo::kCodeOffset;
+int v8dbg_class_Code__instruction_start__uintptr_t = Code::kHeaderSize;
+int v8dbg_class_Code__instruction_size__int = Code::kInstructionSizeOffset;
+
+
+}
@@ -0,0 +1,90 @@
+// Copyright 2011 Google Inc. All Rights Reserved.
+
+// This file was generated from .js source files by GYP.  If you
+// want to make changes to this file you should either change the
+// javascript source files or the GYP script.
+
+#include "v8.h"
+#include "natives.h"
+#include "utils.h"
+
+namespace v8 {
+namespace internal {
+
+  static const byte sources[] = { 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 34, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 34, 59, 10, 10, 10, 10, 10, 10, 118, 97, 114, 32, 36, 83, 121, 109, 98, 111, 108, 61, 103, 108, 111, 98, 97, 108, 46, 83, 121, 109, 98, 111, 108, 59, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 121, 109, 98, 111, 108, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 10, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 63, 97, 58, 37, 67, 114, 101, 97, 116, 101, 83, 121, 109, 98, 111, 108, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 63, 97, 58, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 37, 95, 83, 101, 116, 86, 97, 108, 117, 101, 79, 102, 40, 116, 104, 105, 115, 44, 98, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 121, 109, 98, 111, 108, 71, 101, 116, 78, 97, 109, 101, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 83, 121, 109, 98, 111, 108, 39, 41, 63, 37, 95, 86, 97, 108, 117, 101, 79, 102, 40, 116, 104, 105, 115, 41, 58, 116, 104, 105, 115, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 10, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 91, 34, 83, 121, 109, 98, 111, 108, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 110, 97, 109, 101, 34, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 121, 109, 98, 111, 108, 78, 97, 109, 101, 40, 97, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 121, 109, 98, 111, 108, 84, 111, 83, 116, 114, 105, 110, 103, 40, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 115, 121, 109, 98, 111, 108, 95, 116, 111, 95, 115, 116, 114, 105, 110, 103, 39, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 121, 109, 98, 111, 108, 86, 97, 108, 117, 101, 79, 102, 40, 41, 123, 10, 10, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 38, 38, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 83, 121, 109, 98, 111, 108, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 10, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 91, 34, 83, 121, 109, 98, 111, 108, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 118, 97, 108, 117, 101, 79, 102, 34, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 95, 86, 97, 108, 117, 101, 79, 102, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 85, 112, 83, 121, 109, 98, 111, 108, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 36, 83, 121, 109, 98, 111, 108, 44, 83, 121, 109, 98, 111, 108, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 36, 83, 121, 109, 98, 111, 108, 44, 110, 101, 119, 32, 36, 83, 121, 109, 98, 111, 108, 40, 41, 41, 59, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 36, 83, 121, 109, 98, 111, 108, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 34, 44, 36, 83, 121, 109, 98, 111, 108, 44, 50, 41, 59, 10, 10, 73, 110, 115, 116, 97, 108, 108, 71, 101, 116, 116, 101, 114, 40, 36, 83, 121, 109, 98, 111, 108, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 110, 97, 109, 101, 34, 44, 83, 121, 109, 98, 111, 108, 71, 101, 116, 78, 97, 109, 101, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 83, 121, 109, 98, 111, 108, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 116, 111, 83, 116, 114, 105, 110, 103, 34, 44, 83, 121, 109, 98, 111, 108, 84, 111, 83, 116, 114, 105, 110, 103, 44, 10, 34, 118, 97, 108, 117, 101, 79, 102, 34, 44, 83, 121, 109, 98, 111, 108, 86, 97, 108, 117, 101, 79, 102, 10, 41, 41, 59, 10, 125, 10, 10, 83, 101, 116, 85, 112, 83, 121, 109, 98, 111, 108, 40, 41, 59, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 34, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 34, 59, 10, 10, 10, 10, 10, 10, 118, 97, 114, 32, 36, 80, 114, 111, 120, 121, 61, 110, 101, 119, 32, 36, 79, 98, 106, 101, 99, 116, 40, 41, 59, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 80, 114, 111, 120, 121, 67, 114, 101, 97, 116, 101, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 104, 97, 110, 100, 108, 101, 114, 95, 110, 111, 110, 95, 111, 98, 106, 101, 99, 116, 34, 44, 91, 34, 99, 114, 101, 97, 116, 101, 34, 93, 41, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 10, 98, 61, 110, 117, 108, 108, 10, 101, 108, 115, 101, 32, 105, 102, 40, 33, 40, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 98, 41, 41, 124, 124, 98, 61, 61, 61, 110, 117, 108, 108, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 112, 114, 111, 116, 111, 95, 110, 111, 110, 95, 111, 98, 106, 101, 99, 116, 34, 44, 91, 34, 99, 114, 101, 97, 116, 101, 34, 93, 41, 10, 114, 101, 116, 117, 114, 110, 32, 37, 67, 114, 101, 97, 116, 101, 74, 83, 80, 114, 111, 120, 121, 40, 97, 44, 98, 41, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 80, 114, 111, 120, 121, 67, 114, 101, 97, 116, 101, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 98, 44, 99, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 104, 97, 110, 100, 108, 101, 114, 95, 110, 111, 110, 95, 111, 98, 106, 101, 99, 116, 34, 44, 91, 34, 99, 114, 101, 97, 116, 101, 34, 93, 41, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 98, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 116, 114, 97, 112, 95, 102, 117, 110, 99, 116, 105, 111, 110, 95, 101, 120, 112, 101, 99, 116, 101, 100, 34, 44, 91, 34, 99, 114, 101, 97, 116, 101, 70, 117, 110, 99, 116, 105, 111, 110, 34, 44, 34, 99, 97, 108, 108, 34, 93, 41, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 99, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 99, 61, 68, 101, 114, 105, 118, 101, 100, 67, 111, 110, 115, 116, 114, 117, 99, 116, 84, 114, 97, 112, 40, 98, 41, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 99, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 10, 118, 97, 114, 32, 100, 61, 99, 10, 99, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 65, 112, 112, 108, 121, 40, 100, 44, 118, 111, 105, 100, 32, 48, 44, 97, 114, 103, 117, 109, 101, 110, 116, 115, 44, 48, 44, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 41, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 116, 114, 97, 112, 95, 102, 117, 110, 99, 116, 105, 111, 110, 95, 101, 120, 112, 101, 99, 116, 101, 100, 34, 44, 10, 91, 34, 99, 114, 101, 97, 116, 101, 70, 117, 110, 99, 116, 105, 111, 110, 34, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 34, 93, 41, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 67, 114, 101, 97, 116, 101, 74, 83, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114, 111, 120, 121, 40, 10, 97, 44, 98, 44, 99, 44, 36, 70, 117, 110, 99, 116, 105, 111, 110, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 85, 112, 80, 114, 111, 120, 121, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 10, 10, 103, 108, 111, 98, 97, 108, 46, 80, 114, 111, 120, 121, 61, 36, 80, 114, 111, 120, 121, 59, 10, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 80, 114, 111, 120, 121, 44, 50, 44, 91, 10, 34, 99, 114, 101, 97, 116, 101, 34, 44, 80, 114, 111, 120, 121, 67, 114, 101, 97, 116, 101, 44, 10, 34, 99, 114, 101, 97, 116, 101, 70, 117, 110, 99, 116, 105, 111, 110, 34, 44, 80, 114, 111, 120, 121, 67, 114, 101, 97, 116, 101, 70, 117, 110, 99, 116, 105, 111, 110, 10, 93, 41, 10, 125, 10, 10, 83, 101, 116, 85, 112, 80, 114, 111, 120, 121, 40, 41, 59, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 114, 105, 118, 101, 100, 67, 111, 110, 115, 116, 114, 117, 99, 116, 84, 114, 97, 112, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 118, 97, 114, 32, 98, 61, 116, 104, 105, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 98, 41, 41, 41, 98, 61, 36, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 10, 118, 97, 114, 32, 99, 61, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 98, 125, 59, 10, 118, 97, 114, 32, 100, 61, 37, 65, 112, 112, 108, 121, 40, 97, 44, 99, 44, 97, 114, 103, 117, 109, 101, 110, 116, 115, 44, 48, 44, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 41, 59, 10, 114, 101, 116, 117, 114, 110, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 100, 41, 41, 63, 100, 58, 99, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 108, 101, 103, 97, 116, 101, 67, 97, 108, 108, 65, 110, 100, 67, 111, 110, 115, 116, 114, 117, 99, 116, 40, 97, 44, 98, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 65, 112, 112, 108, 121, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 63, 98, 58, 97, 44, 10, 116, 104, 105, 115, 44, 97, 114, 103, 117, 109, 101, 110, 116, 115, 44, 48, 44, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 41, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 114, 105, 118, 101, 100, 71, 101, 116, 84, 114, 97, 112, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 116, 104, 105, 115, 46, 103, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101, 115, 99, 114, 105, 112, 116, 111, 114, 40, 98, 41, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 99, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 114, 101, 116, 117, 114, 110, 32, 99, 125, 10, 105, 102, 40, 39, 118, 97, 108, 117, 101, 39, 105, 110, 32, 99, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 99, 46, 118, 97, 108, 117, 101, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 99, 46, 103, 101, 116, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 114, 101, 116, 117, 114, 110, 32, 99, 46, 103, 101, 116, 125, 10, 10, 114, 101, 116, 117, 114, 110, 32, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 99, 46, 103, 101, 116, 41, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 114, 105, 118, 101, 100, 83, 101, 116, 84, 114, 97, 112, 40, 97, 44, 98, 44, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 116, 104, 105, 115, 46, 103, 101, 116, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101, 115, 99, 114, 105, 112, 116, 111, 114, 40, 98, 41, 10, 105, 102, 40, 100, 41, 123, 10, 105, 102, 40, 39, 119, 114, 105, 116, 97, 98, 108, 101, 39, 105, 110, 32, 100, 41, 123, 10, 105, 102, 40, 100, 46, 119, 114, 105, 116, 97, 98, 108, 101, 41, 123, 10, 100, 46, 118, 97, 108, 117, 101, 61, 99, 10, 116, 104, 105, 115, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 44, 100, 41, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 100, 46, 115, 101, 116, 41, 123, 10, 10, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 99, 44, 100, 46, 115, 101, 116, 41, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 10, 125, 10, 125, 10, 125, 10, 100, 61, 116, 104, 105, 115, 46, 103, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101, 115, 99, 114, 105, 112, 116, 111, 114, 40, 98, 41, 10, 105, 102, 40, 100, 41, 123, 10, 105, 102, 40, 39, 119, 114, 105, 116, 97, 98, 108, 101, 39, 105, 110, 32, 100, 41, 123, 10, 105, 102, 40, 100, 46, 119, 114, 105, 116, 97, 98, 108, 101, 41, 123, 10, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 100, 46, 115, 101, 116, 41, 123, 10, 10, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 99, 44, 100, 46, 115, 101, 116, 41, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 10, 125, 10, 125, 10, 125, 10, 116, 104, 105, 115, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 44, 123, 10, 118, 97, 108, 117, 101, 58, 99, 44, 10, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 114, 105, 118, 101, 100, 72, 97, 115, 84, 114, 97, 112, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 33, 33, 116, 104, 105, 115, 46, 103, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101, 115, 99, 114, 105, 112, 116, 111, 114, 40, 97, 41, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 114, 105, 118, 101, 100, 72, 97, 115, 79, 119, 110, 84, 114, 97, 112, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 33, 33, 116, 104, 105, 115, 46, 103, 101, 116, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101, 115, 99, 114, 105, 112, 116, 111, 114, 40, 97, 41, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 114, 105, 118, 101, 100, 75, 101, 121, 115, 84, 114, 97, 112, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 116, 104, 105, 115, 46, 103, 101, 116, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 78, 97, 109, 101, 115, 40, 41, 10, 118, 97, 114, 32, 98, 61, 91, 93, 10, 102, 111, 114, 40, 118, 97, 114, 32, 99, 61, 48, 44, 99, 111, 117, 110, 116, 61, 48, 59, 99, 60, 97, 46, 108, 101, 110, 103, 116, 104, 59, 43, 43, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 97, 91, 99, 93, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 100, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 41, 99, 111, 110, 116, 105, 110, 117, 101, 10, 118, 97, 114, 32, 101, 61, 116, 104, 105, 115, 46, 103, 101, 116, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101, 115, 99, 114, 105, 112, 116, 111, 114, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 100, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 100, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 100, 41, 41, 41, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 101, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 38, 38, 101, 46, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 41, 123, 10, 98, 91, 99, 111, 117, 110, 116, 43, 43, 93, 61, 97, 91, 99, 93, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 114, 105, 118, 101, 100, 69, 110, 117, 109, 101, 114, 97, 116, 101, 84, 114, 97, 112, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 116, 104, 105, 115, 46, 103, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 78, 97, 109, 101, 115, 40, 41, 10, 118, 97, 114, 32, 98, 61, 91, 93, 10, 102, 111, 114, 40, 118, 97, 114, 32, 99, 61, 48, 44, 99, 111, 117, 110, 116, 61, 48, 59, 99, 60, 97, 46, 108, 101, 110, 103, 116, 104, 59, 43, 43, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 97, 91, 99, 93, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 100, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 41, 99, 111, 110, 116, 105, 110, 117, 101, 10, 118, 97, 114, 32, 101, 61, 116, 104, 105, 115, 46, 103, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101, 115, 99, 114, 105, 112, 116, 111, 114, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 100, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 100, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 100, 41, 41, 41, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 101, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 105, 102, 40, 33, 101, 46, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 112, 114, 111, 120, 121, 95, 112, 114, 111, 112, 95, 110, 111, 116, 95, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 34, 44, 10, 91, 116, 104, 105, 115, 44, 34, 103, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101, 115, 99, 114, 105, 112, 116, 111, 114, 34, 44, 100, 93, 41, 10, 125, 10, 105, 102, 40, 101, 46, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 41, 98, 91, 99, 111, 117, 110, 116, 43, 43, 93, 61, 97, 91, 99, 93, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 80, 114, 111, 120, 121, 69, 110, 117, 109, 101, 114, 97, 116, 101, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 37, 71, 101, 116, 72, 97, 110, 100, 108, 101, 114, 40, 97, 41, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 98, 46, 101, 110, 117, 109, 101, 114, 97, 116, 101, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 65, 112, 112, 108, 121, 40, 68, 101, 114, 105, 118, 101, 100, 69, 110, 117, 109, 101, 114, 97, 116, 101, 84, 114, 97, 112, 44, 98, 44, 91, 93, 44, 48, 44, 48, 41, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 84, 111, 78, 97, 109, 101, 65, 114, 114, 97, 121, 40, 98, 46, 101, 110, 117, 109, 101, 114, 97, 116, 101, 40, 41, 44, 34, 101, 110, 117, 109, 101, 114, 97, 116, 101, 34, 44, 102, 97, 108, 115, 101, 41, 10, 125, 10, 125, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 34, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 34, 59, 10, 10, 10, 10, 10, 10, 118, 97, 114, 32, 36, 83, 101, 116, 61, 103, 108, 111, 98, 97, 108, 46, 83, 101, 116, 59, 10, 118, 97, 114, 32, 36, 77, 97, 112, 61, 103, 108, 111, 98, 97, 108, 46, 77, 97, 112, 59, 10, 118, 97, 114, 32, 36, 87, 101, 97, 107, 77, 97, 112, 61, 103, 108, 111, 98, 97, 108, 46, 87, 101, 97, 107, 77, 97, 112, 59, 10, 118, 97, 114, 32, 36, 87, 101, 97, 107, 83, 101, 116, 61, 103, 108, 111, 98, 97, 108, 46, 87, 101, 97, 107, 83, 101, 116, 59, 10, 10, 10, 10, 118, 97, 114, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 95, 115, 101, 110, 116, 105, 110, 101, 108, 61, 123, 125, 59, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 37, 83, 101, 116, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 40, 116, 104, 105, 115, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 95, 110, 111, 116, 95, 102, 117, 110, 99, 116, 105, 111, 110, 39, 44, 91, 39, 83, 101, 116, 39, 93, 41, 59, 10, 125, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 65, 100, 100, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 83, 101, 116, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 83, 101, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 97, 100, 100, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 97, 61, 117, 110, 100, 101, 102, 105, 110, 101, 100, 95, 115, 101, 110, 116, 105, 110, 101, 108, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 101, 116, 65, 100, 100, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 72, 97, 115, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 83, 101, 116, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 83, 101, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 97, 61, 117, 110, 100, 101, 102, 105, 110, 101, 100, 95, 115, 101, 110, 116, 105, 110, 101, 108, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 101, 116, 72, 97, 115, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 68, 101, 108, 101, 116, 101, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 83, 101, 116, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 83, 101, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 108, 101, 116, 101, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 97, 61, 117, 110, 100, 101, 102, 105, 110, 101, 100, 95, 115, 101, 110, 116, 105, 110, 101, 108, 59, 10, 125, 10, 105, 102, 40, 37, 83, 101, 116, 72, 97, 115, 40, 116, 104, 105, 115, 44, 97, 41, 41, 123, 10, 37, 83, 101, 116, 68, 101, 108, 101, 116, 101, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 71, 101, 116, 83, 105, 122, 101, 40, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 83, 101, 116, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 83, 101, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 105, 122, 101, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 101, 116, 71, 101, 116, 83, 105, 122, 101, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 67, 108, 101, 97, 114, 40, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 83, 101, 116, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 83, 101, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 101, 97, 114, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 10, 37, 83, 101, 116, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 85, 112, 83, 101, 116, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 36, 83, 101, 116, 44, 83, 101, 116, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 36, 83, 101, 116, 44, 110, 101, 119, 32, 36, 79, 98, 106, 101, 99, 116, 40, 41, 41, 59, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 36, 83, 101, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 34, 44, 36, 83, 101, 116, 44, 50, 41, 59, 10, 10, 10, 73, 110, 115, 116, 97, 108, 108, 71, 101, 116, 116, 101, 114, 40, 36, 83, 101, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 115, 105, 122, 101, 34, 44, 83, 101, 116, 71, 101, 116, 83, 105, 122, 101, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 83, 101, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 97, 100, 100, 34, 44, 83, 101, 116, 65, 100, 100, 44, 10, 34, 104, 97, 115, 34, 44, 83, 101, 116, 72, 97, 115, 44, 10, 34, 100, 101, 108, 101, 116, 101, 34, 44, 83, 101, 116, 68, 101, 108, 101, 116, 101, 44, 10, 34, 99, 108, 101, 97, 114, 34, 44, 83, 101, 116, 67, 108, 101, 97, 114, 10, 41, 41, 59, 10, 125, 10, 10, 83, 101, 116, 85, 112, 83, 101, 116, 40, 41, 59, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 112, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 37, 77, 97, 112, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 40, 116, 104, 105, 115, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 95, 110, 111, 116, 95, 102, 117, 110, 99, 116, 105, 111, 110, 39, 44, 91, 39, 77, 97, 112, 39, 93, 41, 59, 10, 125, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 112, 71, 101, 116, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 77, 97, 112, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 103, 101, 116, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 97, 61, 117, 110, 100, 101, 102, 105, 110, 101, 100, 95, 115, 101, 110, 116, 105, 110, 101, 108, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 77, 97, 112, 71, 101, 116, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 112, 83, 101, 116, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 77, 97, 112, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 101, 116, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 97, 61, 117, 110, 100, 101, 102, 105, 110, 101, 100, 95, 115, 101, 110, 116, 105, 110, 101, 108, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 77, 97, 112, 83, 101, 116, 40, 116, 104, 105, 115, 44, 97, 44, 98, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 112, 72, 97, 115, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 77, 97, 112, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 97, 61, 117, 110, 100, 101, 102, 105, 110, 101, 100, 95, 115, 101, 110, 116, 105, 110, 101, 108, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 77, 97, 112, 72, 97, 115, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 112, 68, 101, 108, 101, 116, 101, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 77, 97, 112, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 108, 101, 116, 101, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 97, 61, 117, 110, 100, 101, 102, 105, 110, 101, 100, 95, 115, 101, 110, 116, 105, 110, 101, 108, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 77, 97, 112, 68, 101, 108, 101, 116, 101, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 112, 71, 101, 116, 83, 105, 122, 101, 40, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 77, 97, 112, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 105, 122, 101, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 77, 97, 112, 71, 101, 116, 83, 105, 122, 101, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 112, 67, 108, 101, 97, 114, 40, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 77, 97, 112, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 101, 97, 114, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 10, 37, 77, 97, 112, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 85, 112, 77, 97, 112, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 36, 77, 97, 112, 44, 77, 97, 112, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 36, 77, 97, 112, 44, 110, 101, 119, 32, 36, 79, 98, 106, 101, 99, 116, 40, 41, 41, 59, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 36, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 34, 44, 36, 77, 97, 112, 44, 50, 41, 59, 10, 10, 10, 73, 110, 115, 116, 97, 108, 108, 71, 101, 116, 116, 101, 114, 40, 36, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 115, 105, 122, 101, 34, 44, 77, 97, 112, 71, 101, 116, 83, 105, 122, 101, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 103, 101, 116, 34, 44, 77, 97, 112, 71, 101, 116, 44, 10, 34, 115, 101, 116, 34, 44, 77, 97, 112, 83, 101, 116, 44, 10, 34, 104, 97, 115, 34, 44, 77, 97, 112, 72, 97, 115, 44, 10, 34, 100, 101, 108, 101, 116, 101, 34, 44, 77, 97, 112, 68, 101, 108, 101, 116, 101, 44, 10, 34, 99, 108, 101, 97, 114, 34, 44, 77, 97, 112, 67, 108, 101, 97, 114, 10, 41, 41, 59, 10, 125, 10, 10, 83, 101, 116, 85, 112, 77, 97, 112, 40, 41, 59, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 87, 101, 97, 107, 77, 97, 112, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 37, 87, 101, 97, 107, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 40, 116, 104, 105, 115, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 95, 110, 111, 116, 95, 102, 117, 110, 99, 116, 105, 111, 110, 39, 44, 91, 39, 87, 101, 97, 107, 77, 97, 112, 39, 93, 41, 59, 10, 125, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 87, 101, 97, 107, 77, 97, 112, 71, 101, 116, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 87, 101, 97, 107, 77, 97, 112, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 87, 101, 97, 107, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 103, 101, 116, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 33, 40, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 124, 124, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 119, 101, 97, 107, 109, 97, 112, 95, 107, 101, 121, 39, 44, 91, 116, 104, 105, 115, 44, 97, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 87, 101, 97, 107, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 71, 101, 116, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 87, 101, 97, 107, 77, 97, 112, 83, 101, 116, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 87, 101, 97, 107, 77, 97, 112, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 87, 101, 97, 107, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 101, 116, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 33, 40, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 124, 124, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 119, 101, 97, 107, 109, 97, 112, 95, 107, 101, 121, 39, 44, 91, 116, 104, 105, 115, 44, 97, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 87, 101, 97, 107, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 83, 101, 116, 40, 116, 104, 105, 115, 44, 97, 44, 98, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 87, 101, 97, 107, 77, 97, 112, 72, 97, 115, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 87, 101, 97, 107, 77, 97, 112, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 87, 101, 97, 107, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 33, 40, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 124, 124, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 119, 101, 97, 107, 109, 97, 112, 95, 107, 101, 121, 39, 44, 91, 116, 104, 105, 115, 44, 97, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 87, 101, 97, 107, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 72, 97, 115, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 87, 101, 97, 107, 77, 97, 112, 68, 101, 108, 101, 116, 101, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 87, 101, 97, 107, 77, 97, 112, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 87, 101, 97, 107, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 108, 101, 116, 101, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 33, 40, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 124, 124, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 119, 101, 97, 107, 109, 97, 112, 95, 107, 101, 121, 39, 44, 91, 116, 104, 105, 115, 44, 97, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 87, 101, 97, 107, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 68, 101, 108, 101, 116, 101, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 87, 101, 97, 107, 77, 97, 112, 67, 108, 101, 97, 114, 40, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 87, 101, 97, 107, 77, 97, 112, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 87, 101, 97, 107, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 101, 97, 114, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 10, 37, 87, 101, 97, 107, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 85, 112, 87, 101, 97, 107, 77, 97, 112, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 36, 87, 101, 97, 107, 77, 97, 112, 44, 87, 101, 97, 107, 77, 97, 112, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 36, 87, 101, 97, 107, 77, 97, 112, 44, 110, 101, 119, 32, 36, 79, 98, 106, 101, 99, 116, 40, 41, 41, 59, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 36, 87, 101, 97, 107, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 34, 44, 36, 87, 101, 97, 107, 77, 97, 112, 44, 50, 41, 59, 10, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 87, 101, 97, 107, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 103, 101, 116, 34, 44, 87, 101, 97, 107, 77, 97, 112, 71, 101, 116, 44, 10, 34, 115, 101, 116, 34, 44, 87, 101, 97, 107, 77, 97, 112, 83, 101, 116, 44, 10, 34, 104, 97, 115, 34, 44, 87, 101, 97, 107, 77, 97, 112, 72, 97, 115, 44, 10, 34, 100, 101, 108, 101, 116, 101, 34, 44, 87, 101, 97, 107, 77, 97, 112, 68, 101, 108, 101, 116, 101, 44, 10, 34, 99, 108, 101, 97, 114, 34, 44, 87, 101, 97, 107, 77, 97, 112, 67, 108, 101, 97, 114, 10, 41, 41, 59, 10, 125, 10, 10, 83, 101, 116, 85, 112, 87, 101, 97, 107, 77, 97, 112, 40, 41, 59, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 87, 101, 97, 107, 83, 101, 116, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 37, 87, 101, 97, 107, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 40, 116, 104, 105, 115, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 95, 110, 111, 116, 95, 102, 117, 110, 99, 116, 105, 111, 110, 39, 44, 91, 39, 87, 101, 97, 107, 83, 101, 116, 39, 93, 41, 59, 10, 125, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 87, 101, 97, 107, 83, 101, 116, 65, 100, 100, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 87, 101, 97, 107, 83, 101, 116, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 87, 101, 97, 107, 83, 101, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 97, 100, 100, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 33, 40, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 124, 124, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 119, 101, 97, 107, 115, 101, 116, 95, 118, 97, 108, 117, 101, 39, 44, 91, 116, 104, 105, 115, 44, 97, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 87, 101, 97, 107, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 83, 101, 116, 40, 116, 104, 105, 115, 44, 97, 44, 116, 114, 117, 101, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 87, 101, 97, 107, 83, 101, 116, 72, 97, 115, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 87, 101, 97, 107, 83, 101, 116, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 87, 101, 97, 107, 83, 101, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 33, 40, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 124, 124, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 119, 101, 97, 107, 115, 101, 116, 95, 118, 97, 108, 117, 101, 39, 44, 91, 116, 104, 105, 115, 44, 97, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 87, 101, 97, 107, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 72, 97, 115, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 87, 101, 97, 107, 83, 101, 116, 68, 101, 108, 101, 116, 101, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 87, 101, 97, 107, 83, 101, 116, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 87, 101, 97, 107, 83, 101, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 108, 101, 116, 101, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 33, 40, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 124, 124, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 119, 101, 97, 107, 115, 101, 116, 95, 118, 97, 108, 117, 101, 39, 44, 91, 116, 104, 105, 115, 44, 97, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 87, 101, 97, 107, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 68, 101, 108, 101, 116, 101, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 87, 101, 97, 107, 83, 101, 116, 67, 108, 101, 97, 114, 40, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 87, 101, 97, 107, 83, 101, 116, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 87, 101, 97, 107, 83, 101, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 101, 97, 114, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 10, 37, 87, 101, 97, 107, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 85, 112, 87, 101, 97, 107, 83, 101, 116, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 36, 87, 101, 97, 107, 83, 101, 116, 44, 87, 101, 97, 107, 83, 101, 116, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 36, 87, 101, 97, 107, 83, 101, 116, 44, 110, 101, 119, 32, 36, 79, 98, 106, 101, 99, 116, 40, 41, 41, 59, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 36, 87, 101, 97, 107, 83, 101, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 34, 44, 36, 87, 101, 97, 107, 83, 101, 116, 44, 50, 41, 59, 10, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 87, 101, 97, 107, 83, 101, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 97, 100, 100, 34, 44, 87, 101, 97, 107, 83, 101, 116, 65, 100, 100, 44, 10, 34, 104, 97, 115, 34, 44, 87, 101, 97, 107, 83, 101, 116, 72, 97, 115, 44, 10, 34, 100, 101, 108, 101, 116, 101, 34, 44, 87, 101, 97, 107, 83, 101, 116, 68, 101, 108, 101, 116, 101, 44, 10, 34, 99, 108, 101, 97, 114, 34, 44, 87, 101, 97, 107, 83, 101, 116, 67, 108, 101, 97, 114, 10, 41, 41, 59, 10, 125, 10, 10, 83, 101, 116, 85, 112, 87, 101, 97, 107, 83, 101, 116, 40, 41, 59, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 34, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 34, 59, 10, 10, 118, 97, 114, 32, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 61, 37, 71, 101, 116, 79, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 40, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 99, 97, 108, 108, 98, 97, 99, 107, 73, 110, 102, 111, 77, 97, 112, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 99, 97, 108, 108, 98, 97, 99, 107, 73, 110, 102, 111, 77, 97, 112, 61, 37, 79, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 87, 101, 97, 107, 77, 97, 112, 67, 114, 101, 97, 116, 101, 40, 41, 59, 10, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 111, 98, 106, 101, 99, 116, 73, 110, 102, 111, 77, 97, 112, 61, 37, 79, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 87, 101, 97, 107, 77, 97, 112, 67, 114, 101, 97, 116, 101, 40, 41, 59, 10, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 110, 111, 116, 105, 102, 105, 101, 114, 84, 97, 114, 103, 101, 116, 77, 97, 112, 61, 37, 79, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 87, 101, 97, 107, 77, 97, 112, 67, 114, 101, 97, 116, 101, 40, 41, 59, 10, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 112, 101, 110, 100, 105, 110, 103, 79, 98, 115, 101, 114, 118, 101, 114, 115, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 59, 10, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 110, 101, 120, 116, 67, 97, 108, 108, 98, 97, 99, 107, 80, 114, 105, 111, 114, 105, 116, 121, 61, 48, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 79, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 87, 101, 97, 107, 77, 97, 112, 40, 97, 41, 123, 10, 116, 104, 105, 115, 46, 109, 97, 112, 95, 61, 97, 59, 10, 125, 10, 10, 79, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 87, 101, 97, 107, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 61, 123, 10, 103, 101, 116, 58, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 97, 61, 37, 85, 110, 119, 114, 97, 112, 71, 108, 111, 98, 97, 108, 80, 114, 111, 120, 121, 40, 97, 41, 59, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 41, 114, 101, 116, 117, 114, 110, 32, 118, 111, 105, 100, 32, 48, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 87, 101, 97, 107, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 71, 101, 116, 40, 116, 104, 105, 115, 46, 109, 97, 112, 95, 44, 97, 41, 59, 10, 125, 44, 10, 115, 101, 116, 58, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 98, 41, 123, 10, 97, 61, 37, 85, 110, 119, 114, 97, 112, 71, 108, 111, 98, 97, 108, 80, 114, 111, 120, 121, 40, 97, 41, 59, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 41, 114, 101, 116, 117, 114, 110, 32, 118, 111, 105, 100, 32, 48, 59, 10, 37, 87, 101, 97, 107, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 83, 101, 116, 40, 116, 104, 105, 115, 46, 109, 97, 112, 95, 44, 97, 44, 98, 41, 59, 10, 125, 44, 10, 104, 97, 115, 58, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 33, 40, 116, 121, 112, 101, 111, 102, 40, 116, 104, 105, 115, 46, 103, 101, 116, 40, 97, 41, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 59, 10, 125, 10, 125, 59, 10, 10, 118, 97, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 73, 110, 102, 111, 77, 97, 112, 61, 10, 110, 101, 119, 32, 79, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 87, 101, 97, 107, 77, 97, 112, 40, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 99, 97, 108, 108, 98, 97, 99, 107, 73, 110, 102, 111, 77, 97, 112, 41, 59, 10, 118, 97, 114, 32, 111, 98, 106, 101, 99, 116, 73, 110, 102, 111, 77, 97, 112, 61, 110, 101, 119, 32, 79, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 87, 101, 97, 107, 77, 97, 112, 40, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 111, 98, 106, 101, 99, 116, 73, 110, 102, 111, 77, 97, 112, 41, 59, 10, 118, 97, 114, 32, 110, 111, 116, 105, 102, 105, 101, 114, 84, 97, 114, 103, 101, 116, 77, 97, 112, 61, 10, 110, 101, 119, 32, 79, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 87, 101, 97, 107, 77, 97, 112, 40, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 110, 111, 116, 105, 102, 105, 101, 114, 84, 97, 114, 103, 101, 116, 77, 97, 112, 41, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 114, 101, 97, 116, 101, 79, 98, 106, 101, 99, 116, 73, 110, 102, 111, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 123, 10, 99, 104, 97, 110, 103, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 58, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 44, 10, 110, 111, 116, 105, 102, 105, 101, 114, 58, 110, 117, 108, 108, 44, 10, 105, 110, 97, 99, 116, 105, 118, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 58, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 44, 10, 112, 101, 114, 102, 111, 114, 109, 105, 110, 103, 58, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117, 108, 108, 125, 44, 10, 112, 101, 114, 102, 111, 114, 109, 105, 110, 103, 67, 111, 117, 110, 116, 58, 48, 44, 10, 125, 59, 10, 111, 98, 106, 101, 99, 116, 73, 110, 102, 111, 77, 97, 112, 46, 115, 101, 116, 40, 97, 44, 98, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 118, 97, 114, 32, 100, 101, 102, 97, 117, 108, 116, 65, 99, 99, 101, 112, 116, 84, 121, 112, 101, 115, 61, 123, 10, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117, 108, 108, 44, 10, 39, 110, 101, 119, 39, 58, 116, 114, 117, 101, 44, 10, 39, 117, 112, 100, 97, 116, 101, 100, 39, 58, 116, 114, 117, 101, 44, 10, 39, 100, 101, 108, 101, 116, 101, 100, 39, 58, 116, 114, 117, 101, 44, 10, 39, 112, 114, 111, 116, 111, 116, 121, 112, 101, 39, 58, 116, 114, 117, 101, 44, 10, 39, 114, 101, 99, 111, 110, 102, 105, 103, 117, 114, 101, 100, 39, 58, 116, 114, 117, 101, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 114, 101, 97, 116, 101, 79, 98, 115, 101, 114, 118, 101, 114, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 123, 10, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117, 108, 108, 44, 10, 99, 97, 108, 108, 98, 97, 99, 107, 58, 97, 44, 10, 97, 99, 99, 101, 112, 116, 58, 100, 101, 102, 97, 117, 108, 116, 65, 99, 99, 101, 112, 116, 84, 121, 112, 101, 115, 10, 125, 59, 10, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 10, 114, 101, 116, 117, 114, 110, 32, 99, 59, 10, 10, 118, 97, 114, 32, 100, 61, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117, 108, 108, 125, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 101, 61, 48, 59, 101, 60, 98, 46, 108, 101, 110, 103, 116, 104, 59, 101, 43, 43, 41, 10, 100, 91, 98, 91, 101, 93, 93, 61, 116, 114, 117, 101, 59, 10, 10, 99, 46, 97, 99, 99, 101, 112, 116, 61, 100, 59, 10, 114, 101, 116, 117, 114, 110, 32, 99, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 79, 98, 115, 101, 114, 118, 101, 114, 73, 115, 65, 99, 116, 105, 118, 101, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 98, 46, 112, 101, 114, 102, 111, 114, 109, 105, 110, 103, 67, 111, 117, 110, 116, 61, 61, 61, 48, 41, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 118, 97, 114, 32, 99, 61, 98, 46, 112, 101, 114, 102, 111, 114, 109, 105, 110, 103, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 100, 32, 105, 110, 32, 99, 41, 123, 10, 105, 102, 40, 99, 91, 100, 93, 62, 48, 38, 38, 97, 46, 97, 99, 99, 101, 112, 116, 91, 100, 93, 41, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 79, 98, 115, 101, 114, 118, 101, 114, 73, 115, 73, 110, 97, 99, 116, 105, 118, 101, 40, 97, 44, 98, 41, 123, 10, 114, 101, 116, 117, 114, 110, 33, 79, 98, 115, 101, 114, 118, 101, 114, 73, 115, 65, 99, 116, 105, 118, 101, 40, 97, 44, 98, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 82, 101, 109, 111, 118, 101, 78, 117, 108, 108, 69, 108, 101, 109, 101, 110, 116, 115, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 48, 59, 10, 118, 97, 114, 32, 99, 61, 48, 59, 10, 102, 111, 114, 40, 59, 98, 60, 97, 46, 108, 101, 110, 103, 116, 104, 59, 98, 43, 43, 41, 123, 10, 105, 102, 40, 97, 91, 98, 93, 61, 61, 61, 110, 117, 108, 108, 41, 10, 99, 111, 110, 116, 105, 110, 117, 101, 59, 10, 105, 102, 40, 99, 60, 98, 41, 10, 97, 91, 99, 93, 61, 97, 91, 98, 93, 59, 10, 99, 43, 43, 59, 10, 125, 10, 10, 105, 102, 40, 98, 33, 61, 61, 99, 41, 10, 97, 46, 108, 101, 110, 103, 116, 104, 61, 97, 46, 108, 101, 110, 103, 116, 104, 45, 40, 98, 45, 99, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 82, 101, 112, 97, 114, 116, 105, 116, 105, 111, 110, 79, 98, 115, 101, 114, 118, 101, 114, 115, 40, 97, 44, 98, 44, 99, 44, 100, 41, 123, 10, 118, 97, 114, 32, 101, 61, 102, 97, 108, 115, 101, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 102, 61, 48, 59, 102, 60, 98, 46, 108, 101, 110, 103, 116, 104, 59, 102, 43, 43, 41, 123, 10, 118, 97, 114, 32, 103, 61, 98, 91, 102, 93, 59, 10, 105, 102, 40, 97, 40, 103, 44, 100, 41, 41, 123, 10, 101, 61, 116, 114, 117, 101, 59, 10, 98, 91, 102, 93, 61, 110, 117, 108, 108, 59, 10, 99, 46, 112, 117, 115, 104, 40, 103, 41, 59, 10, 125, 10, 125, 10, 10, 105, 102, 40, 101, 41, 10, 82, 101, 109, 111, 118, 101, 78, 117, 108, 108, 69, 108, 101, 109, 101, 110, 116, 115, 40, 98, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 66, 101, 103, 105, 110, 80, 101, 114, 102, 111, 114, 109, 67, 104, 97, 110, 103, 101, 40, 97, 44, 98, 41, 123, 10, 97, 46, 112, 101, 114, 102, 111, 114, 109, 105, 110, 103, 91, 98, 93, 61, 40, 97, 46, 112, 101, 114, 102, 111, 114, 109, 105, 110, 103, 91, 98, 93, 124, 124, 48, 41, 43, 49, 59, 10, 97, 46, 112, 101, 114, 102, 111, 114, 109, 105, 110, 103, 67, 111, 117, 110, 116, 43, 43, 59, 10, 82, 101, 112, 97, 114, 116, 105, 116, 105, 111, 110, 79, 98, 115, 101, 114, 118, 101, 114, 115, 40, 79, 98, 115, 101, 114, 118, 101, 114, 73, 115, 73, 110, 97, 99, 116, 105, 118, 101, 44, 10, 97, 46, 99, 104, 97, 110, 103, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 44, 10, 97, 46, 105, 110, 97, 99, 116, 105, 118, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 44, 10, 97, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 110, 100, 80, 101, 114, 102, 111, 114, 109, 67, 104, 97, 110, 103, 101, 40, 97, 44, 98, 41, 123, 10, 97, 46, 112, 101, 114, 102, 111, 114, 109, 105, 110, 103, 91, 98, 93, 45, 45, 59, 10, 97, 46, 112, 101, 114, 102, 111, 114, 109, 105, 110, 103, 67, 111, 117, 110, 116, 45, 45, 59, 10, 82, 101, 112, 97, 114, 116, 105, 116, 105, 111, 110, 79, 98, 115, 101, 114, 118, 101, 114, 115, 40, 79, 98, 115, 101, 114, 118, 101, 114, 73, 115, 65, 99, 116, 105, 118, 101, 44, 10, 97, 46, 105, 110, 97, 99, 116, 105, 118, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 44, 10, 97, 46, 99, 104, 97, 110, 103, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 44, 10, 97, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 110, 115, 117, 114, 101, 79, 98, 115, 101, 114, 118, 101, 114, 82, 101, 109, 111, 118, 101, 100, 40, 97, 44, 98, 41, 123, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 109, 111, 118, 101, 40, 99, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 100, 61, 48, 59, 100, 60, 99, 46, 108, 101, 110, 103, 116, 104, 59, 100, 43, 43, 41, 123, 10, 105, 102, 40, 99, 91, 100, 93, 46, 99, 97, 108, 108, 98, 97, 99, 107, 61, 61, 61, 98, 41, 123, 10, 99, 46, 115, 112, 108, 105, 99, 101, 40, 100, 44, 49, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 10, 105, 102, 40, 33, 114, 101, 109, 111, 118, 101, 40, 97, 46, 99, 104, 97, 110, 103, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 41, 41, 10, 114, 101, 109, 111, 118, 101, 40, 97, 46, 105, 110, 97, 99, 116, 105, 118, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 99, 99, 101, 112, 116, 65, 114, 103, 73, 115, 86, 97, 108, 105, 100, 40, 97, 41, 123, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 124, 124, 10, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 46, 108, 101, 110, 103, 116, 104, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 124, 124, 10, 97, 46, 108, 101, 110, 103, 116, 104, 60, 48, 41, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 10, 118, 97, 114, 32, 98, 61, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 99, 61, 48, 59, 99, 60, 98, 59, 99, 43, 43, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 91, 99, 93, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 41, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 110, 115, 117, 114, 101, 67, 97, 108, 108, 98, 97, 99, 107, 80, 114, 105, 111, 114, 105, 116, 121, 40, 97, 41, 123, 10, 105, 102, 40, 33, 99, 97, 108, 108, 98, 97, 99, 107, 73, 110, 102, 111, 77, 97, 112, 46, 104, 97, 115, 40, 97, 41, 41, 10, 99, 97, 108, 108, 98, 97, 99, 107, 73, 110, 102, 111, 77, 97, 112, 46, 115, 101, 116, 40, 97, 44, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 110, 101, 120, 116, 67, 97, 108, 108, 98, 97, 99, 107, 80, 114, 105, 111, 114, 105, 116, 121, 43, 43, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 78, 111, 114, 109, 97, 108, 105, 122, 101, 67, 97, 108, 108, 98, 97, 99, 107, 73, 110, 102, 111, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 99, 97, 108, 108, 98, 97, 99, 107, 73, 110, 102, 111, 77, 97, 112, 46, 103, 101, 116, 40, 97, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 123, 10, 118, 97, 114, 32, 99, 61, 98, 59, 10, 98, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 59, 10, 98, 46, 112, 114, 105, 111, 114, 105, 116, 121, 61, 99, 59, 10, 99, 97, 108, 108, 98, 97, 99, 107, 73, 110, 102, 111, 77, 97, 112, 46, 115, 101, 116, 40, 97, 44, 98, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 79, 98, 106, 101, 99, 116, 79, 98, 115, 101, 114, 118, 101, 40, 97, 44, 98, 44, 99, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 111, 98, 115, 101, 114, 118, 101, 95, 110, 111, 110, 95, 111, 98, 106, 101, 99, 116, 34, 44, 91, 34, 111, 98, 115, 101, 114, 118, 101, 34, 93, 41, 59, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 98, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 111, 98, 115, 101, 114, 118, 101, 95, 110, 111, 110, 95, 102, 117, 110, 99, 116, 105, 111, 110, 34, 44, 91, 34, 111, 98, 115, 101, 114, 118, 101, 34, 93, 41, 59, 10, 105, 102, 40, 79, 98, 106, 101, 99, 116, 73, 115, 70, 114, 111, 122, 101, 110, 40, 98, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 111, 98, 115, 101, 114, 118, 101, 95, 99, 97, 108, 108, 98, 97, 99, 107, 95, 102, 114, 111, 122, 101, 110, 34, 41, 59, 10, 105, 102, 40, 33, 65, 99, 99, 101, 112, 116, 65, 114, 103, 73, 115, 86, 97, 108, 105, 100, 40, 99, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 111, 98, 115, 101, 114, 118, 101, 95, 97, 99, 99, 101, 112, 116, 95, 105, 110, 118, 97, 108, 105, 100, 34, 41, 59, 10, 10, 69, 110, 115, 117, 114, 101, 67, 97, 108, 108, 98, 97, 99, 107, 80, 114, 105, 111, 114, 105, 116, 121, 40, 98, 41, 59, 10, 10, 118, 97, 114, 32, 100, 61, 111, 98, 106, 101, 99, 116, 73, 110, 102, 111, 77, 97, 112, 46, 103, 101, 116, 40, 97, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 100, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 100, 61, 67, 114, 101, 97, 116, 101, 79, 98, 106, 101, 99, 116, 73, 110, 102, 111, 40, 97, 41, 59, 10, 37, 83, 101, 116, 73, 115, 79, 98, 115, 101, 114, 118, 101, 100, 40, 97, 41, 59, 10, 125, 10, 10, 69, 110, 115, 117, 114, 101, 79, 98, 115, 101, 114, 118, 101, 114, 82, 101, 109, 111, 118, 101, 100, 40, 100, 44, 98, 41, 59, 10, 10, 118, 97, 114, 32, 101, 61, 67, 114, 101, 97, 116, 101, 79, 98, 115, 101, 114, 118, 101, 114, 40, 98, 44, 99, 41, 59, 10, 105, 102, 40, 79, 98, 115, 101, 114, 118, 101, 114, 73, 115, 65, 99, 116, 105, 118, 101, 40, 101, 44, 100, 41, 41, 10, 100, 46, 99, 104, 97, 110, 103, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 46, 112, 117, 115, 104, 40, 101, 41, 59, 10, 101, 108, 115, 101, 10, 100, 46, 105, 110, 97, 99, 116, 105, 118, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 46, 112, 117, 115, 104, 40, 101, 41, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 97, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 79, 98, 106, 101, 99, 116, 85, 110, 111, 98, 115, 101, 114, 118, 101, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 111, 98, 115, 101, 114, 118, 101, 95, 110, 111, 110, 95, 111, 98, 106, 101, 99, 116, 34, 44, 91, 34, 117, 110, 111, 98, 115, 101, 114, 118, 101, 34, 93, 41, 59, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 98, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 111, 98, 115, 101, 114, 118, 101, 95, 110, 111, 110, 95, 102, 117, 110, 99, 116, 105, 111, 110, 34, 44, 91, 34, 117, 110, 111, 98, 115, 101, 114, 118, 101, 34, 93, 41, 59, 10, 10, 118, 97, 114, 32, 99, 61, 111, 98, 106, 101, 99, 116, 73, 110, 102, 111, 77, 97, 112, 46, 103, 101, 116, 40, 97, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 99, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 10, 114, 101, 116, 117, 114, 110, 32, 97, 59, 10, 10, 69, 110, 115, 117, 114, 101, 79, 98, 115, 101, 114, 118, 101, 114, 82, 101, 109, 111, 118, 101, 100, 40, 99, 44, 98, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 97, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 79, 98, 115, 101, 114, 118, 101, 40, 97, 44, 98, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 79, 98, 106, 101, 99, 116, 79, 98, 115, 101, 114, 118, 101, 40, 97, 44, 98, 44, 91, 39, 110, 101, 119, 39, 44, 10, 39, 117, 112, 100, 97, 116, 101, 100, 39, 44, 10, 39, 100, 101, 108, 101, 116, 101, 100, 39, 44, 10, 39, 115, 112, 108, 105, 99, 101, 39, 93, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 85, 110, 111, 98, 115, 101, 114, 118, 101, 40, 97, 44, 98, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 79, 98, 106, 101, 99, 116, 85, 110, 111, 98, 115, 101, 114, 118, 101, 40, 97, 44, 98, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 110, 113, 117, 101, 117, 101, 84, 111, 67, 97, 108, 108, 98, 97, 99, 107, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 78, 111, 114, 109, 97, 108, 105, 122, 101, 67, 97, 108, 108, 98, 97, 99, 107, 73, 110, 102, 111, 40, 97, 41, 59, 10, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 112, 101, 110, 100, 105, 110, 103, 79, 98, 115, 101, 114, 118, 101, 114, 115, 91, 99, 46, 112, 114, 105, 111, 114, 105, 116, 121, 93, 61, 97, 59, 10, 99, 46, 112, 117, 115, 104, 40, 98, 41, 59, 10, 37, 83, 101, 116, 79, 98, 115, 101, 114, 118, 101, 114, 68, 101, 108, 105, 118, 101, 114, 121, 80, 101, 110, 100, 105, 110, 103, 40, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 110, 113, 117, 101, 117, 101, 67, 104, 97, 110, 103, 101, 82, 101, 99, 111, 114, 100, 40, 97, 44, 98, 41, 123, 10, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 46, 110, 97, 109, 101, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 41, 114, 101, 116, 117, 114, 110, 59, 10, 10, 102, 111, 114, 40, 118, 97, 114, 32, 99, 61, 48, 59, 99, 60, 98, 46, 108, 101, 110, 103, 116, 104, 59, 99, 43, 43, 41, 123, 10, 118, 97, 114, 32, 100, 61, 98, 91, 99, 93, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 100, 46, 97, 99, 99, 101, 112, 116, 91, 97, 46, 116, 121, 112, 101, 93, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 10, 99, 111, 110, 116, 105, 110, 117, 101, 59, 10, 10, 69, 110, 113, 117, 101, 117, 101, 84, 111, 67, 97, 108, 108, 98, 97, 99, 107, 40, 100, 46, 99, 97, 108, 108, 98, 97, 99, 107, 44, 97, 41, 59, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 66, 101, 103, 105, 110, 80, 101, 114, 102, 111, 114, 109, 83, 112, 108, 105, 99, 101, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 111, 98, 106, 101, 99, 116, 73, 110, 102, 111, 77, 97, 112, 46, 103, 101, 116, 40, 97, 41, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 10, 66, 101, 103, 105, 110, 80, 101, 114, 102, 111, 114, 109, 67, 104, 97, 110, 103, 101, 40, 98, 44, 39, 115, 112, 108, 105, 99, 101, 39, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 110, 100, 80, 101, 114, 102, 111, 114, 109, 83, 112, 108, 105, 99, 101, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 111, 98, 106, 101, 99, 116, 73, 110, 102, 111, 77, 97, 112, 46, 103, 101, 116, 40, 97, 41, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 10, 69, 110, 100, 80, 101, 114, 102, 111, 114, 109, 67, 104, 97, 110, 103, 101, 40, 98, 44, 39, 115, 112, 108, 105, 99, 101, 39, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 110, 113, 117, 101, 117, 101, 83, 112, 108, 105, 99, 101, 82, 101, 99, 111, 114, 100, 40, 97, 44, 98, 44, 99, 44, 100, 41, 123, 10, 118, 97, 114, 32, 101, 61, 111, 98, 106, 101, 99, 116, 73, 110, 102, 111, 77, 97, 112, 46, 103, 101, 116, 40, 97, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 101, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 101, 46, 99, 104, 97, 110, 103, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 46, 108, 101, 110, 103, 116, 104, 61, 61, 61, 48, 41, 10, 114, 101, 116, 117, 114, 110, 59, 10, 10, 118, 97, 114, 32, 102, 61, 123, 10, 116, 121, 112, 101, 58, 39, 115, 112, 108, 105, 99, 101, 39, 44, 10, 111, 98, 106, 101, 99, 116, 58, 97, 44, 10, 105, 110, 100, 101, 120, 58, 98, 44, 10, 114, 101, 109, 111, 118, 101, 100, 58, 99, 44, 10, 97, 100, 100, 101, 100, 67, 111, 117, 110, 116, 58, 100, 10, 125, 59, 10, 10, 79, 98, 106, 101, 99, 116, 70, 114, 101, 101, 122, 101, 40, 102, 41, 59, 10, 79, 98, 106, 101, 99, 116, 70, 114, 101, 101, 122, 101, 40, 102, 46, 114, 101, 109, 111, 118, 101, 100, 41, 59, 10, 69, 110, 113, 117, 101, 117, 101, 67, 104, 97, 110, 103, 101, 82, 101, 99, 111, 114, 100, 40, 102, 44, 101, 46, 99, 104, 97, 110, 103, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 78, 111, 116, 105, 102, 121, 67, 104, 97, 110, 103, 101, 40, 97, 44, 98, 44, 99, 44, 100, 41, 123, 10, 118, 97, 114, 32, 101, 61, 111, 98, 106, 101, 99, 116, 73, 110, 102, 111, 77, 97, 112, 46, 103, 101, 116, 40, 98, 41, 59, 10, 105, 102, 40, 101, 46, 99, 104, 97, 110, 103, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 46, 108, 101, 110, 103, 116, 104, 61, 61, 61, 48, 41, 10, 114, 101, 116, 117, 114, 110, 59, 10, 10, 118, 97, 114, 32, 102, 61, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 60, 52, 41, 63, 10, 123, 116, 121, 112, 101, 58, 97, 44, 111, 98, 106, 101, 99, 116, 58, 98, 44, 110, 97, 109, 101, 58, 99, 125, 58, 10, 123, 116, 121, 112, 101, 58, 97, 44, 111, 98, 106, 101, 99, 116, 58, 98, 44, 110, 97, 109, 101, 58, 99, 44, 111, 108, 100, 86, 97, 108, 117, 101, 58, 100, 125, 59, 10, 79, 98, 106, 101, 99, 116, 70, 114, 101, 101, 122, 101, 40, 102, 41, 59, 10, 69, 110, 113, 117, 101, 117, 101, 67, 104, 97, 110, 103, 101, 82, 101, 99, 111, 114, 100, 40, 102, 44, 101, 46, 99, 104, 97, 110, 103, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 110, 111, 116, 105, 102, 105, 101, 114, 80, 114, 111, 116, 111, 116, 121, 112, 101, 61, 123, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 79, 98, 106, 101, 99, 116, 78, 111, 116, 105, 102, 105, 101, 114, 78, 111, 116, 105, 102, 121, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 99, 97, 108, 108, 101, 100, 95, 111, 110, 95, 110, 111, 110, 95, 111, 98, 106, 101, 99, 116, 34, 44, 91, 34, 110, 111, 116, 105, 102, 121, 34, 93, 41, 59, 10, 10, 118, 97, 114, 32, 98, 61, 110, 111, 116, 105, 102, 105, 101, 114, 84, 97, 114, 103, 101, 116, 77, 97, 112, 46, 103, 101, 116, 40, 116, 104, 105, 115, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 111, 98, 115, 101, 114, 118, 101, 95, 110, 111, 116, 105, 102, 121, 95, 110, 111, 110, 95, 110, 111, 116, 105, 102, 105, 101, 114, 34, 41, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 46, 116, 121, 112, 101, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 111, 98, 115, 101, 114, 118, 101, 95, 116, 121, 112, 101, 95, 110, 111, 110, 95, 115, 116, 114, 105, 110, 103, 34, 41, 59, 10, 10, 118, 97, 114, 32, 99, 61, 111, 98, 106, 101, 99, 116, 73, 110, 102, 111, 77, 97, 112, 46, 103, 101, 116, 40, 98, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 99, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 99, 46, 99, 104, 97, 110, 103, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 46, 108, 101, 110, 103, 116, 104, 61, 61, 61, 48, 41, 10, 114, 101, 116, 117, 114, 110, 59, 10, 10, 118, 97, 114, 32, 100, 61, 123, 111, 98, 106, 101, 99, 116, 58, 98, 125, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 101, 32, 105, 110, 32, 97, 41, 123, 10, 105, 102, 40, 101, 61, 61, 61, 39, 111, 98, 106, 101, 99, 116, 39, 41, 99, 111, 110, 116, 105, 110, 117, 101, 59, 10, 37, 68, 101, 102, 105, 110, 101, 79, 114, 82, 101, 100, 101, 102, 105, 110, 101, 68, 97, 116, 97, 80, 114, 111, 112, 101, 114, 116, 121, 40, 100, 44, 101, 44, 97, 91, 101, 93, 44, 10, 49, 43, 52, 41, 59, 10, 125, 10, 79, 98, 106, 101, 99, 116, 70, 114, 101, 101, 122, 101, 40, 100, 41, 59, 10, 10, 69, 110, 113, 117, 101, 117, 101, 67, 104, 97, 110, 103, 101, 82, 101, 99, 111, 114, 100, 40, 100, 44, 99, 46, 99, 104, 97, 110, 103, 101, 79, 98, 115, 101, 114, 118, 101, 114, 115, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 79, 98, 106, 101, 99, 116, 78, 111, 116, 105, 102, 105, 101, 114, 80, 101, 114, 102, 111, 114, 109, 67, 104, 97, 110, 103, 101, 40, 97, 44, 98, 44, 99, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 99, 97, 108, 108, 101, 100, 95, 111, 110, 95, 110, 111, 110, 95, 111, 98, 106, 101, 99, 116, 34, 44, 91, 34, 112, 101, 114, 102, 111, 114, 109, 67, 104, 97, 110, 103, 101, 34, 93, 41, 59, 10, 10, 118, 97, 114, 32, 100, 61, 110, 111, 116, 105, 102, 105, 101, 114, 84, 97, 114, 103, 101, 116, 77, 97, 112, 46, 103, 101, 116, 40, 116, 104, 105, 115, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 100, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 111, 98, 115, 101, 114, 118, 101, 95, 110, 111, 116, 105, 102, 121, 95, 110, 111, 110, 95, 110, 111, 116, 105, 102, 105, 101, 114, 34, 41, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 111, 98, 115, 101, 114, 118, 101, 95, 112, 101, 114, 102, 111, 114, 109, 95, 110, 111, 110, 95, 115, 116, 114, 105, 110, 103, 34, 41, 59, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 98, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 111, 98, 115, 101, 114, 118, 101, 95, 112, 101, 114, 102, 111, 114, 109, 95, 110, 111, 110, 95, 102, 117, 110, 99, 116, 105, 111, 110, 34, 41, 59, 10, 10, 105, 102, 40, 40, 99, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 99, 61, 37, 71, 101, 116, 68, 101, 102, 97, 117, 108, 116, 82, 101, 99, 101, 105, 118, 101, 114, 40, 98, 41, 124, 124, 99, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 99, 41, 41, 38, 38, 37, 73, 115, 67, 108, 97, 115, 115, 105, 99, 77, 111, 100, 101, 70, 117, 110, 99, 116, 105, 111, 110, 40, 98, 41, 41, 123, 10, 99, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 99, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 101, 61, 111, 98, 106, 101, 99, 116, 73, 110, 102, 111, 77, 97, 112, 46, 103, 101, 116, 40, 100, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 101, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 10, 114, 101, 116, 117, 114, 110, 59, 10, 10, 66, 101, 103, 105, 110, 80, 101, 114, 102, 111, 114, 109, 67, 104, 97, 110, 103, 101, 40, 101, 44, 97, 41, 59, 10, 116, 114, 121, 123, 10, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 99, 44, 98, 41, 59, 10, 125, 102, 105, 110, 97, 108, 108, 121, 123, 10, 69, 110, 100, 80, 101, 114, 102, 111, 114, 109, 67, 104, 97, 110, 103, 101, 40, 101, 44, 97, 41, 59, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 79, 98, 106, 101, 99, 116, 71, 101, 116, 78, 111, 116, 105, 102, 105, 101, 114, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 97, 41, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 111, 98, 115, 101, 114, 118, 101, 95, 110, 111, 110, 95, 111, 98, 106, 101, 99, 116, 34, 44, 91, 34, 103, 101, 116, 78, 111, 116, 105, 102, 105, 101, 114, 34, 93, 41, 59, 10, 10, 105, 102, 40, 79, 98, 106, 101, 99, 116, 73, 115, 70, 114, 111, 122, 101, 110, 40, 97, 41, 41, 114, 101, 116, 117, 114, 110, 32, 110, 117, 108, 108, 59, 10, 10, 118, 97, 114, 32, 98, 61, 111, 98, 106, 101, 99, 116, 73, 110, 102, 111, 77, 97, 112, 46, 103, 101, 116, 40, 97, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 98, 61, 67, 114, 101, 97, 116, 101, 79, 98, 106, 101, 99, 116, 73, 110, 102, 111, 40, 97, 41, 59, 10, 37, 83, 101, 116, 73, 115, 79, 98, 115, 101, 114, 118, 101, 100, 40, 97, 41, 59, 10, 125, 10, 10, 105, 102, 40, 40, 98, 46, 110, 111, 116, 105, 102, 105, 101, 114, 61, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 98, 46, 110, 111, 116, 105, 102, 105, 101, 114, 61, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 111, 116, 105, 102, 105, 101, 114, 80, 114, 111, 116, 111, 116, 121, 112, 101, 125, 59, 10, 110, 111, 116, 105, 102, 105, 101, 114, 84, 97, 114, 103, 101, 116, 77, 97, 112, 46, 115, 101, 116, 40, 98, 46, 110, 111, 116, 105, 102, 105, 101, 114, 44, 97, 41, 59, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 32, 98, 46, 110, 111, 116, 105, 102, 105, 101, 114, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 97, 108, 108, 98, 97, 99, 107, 68, 101, 108, 105, 118, 101, 114, 80, 101, 110, 100, 105, 110, 103, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 99, 97, 108, 108, 98, 97, 99, 107, 73, 110, 102, 111, 77, 97, 112, 46, 103, 101, 116, 40, 97, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 10, 10, 10, 118, 97, 114, 32, 99, 61, 98, 46, 112, 114, 105, 111, 114, 105, 116, 121, 59, 10, 99, 97, 108, 108, 98, 97, 99, 107, 73, 110, 102, 111, 77, 97, 112, 46, 115, 101, 116, 40, 97, 44, 99, 41, 59, 10, 10, 100, 101, 108, 101, 116, 101, 32, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 112, 101, 110, 100, 105, 110, 103, 79, 98, 115, 101, 114, 118, 101, 114, 115, 91, 99, 93, 59, 10, 118, 97, 114, 32, 100, 61, 91, 93, 59, 10, 37, 77, 111, 118, 101, 65, 114, 114, 97, 121, 67, 111, 110, 116, 101, 110, 116, 115, 40, 98, 44, 100, 41, 59, 10, 10, 116, 114, 121, 123, 10, 37, 67, 97, 108, 108, 40, 118, 111, 105, 100, 32, 48, 44, 100, 44, 97, 41, 59, 10, 125, 99, 97, 116, 99, 104, 40, 101, 120, 41, 123, 125, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 79, 98, 106, 101, 99, 116, 68, 101, 108, 105, 118, 101, 114, 67, 104, 97, 110, 103, 101, 82, 101, 99, 111, 114, 100, 115, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 97, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 111, 98, 115, 101, 114, 118, 101, 95, 110, 111, 110, 95, 102, 117, 110, 99, 116, 105, 111, 110, 34, 44, 91, 34, 100, 101, 108, 105, 118, 101, 114, 67, 104, 97, 110, 103, 101, 82, 101, 99, 111, 114, 100, 115, 34, 93, 41, 59, 10, 10, 119, 104, 105, 108, 101, 40, 67, 97, 108, 108, 98, 97, 99, 107, 68, 101, 108, 105, 118, 101, 114, 80, 101, 110, 100, 105, 110, 103, 40, 97, 41, 41, 123, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 108, 105, 118, 101, 114, 67, 104, 97, 110, 103, 101, 82, 101, 99, 111, 114, 100, 115, 40, 41, 123, 10, 119, 104, 105, 108, 101, 40, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 112, 101, 110, 100, 105, 110, 103, 79, 98, 115, 101, 114, 118, 101, 114, 115, 46, 108, 101, 110, 103, 116, 104, 41, 123, 10, 118, 97, 114, 32, 97, 61, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 112, 101, 110, 100, 105, 110, 103, 79, 98, 115, 101, 114, 118, 101, 114, 115, 59, 10, 111, 98, 115, 101, 114, 118, 97, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 112, 101, 110, 100, 105, 110, 103, 79, 98, 115, 101, 114, 118, 101, 114, 115, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 98, 32, 105, 110, 32, 97, 41, 123, 10, 67, 97, 108, 108, 98, 97, 99, 107, 68, 101, 108, 105, 118, 101, 114, 80, 101, 110, 100, 105, 110, 103, 40, 97, 91, 98, 93, 41, 59, 10, 125, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 117, 112, 79, 98, 106, 101, 99, 116, 79, 98, 115, 101, 114, 118, 101, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 79, 98, 106, 101, 99, 116, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 100, 101, 108, 105, 118, 101, 114, 67, 104, 97, 110, 103, 101, 82, 101, 99, 111, 114, 100, 115, 34, 44, 79, 98, 106, 101, 99, 116, 68, 101, 108, 105, 118, 101, 114, 67, 104, 97, 110, 103, 101, 82, 101, 99, 111, 114, 100, 115, 44, 10, 34, 103, 101, 116, 78, 111, 116, 105, 102, 105, 101, 114, 34, 44, 79, 98, 106, 101, 99, 116, 71, 101, 116, 78, 111, 116, 105, 102, 105, 101, 114, 44, 10, 34, 111, 98, 115, 101, 114, 118, 101, 34, 44, 79, 98, 106, 101, 99, 116, 79, 98, 115, 101, 114, 118, 101, 44, 10, 34, 117, 110, 111, 98, 115, 101, 114, 118, 101, 34, 44, 79, 98, 106, 101, 99, 116, 85, 110, 111, 98, 115, 101, 114, 118, 101, 10, 41, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 65, 114, 114, 97, 121, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 111, 98, 115, 101, 114, 118, 101, 34, 44, 65, 114, 114, 97, 121, 79, 98, 115, 101, 114, 118, 101, 44, 10, 34, 117, 110, 111, 98, 115, 101, 114, 118, 101, 34, 44, 65, 114, 114, 97, 121, 85, 110, 111, 98, 115, 101, 114, 118, 101, 10, 41, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 110, 111, 116, 105, 102, 105, 101, 114, 80, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 110, 111, 116, 105, 102, 121, 34, 44, 79, 98, 106, 101, 99, 116, 78, 111, 116, 105, 102, 105, 101, 114, 78, 111, 116, 105, 102, 121, 44, 10, 34, 112, 101, 114, 102, 111, 114, 109, 67, 104, 97, 110, 103, 101, 34, 44, 79, 98, 106, 101, 99, 116, 78, 111, 116, 105, 102, 105, 101, 114, 80, 101, 114, 102, 111, 114, 109, 67, 104, 97, 110, 103, 101, 10, 41, 41, 59, 10, 125, 10, 10, 83, 101, 116, 117, 112, 79, 98, 106, 101, 99, 116, 79, 98, 115, 101, 114, 118, 101, 40, 41, 59, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 34, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 34, 59, 10, 10, 118, 97, 114, 32, 36, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 61, 103, 108, 111, 98, 97, 108, 46, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 59, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 97, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 118, 97, 114, 32, 98, 61, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 73, 110, 116, 101, 103, 101, 114, 40, 97, 44, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 114, 97, 121, 95, 98, 117, 102, 102, 101, 114, 95, 108, 101, 110, 103, 116, 104, 39, 41, 59, 10, 37, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 40, 116, 104, 105, 115, 44, 98, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 95, 110, 111, 116, 95, 102, 117, 110, 99, 116, 105, 111, 110, 39, 44, 91, 34, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 34, 93, 41, 59, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 71, 101, 116, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 71, 101, 116, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 83, 108, 105, 99, 101, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 108, 105, 99, 101, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 99, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 63, 97, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 59, 10, 118, 97, 114, 32, 100, 59, 10, 105, 102, 40, 99, 60, 48, 41, 123, 10, 100, 61, 77, 97, 116, 104, 77, 97, 120, 40, 116, 104, 105, 115, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 43, 99, 44, 48, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 61, 77, 97, 116, 104, 77, 105, 110, 40, 99, 44, 116, 104, 105, 115, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 125, 10, 118, 97, 114, 32, 101, 61, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 63, 116, 104, 105, 115, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 58, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 63, 98, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 41, 59, 10, 118, 97, 114, 32, 102, 59, 10, 105, 102, 40, 101, 60, 48, 41, 123, 10, 102, 61, 77, 97, 116, 104, 77, 97, 120, 40, 116, 104, 105, 115, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 43, 101, 44, 48, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 102, 61, 77, 97, 116, 104, 77, 105, 110, 40, 101, 44, 116, 104, 105, 115, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 125, 10, 10, 105, 102, 40, 102, 60, 100, 41, 123, 10, 102, 61, 100, 59, 10, 125, 10, 118, 97, 114, 32, 103, 61, 102, 45, 100, 59, 10, 10, 118, 97, 114, 32, 104, 61, 110, 101, 119, 32, 36, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 40, 103, 41, 59, 10, 10, 37, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 83, 108, 105, 99, 101, 73, 109, 112, 108, 40, 116, 104, 105, 115, 44, 104, 44, 100, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 104, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 85, 112, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 10, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 36, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 44, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 36, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 44, 110, 101, 119, 32, 36, 79, 98, 106, 101, 99, 116, 40, 41, 41, 59, 10, 10, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 36, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 34, 44, 36, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 44, 50, 41, 59, 10, 10, 73, 110, 115, 116, 97, 108, 108, 71, 101, 116, 116, 101, 114, 40, 36, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 34, 44, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 71, 101, 116, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 115, 108, 105, 99, 101, 34, 44, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 83, 108, 105, 99, 101, 10, 41, 41, 59, 10, 125, 10, 10, 83, 101, 116, 85, 112, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 40, 41, 59, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 34, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 34, 59, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 114, 101, 97, 116, 101, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 97, 44, 98, 44, 99, 44, 100, 41, 123, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 110, 115, 116, 114, 117, 99, 116, 66, 121, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 40, 101, 44, 102, 44, 103, 44, 104, 41, 123, 10, 118, 97, 114, 32, 105, 61, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 73, 110, 116, 101, 103, 101, 114, 40, 103, 44, 34, 105, 110, 118, 97, 108, 105, 100, 95, 116, 121, 112, 101, 100, 95, 97, 114, 114, 97, 121, 95, 108, 101, 110, 103, 116, 104, 34, 41, 10, 10, 105, 102, 40, 105, 32, 37, 32, 98, 33, 61, 61, 48, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 34, 105, 110, 118, 97, 108, 105, 100, 95, 116, 121, 112, 101, 100, 95, 97, 114, 114, 97, 121, 95, 97, 108, 105, 103, 110, 109, 101, 110, 116, 34, 44, 10, 34, 115, 116, 97, 114, 116, 32, 111, 102, 102, 115, 101, 116, 34, 44, 97, 44, 98, 41, 59, 10, 125, 10, 118, 97, 114, 32, 106, 61, 37, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 71, 101, 116, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 102, 41, 59, 10, 105, 102, 40, 105, 62, 106, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 34, 105, 110, 118, 97, 108, 105, 100, 95, 116, 121, 112, 101, 100, 95, 97, 114, 114, 97, 121, 95, 111, 102, 102, 115, 101, 116, 34, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 107, 59, 10, 118, 97, 114, 32, 108, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 104, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 105, 102, 40, 106, 32, 37, 32, 98, 33, 61, 61, 48, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 34, 105, 110, 118, 97, 108, 105, 100, 95, 116, 121, 112, 101, 100, 95, 97, 114, 114, 97, 121, 95, 97, 108, 105, 103, 110, 109, 101, 110, 116, 34, 44, 10, 34, 98, 121, 116, 101, 32, 108, 101, 110, 103, 116, 104, 34, 44, 97, 44, 98, 41, 59, 10, 125, 10, 107, 61, 106, 45, 105, 59, 10, 108, 61, 107, 47, 98, 59, 10, 125, 101, 108, 115, 101, 123, 10, 118, 97, 114, 32, 108, 61, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 73, 110, 116, 101, 103, 101, 114, 40, 104, 44, 34, 105, 110, 118, 97, 108, 105, 100, 95, 116, 121, 112, 101, 100, 95, 97, 114, 114, 97, 121, 95, 108, 101, 110, 103, 116, 104, 34, 41, 59, 10, 107, 61, 108, 42, 98, 59, 10, 125, 10, 105, 102, 40, 105, 43, 107, 62, 106, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 34, 105, 110, 118, 97, 108, 105, 100, 95, 116, 121, 112, 101, 100, 95, 97, 114, 114, 97, 121, 95, 108, 101, 110, 103, 116, 104, 34, 41, 59, 10, 125, 10, 37, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 40, 101, 44, 99, 44, 102, 44, 105, 44, 107, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 110, 115, 116, 114, 117, 99, 116, 66, 121, 76, 101, 110, 103, 116, 104, 40, 101, 44, 104, 41, 123, 10, 118, 97, 114, 32, 109, 61, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 73, 110, 116, 101, 103, 101, 114, 40, 104, 44, 34, 105, 110, 118, 97, 108, 105, 100, 95, 116, 121, 112, 101, 100, 95, 97, 114, 114, 97, 121, 95, 108, 101, 110, 103, 116, 104, 34, 41, 59, 10, 118, 97, 114, 32, 110, 61, 109, 42, 98, 59, 10, 118, 97, 114, 32, 102, 61, 110, 101, 119, 32, 103, 108, 111, 98, 97, 108, 46, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 40, 110, 41, 59, 10, 37, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 40, 101, 44, 99, 44, 102, 44, 48, 44, 110, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 110, 115, 116, 114, 117, 99, 116, 66, 121, 65, 114, 114, 97, 121, 76, 105, 107, 101, 40, 101, 44, 111, 41, 123, 10, 118, 97, 114, 32, 104, 61, 111, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 109, 61, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 73, 110, 116, 101, 103, 101, 114, 40, 104, 44, 34, 105, 110, 118, 97, 108, 105, 100, 95, 116, 121, 112, 101, 100, 95, 97, 114, 114, 97, 121, 95, 108, 101, 110, 103, 116, 104, 34, 41, 59, 10, 105, 102, 40, 33, 37, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 70, 114, 111, 109, 65, 114, 114, 97, 121, 76, 105, 107, 101, 40, 101, 44, 99, 44, 111, 44, 109, 41, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 112, 61, 48, 59, 112, 60, 109, 59, 112, 43, 43, 41, 123, 10, 101, 91, 112, 93, 61, 111, 91, 112, 93, 59, 10, 125, 10, 125, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 113, 44, 114, 44, 115, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 105, 102, 40, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 113, 41, 61, 61, 61, 39, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 39, 41, 41, 123, 10, 67, 111, 110, 115, 116, 114, 117, 99, 116, 66, 121, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 40, 116, 104, 105, 115, 44, 113, 44, 114, 44, 115, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 113, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 124, 124, 40, 116, 121, 112, 101, 111, 102, 40, 113, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 124, 124, 10, 40, 116, 121, 112, 101, 111, 102, 40, 113, 41, 61, 61, 61, 39, 98, 111, 111, 108, 101, 97, 110, 39, 41, 124, 124, 40, 116, 121, 112, 101, 111, 102, 40, 113, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 67, 111, 110, 115, 116, 114, 117, 99, 116, 66, 121, 76, 101, 110, 103, 116, 104, 40, 116, 104, 105, 115, 44, 113, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 67, 111, 110, 115, 116, 114, 117, 99, 116, 66, 121, 65, 114, 114, 97, 121, 76, 105, 107, 101, 40, 116, 104, 105, 115, 44, 113, 41, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 95, 110, 111, 116, 95, 102, 117, 110, 99, 116, 105, 111, 110, 34, 44, 91, 97, 93, 41, 10, 125, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 66, 117, 102, 102, 101, 114, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 66, 117, 102, 102, 101, 114, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 66, 121, 116, 101, 79, 102, 102, 115, 101, 116, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 66, 121, 116, 101, 79, 102, 102, 115, 101, 116, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 76, 101, 110, 103, 116, 104, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 76, 101, 110, 103, 116, 104, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 114, 101, 97, 116, 101, 83, 117, 98, 65, 114, 114, 97, 121, 40, 97, 44, 98, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 99, 44, 100, 41, 123, 10, 118, 97, 114, 32, 101, 61, 37, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 76, 101, 110, 103, 116, 104, 40, 116, 104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 102, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 99, 41, 41, 63, 99, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 99, 41, 41, 41, 59, 10, 105, 102, 40, 102, 60, 48, 41, 123, 10, 102, 61, 77, 97, 116, 104, 77, 97, 120, 40, 48, 44, 101, 43, 102, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 102, 61, 77, 97, 116, 104, 77, 105, 110, 40, 101, 44, 102, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 103, 61, 40, 116, 121, 112, 101, 111, 102, 40, 100, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 63, 101, 58, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 100, 41, 41, 63, 100, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 100, 41, 41, 41, 59, 10, 105, 102, 40, 103, 60, 48, 41, 123, 10, 103, 61, 77, 97, 116, 104, 77, 97, 120, 40, 48, 44, 101, 43, 103, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 103, 61, 77, 97, 116, 104, 77, 105, 110, 40, 103, 44, 101, 41, 59, 10, 125, 10, 105, 102, 40, 103, 60, 102, 41, 123, 10, 103, 61, 102, 59, 10, 125, 10, 118, 97, 114, 32, 104, 61, 103, 45, 102, 59, 10, 118, 97, 114, 32, 105, 61, 10, 37, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 66, 121, 116, 101, 79, 102, 102, 115, 101, 116, 40, 116, 104, 105, 115, 41, 43, 102, 42, 97, 59, 10, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 98, 40, 37, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 66, 117, 102, 102, 101, 114, 40, 116, 104, 105, 115, 41, 44, 10, 105, 44, 104, 41, 59, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 83, 101, 116, 70, 114, 111, 109, 65, 114, 114, 97, 121, 76, 105, 107, 101, 40, 97, 44, 98, 44, 99, 44, 100, 41, 123, 10, 105, 102, 40, 100, 62, 48, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 101, 61, 48, 59, 101, 60, 99, 59, 101, 43, 43, 41, 123, 10, 97, 91, 100, 43, 101, 93, 61, 98, 91, 101, 93, 59, 10, 125, 10, 125, 10, 101, 108, 115, 101, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 101, 61, 48, 59, 101, 60, 99, 59, 101, 43, 43, 41, 123, 10, 97, 91, 101, 93, 61, 98, 91, 101, 93, 59, 10, 125, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 83, 101, 116, 70, 114, 111, 109, 79, 118, 101, 114, 108, 97, 112, 112, 105, 110, 103, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 97, 44, 98, 44, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 98, 46, 66, 89, 84, 69, 83, 95, 80, 69, 82, 95, 69, 76, 69, 77, 69, 78, 84, 59, 10, 118, 97, 114, 32, 101, 61, 97, 46, 66, 89, 84, 69, 83, 95, 80, 69, 82, 95, 69, 76, 69, 77, 69, 78, 84, 59, 10, 118, 97, 114, 32, 102, 61, 98, 46, 108, 101, 110, 103, 116, 104, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 112, 121, 76, 101, 102, 116, 80, 97, 114, 116, 40, 41, 123, 10, 10, 118, 97, 114, 32, 103, 61, 97, 46, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 43, 40, 99, 43, 49, 41, 42, 101, 59, 10, 10, 10, 118, 97, 114, 32, 104, 61, 98, 46, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 105, 61, 48, 59, 10, 105, 60, 102, 38, 38, 103, 60, 61, 104, 59, 10, 105, 43, 43, 41, 123, 10, 97, 91, 99, 43, 105, 93, 61, 98, 91, 105, 93, 59, 10, 103, 43, 61, 101, 59, 10, 104, 43, 61, 100, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 105, 59, 10, 125, 10, 118, 97, 114, 32, 105, 61, 67, 111, 112, 121, 76, 101, 102, 116, 80, 97, 114, 116, 40, 41, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 112, 121, 82, 105, 103, 104, 116, 80, 97, 114, 116, 40, 41, 123, 10, 10, 118, 97, 114, 32, 103, 61, 10, 97, 46, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 43, 40, 99, 43, 102, 45, 49, 41, 42, 101, 59, 10, 10, 10, 118, 97, 114, 32, 104, 61, 10, 98, 46, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 43, 102, 42, 100, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 106, 61, 102, 45, 49, 59, 10, 106, 62, 61, 105, 38, 38, 103, 62, 61, 104, 59, 10, 106, 45, 45, 41, 123, 10, 97, 91, 99, 43, 106, 93, 61, 98, 91, 106, 93, 59, 10, 103, 45, 61, 101, 59, 10, 104, 45, 61, 100, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 106, 59, 10, 125, 10, 118, 97, 114, 32, 106, 61, 67, 111, 112, 121, 82, 105, 103, 104, 116, 80, 97, 114, 116, 40, 41, 59, 10, 10, 118, 97, 114, 32, 107, 61, 110, 101, 119, 32, 36, 65, 114, 114, 97, 121, 40, 106, 43, 49, 45, 105, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 108, 61, 105, 59, 108, 60, 61, 106, 59, 108, 43, 43, 41, 123, 10, 107, 91, 108, 45, 105, 93, 61, 98, 91, 108, 93, 59, 10, 125, 10, 102, 111, 114, 40, 108, 61, 105, 59, 108, 60, 61, 106, 59, 108, 43, 43, 41, 123, 10, 97, 91, 99, 43, 108, 93, 61, 107, 91, 108, 45, 105, 93, 59, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 83, 101, 116, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 63, 48, 58, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 63, 98, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 41, 59, 10, 105, 102, 40, 99, 60, 48, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 116, 121, 112, 101, 100, 95, 97, 114, 114, 97, 121, 95, 115, 101, 116, 95, 110, 101, 103, 97, 116, 105, 118, 101, 95, 111, 102, 102, 115, 101, 116, 34, 41, 59, 10, 125, 10, 115, 119, 105, 116, 99, 104, 40, 37, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 83, 101, 116, 70, 97, 115, 116, 67, 97, 115, 101, 115, 40, 116, 104, 105, 115, 44, 97, 44, 99, 41, 41, 123, 10, 10, 99, 97, 115, 101, 32, 48, 58, 10, 114, 101, 116, 117, 114, 110, 59, 10, 99, 97, 115, 101, 32, 49, 58, 10, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 83, 101, 116, 70, 114, 111, 109, 79, 118, 101, 114, 108, 97, 112, 112, 105, 110, 103, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 44, 97, 44, 99, 41, 59, 10, 114, 101, 116, 117, 114, 110, 59, 10, 99, 97, 115, 101, 32, 50, 58, 10, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 83, 101, 116, 70, 114, 111, 109, 65, 114, 114, 97, 121, 76, 105, 107, 101, 40, 116, 104, 105, 115, 44, 97, 44, 97, 46, 108, 101, 110, 103, 116, 104, 44, 99, 41, 59, 10, 114, 101, 116, 117, 114, 110, 59, 10, 99, 97, 115, 101, 32, 51, 58, 10, 118, 97, 114, 32, 100, 61, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 100, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 123, 10, 10, 10, 10, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 34, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10, 105, 102, 40, 99, 43, 100, 62, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 34, 116, 121, 112, 101, 100, 95, 97, 114, 114, 97, 121, 95, 115, 101, 116, 95, 115, 111, 117, 114, 99, 101, 95, 116, 111, 111, 95, 108, 97, 114, 103, 101, 34, 41, 59, 10, 125, 10, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 83, 101, 116, 70, 114, 111, 109, 65, 114, 114, 97, 121, 76, 105, 107, 101, 40, 116, 104, 105, 115, 44, 97, 44, 100, 44, 99, 41, 59, 10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 117, 112, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 97, 44, 98, 44, 99, 44, 100, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 118, 97, 114, 32, 101, 61, 67, 114, 101, 97, 116, 101, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 98, 44, 100, 44, 10, 97, 44, 99, 41, 59, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 99, 44, 101, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 99, 44, 110, 101, 119, 32, 36, 79, 98, 106, 101, 99, 116, 40, 41, 41, 59, 10, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 44, 34, 66, 89, 84, 69, 83, 95, 80, 69, 82, 95, 69, 76, 69, 77, 69, 78, 84, 34, 44, 100, 44, 10, 49, 124, 50, 124, 52, 41, 59, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 10, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 34, 44, 99, 44, 50, 41, 59, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 10, 34, 66, 89, 84, 69, 83, 95, 80, 69, 82, 95, 69, 76, 69, 77, 69, 78, 84, 34, 44, 100, 44, 10, 49, 124, 50, 124, 52, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 71, 101, 116, 116, 101, 114, 40, 99, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 98, 117, 102, 102, 101, 114, 34, 44, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 66, 117, 102, 102, 101, 114, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 71, 101, 116, 116, 101, 114, 40, 99, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 34, 44, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 66, 121, 116, 101, 79, 102, 102, 115, 101, 116, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 71, 101, 116, 116, 101, 114, 40, 99, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 34, 44, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 71, 101, 116, 116, 101, 114, 40, 99, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 108, 101, 110, 103, 116, 104, 34, 44, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 76, 101, 110, 103, 116, 104, 41, 59, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 99, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 115, 117, 98, 97, 114, 114, 97, 121, 34, 44, 67, 114, 101, 97, 116, 101, 83, 117, 98, 65, 114, 114, 97, 121, 40, 100, 44, 99, 41, 44, 10, 34, 115, 101, 116, 34, 44, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 83, 101, 116, 10, 41, 41, 59, 10, 125, 10, 10, 10, 83, 101, 116, 117, 112, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 49, 44, 34, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 34, 44, 103, 108, 111, 98, 97, 108, 46, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 44, 49, 41, 59, 10, 83, 101, 116, 117, 112, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 50, 44, 34, 73, 110, 116, 56, 65, 114, 114, 97, 121, 34, 44, 103, 108, 111, 98, 97, 108, 46, 73, 110, 116, 56, 65, 114, 114, 97, 121, 44, 49, 41, 59, 10, 83, 101, 116, 117, 112, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 51, 44, 34, 85, 105, 110, 116, 49, 54, 65, 114, 114, 97, 121, 34, 44, 103, 108, 111, 98, 97, 108, 46, 85, 105, 110, 116, 49, 54, 65, 114, 114, 97, 121, 44, 50, 41, 59, 10, 83, 101, 116, 117, 112, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 52, 44, 34, 73, 110, 116, 49, 54, 65, 114, 114, 97, 121, 34, 44, 103, 108, 111, 98, 97, 108, 46, 73, 110, 116, 49, 54, 65, 114, 114, 97, 121, 44, 50, 41, 59, 10, 83, 101, 116, 117, 112, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 53, 44, 34, 85, 105, 110, 116, 51, 50, 65, 114, 114, 97, 121, 34, 44, 103, 108, 111, 98, 97, 108, 46, 85, 105, 110, 116, 51, 50, 65, 114, 114, 97, 121, 44, 52, 41, 59, 10, 83, 101, 116, 117, 112, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 54, 44, 34, 73, 110, 116, 51, 50, 65, 114, 114, 97, 121, 34, 44, 103, 108, 111, 98, 97, 108, 46, 73, 110, 116, 51, 50, 65, 114, 114, 97, 121, 44, 52, 41, 59, 10, 83, 101, 116, 117, 112, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 55, 44, 34, 70, 108, 111, 97, 116, 51, 50, 65, 114, 114, 97, 121, 34, 44, 103, 108, 111, 98, 97, 108, 46, 70, 108, 111, 97, 116, 51, 50, 65, 114, 114, 97, 121, 44, 52, 41, 59, 10, 83, 101, 116, 117, 112, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 56, 44, 34, 70, 108, 111, 97, 116, 54, 52, 65, 114, 114, 97, 121, 34, 44, 103, 108, 111, 98, 97, 108, 46, 70, 108, 111, 97, 116, 54, 52, 65, 114, 114, 97, 121, 44, 56, 41, 59, 10, 83, 101, 116, 117, 112, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 57, 44, 34, 85, 105, 110, 116, 56, 67, 108, 97, 109, 112, 101, 100, 65, 114, 114, 97, 121, 34, 44, 103, 108, 111, 98, 97, 108, 46, 85, 105, 110, 116, 56, 67, 108, 97, 109, 112, 101, 100, 65, 114, 114, 97, 121, 44, 49, 41, 59, 10, 10, 10, 10, 10, 118, 97, 114, 32, 36, 68, 97, 116, 97, 86, 105, 101, 119, 61, 103, 108, 111, 98, 97, 108, 46, 68, 97, 116, 97, 86, 105, 101, 119, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 97, 44, 98, 44, 99, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 97, 41, 61, 61, 61, 39, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 100, 97, 116, 97, 95, 118, 105, 101, 119, 95, 110, 111, 116, 95, 97, 114, 114, 97, 121, 95, 98, 117, 102, 102, 101, 114, 39, 44, 91, 93, 41, 59, 10, 125, 10, 118, 97, 114, 32, 100, 61, 37, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 71, 101, 116, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 97, 41, 59, 10, 118, 97, 114, 32, 101, 61, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 73, 110, 116, 101, 103, 101, 114, 40, 98, 44, 39, 105, 110, 118, 97, 108, 105, 100, 95, 100, 97, 116, 97, 95, 118, 105, 101, 119, 95, 111, 102, 102, 115, 101, 116, 39, 41, 59, 10, 105, 102, 40, 101, 62, 100, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 100, 97, 116, 97, 95, 118, 105, 101, 119, 95, 111, 102, 102, 115, 101, 116, 39, 41, 59, 10, 125, 10, 118, 97, 114, 32, 102, 61, 40, 116, 121, 112, 101, 111, 102, 40, 99, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 63, 10, 100, 45, 101, 58, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 99, 41, 41, 63, 99, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 99, 41, 41, 41, 59, 10, 105, 102, 40, 102, 60, 48, 124, 124, 101, 43, 102, 62, 100, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 77, 97, 107, 101, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 100, 97, 116, 97, 95, 118, 105, 101, 119, 95, 108, 101, 110, 103, 116, 104, 39, 41, 59, 10, 125, 10, 37, 68, 97, 116, 97, 86, 105, 101, 119, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 40, 116, 104, 105, 115, 44, 97, 44, 101, 44, 102, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 95, 110, 111, 116, 95, 102, 117, 110, 99, 116, 105, 111, 110, 39, 44, 91, 34, 68, 97, 116, 97, 86, 105, 101, 119, 34, 93, 41, 59, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 66, 117, 102, 102, 101, 114, 40, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 98, 117, 102, 102, 101, 114, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 66, 117, 102, 102, 101, 114, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 66, 121, 116, 101, 79, 102, 102, 115, 101, 116, 40, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 66, 121, 116, 101, 79, 102, 102, 115, 101, 116, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 73, 110, 116, 101, 103, 101, 114, 40, 97, 44, 39, 105, 110, 118, 97, 108, 105, 100, 95, 100, 97, 116, 97, 95, 118, 105, 101, 119, 95, 97, 99, 99, 101, 115, 115, 111, 114, 95, 111, 102, 102, 115, 101, 116, 39, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 73, 110, 116, 56, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 103, 101, 116, 73, 110, 116, 56, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 49, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 73, 110, 116, 56, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 33, 33, 98, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 73, 110, 116, 56, 40, 97, 44, 98, 44, 99, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 115, 101, 116, 73, 110, 116, 56, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 50, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 37, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 73, 110, 116, 56, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 63, 98, 58, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 44, 10, 33, 33, 99, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 85, 105, 110, 116, 56, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 103, 101, 116, 85, 105, 110, 116, 56, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 49, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 85, 105, 110, 116, 56, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 33, 33, 98, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 85, 105, 110, 116, 56, 40, 97, 44, 98, 44, 99, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 115, 101, 116, 85, 105, 110, 116, 56, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 50, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 37, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 85, 105, 110, 116, 56, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 63, 98, 58, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 44, 10, 33, 33, 99, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 73, 110, 116, 49, 54, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 103, 101, 116, 73, 110, 116, 49, 54, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 49, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 73, 110, 116, 49, 54, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 33, 33, 98, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 73, 110, 116, 49, 54, 40, 97, 44, 98, 44, 99, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 115, 101, 116, 73, 110, 116, 49, 54, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 50, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 37, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 73, 110, 116, 49, 54, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 63, 98, 58, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 44, 10, 33, 33, 99, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 85, 105, 110, 116, 49, 54, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 103, 101, 116, 85, 105, 110, 116, 49, 54, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 49, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 85, 105, 110, 116, 49, 54, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 33, 33, 98, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 85, 105, 110, 116, 49, 54, 40, 97, 44, 98, 44, 99, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 115, 101, 116, 85, 105, 110, 116, 49, 54, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 50, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 37, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 85, 105, 110, 116, 49, 54, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 63, 98, 58, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 44, 10, 33, 33, 99, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 73, 110, 116, 51, 50, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 103, 101, 116, 73, 110, 116, 51, 50, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 49, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 73, 110, 116, 51, 50, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 33, 33, 98, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 73, 110, 116, 51, 50, 40, 97, 44, 98, 44, 99, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 115, 101, 116, 73, 110, 116, 51, 50, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 50, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 37, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 73, 110, 116, 51, 50, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 63, 98, 58, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 44, 10, 33, 33, 99, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 85, 105, 110, 116, 51, 50, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 103, 101, 116, 85, 105, 110, 116, 51, 50, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 49, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 85, 105, 110, 116, 51, 50, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 33, 33, 98, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 85, 105, 110, 116, 51, 50, 40, 97, 44, 98, 44, 99, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 115, 101, 116, 85, 105, 110, 116, 51, 50, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 50, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 37, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 85, 105, 110, 116, 51, 50, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 63, 98, 58, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 44, 10, 33, 33, 99, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 70, 108, 111, 97, 116, 51, 50, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 103, 101, 116, 70, 108, 111, 97, 116, 51, 50, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 49, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 70, 108, 111, 97, 116, 51, 50, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 33, 33, 98, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 70, 108, 111, 97, 116, 51, 50, 40, 97, 44, 98, 44, 99, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 115, 101, 116, 70, 108, 111, 97, 116, 51, 50, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 50, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 37, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 70, 108, 111, 97, 116, 51, 50, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 63, 98, 58, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 44, 10, 33, 33, 99, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 70, 108, 111, 97, 116, 54, 52, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 103, 101, 116, 70, 108, 111, 97, 116, 54, 52, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 49, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 70, 108, 111, 97, 116, 54, 52, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 33, 33, 98, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 70, 108, 111, 97, 116, 54, 52, 40, 97, 44, 98, 44, 99, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 68, 97, 116, 97, 86, 105, 101, 119, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 68, 97, 116, 97, 86, 105, 101, 119, 46, 115, 101, 116, 70, 108, 111, 97, 116, 54, 52, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 50, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 118, 97, 108, 105, 100, 95, 97, 114, 103, 117, 109, 101, 110, 116, 39, 41, 59, 10, 125, 10, 37, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 70, 108, 111, 97, 116, 54, 52, 40, 116, 104, 105, 115, 44, 10, 84, 111, 80, 111, 115, 105, 116, 105, 118, 101, 68, 97, 116, 97, 86, 105, 101, 119, 79, 102, 102, 115, 101, 116, 40, 97, 41, 44, 10, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 63, 98, 58, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 44, 10, 33, 33, 99, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 117, 112, 68, 97, 116, 97, 86, 105, 101, 119, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 10, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 36, 68, 97, 116, 97, 86, 105, 101, 119, 44, 68, 97, 116, 97, 86, 105, 101, 119, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 36, 68, 97, 116, 97, 86, 105, 101, 119, 44, 110, 101, 119, 32, 36, 79, 98, 106, 101, 99, 116, 41, 59, 10, 10, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 36, 68, 97, 116, 97, 86, 105, 101, 119, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 34, 44, 36, 68, 97, 116, 97, 86, 105, 101, 119, 44, 50, 41, 59, 10, 10, 73, 110, 115, 116, 97, 108, 108, 71, 101, 116, 116, 101, 114, 40, 36, 68, 97, 116, 97, 86, 105, 101, 119, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 98, 117, 102, 102, 101, 114, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 66, 117, 102, 102, 101, 114, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 71, 101, 116, 116, 101, 114, 40, 36, 68, 97, 116, 97, 86, 105, 101, 119, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 66, 121, 116, 101, 79, 102, 102, 115, 101, 116, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 71, 101, 116, 116, 101, 114, 40, 36, 68, 97, 116, 97, 86, 105, 101, 119, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 68, 97, 116, 97, 86, 105, 101, 119, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 103, 101, 116, 73, 110, 116, 56, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 73, 110, 116, 56, 44, 10, 34, 115, 101, 116, 73, 110, 116, 56, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 73, 110, 116, 56, 44, 10, 10, 34, 103, 101, 116, 85, 105, 110, 116, 56, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 85, 105, 110, 116, 56, 44, 10, 34, 115, 101, 116, 85, 105, 110, 116, 56, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 85, 105, 110, 116, 56, 44, 10, 10, 34, 103, 101, 116, 73, 110, 116, 49, 54, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 73, 110, 116, 49, 54, 44, 10, 34, 115, 101, 116, 73, 110, 116, 49, 54, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 73, 110, 116, 49, 54, 44, 10, 10, 34, 103, 101, 116, 85, 105, 110, 116, 49, 54, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 85, 105, 110, 116, 49, 54, 44, 10, 34, 115, 101, 116, 85, 105, 110, 116, 49, 54, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 85, 105, 110, 116, 49, 54, 44, 10, 10, 34, 103, 101, 116, 73, 110, 116, 51, 50, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 73, 110, 116, 51, 50, 44, 10, 34, 115, 101, 116, 73, 110, 116, 51, 50, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 73, 110, 116, 51, 50, 44, 10, 10, 34, 103, 101, 116, 85, 105, 110, 116, 51, 50, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 85, 105, 110, 116, 51, 50, 44, 10, 34, 115, 101, 116, 85, 105, 110, 116, 51, 50, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 85, 105, 110, 116, 51, 50, 44, 10, 10, 34, 103, 101, 116, 70, 108, 111, 97, 116, 51, 50, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 70, 108, 111, 97, 116, 51, 50, 44, 10, 34, 115, 101, 116, 70, 108, 111, 97, 116, 51, 50, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 70, 108, 111, 97, 116, 51, 50, 44, 10, 10, 34, 103, 101, 116, 70, 108, 111, 97, 116, 54, 52, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 71, 101, 116, 70, 108, 111, 97, 116, 54, 52, 44, 10, 34, 115, 101, 116, 70, 108, 111, 97, 116, 54, 52, 34, 44, 68, 97, 116, 97, 86, 105, 101, 119, 83, 101, 116, 70, 108, 111, 97, 116, 54, 52, 10, 41, 41, 59, 10, 125, 10, 10, 83, 101, 116, 117, 112, 68, 97, 116, 97, 86, 105, 101, 119, 40, 41, 59, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 34, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 34, 59, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 110, 101, 114, 97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 78, 101, 120, 116, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 71, 101, 110, 101, 114, 97, 116, 111, 114, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 91, 71, 101, 110, 101, 114, 97, 116, 111, 114, 93, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 110, 101, 120, 116, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 32, 37, 95, 71, 101, 110, 101, 114, 97, 116, 111, 114, 78, 101, 120, 116, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 110, 101, 114, 97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 84, 104, 114, 111, 119, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 71, 101, 110, 101, 114, 97, 116, 111, 114, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 91, 71, 101, 110, 101, 114, 97, 116, 111, 114, 93, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 104, 114, 111, 119, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 32, 37, 95, 71, 101, 110, 101, 114, 97, 116, 111, 114, 84, 104, 114, 111, 119, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 97, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 110, 111, 116, 95, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 39, 44, 91, 39, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101, 39, 93, 41, 59, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 78, 101, 119, 70, 117, 110, 99, 116, 105, 111, 110, 83, 116, 114, 105, 110, 103, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 44, 39, 102, 117, 110, 99, 116, 105, 111, 110, 42, 39, 41, 59, 10, 118, 97, 114, 32, 99, 61, 37, 71, 108, 111, 98, 97, 108, 82, 101, 99, 101, 105, 118, 101, 114, 40, 103, 108, 111, 98, 97, 108, 41, 59, 10, 10, 10, 118, 97, 114, 32, 100, 61, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 99, 44, 37, 67, 111, 109, 112, 105, 108, 101, 83, 116, 114, 105, 110, 103, 40, 98, 44, 116, 114, 117, 101, 41, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 77, 97, 114, 107, 78, 97, 109, 101, 83, 104, 111, 117, 108, 100, 80, 114, 105, 110, 116, 65, 115, 65, 110, 111, 110, 121, 109, 111, 117, 115, 40, 100, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 100, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 85, 112, 71, 101, 110, 101, 114, 97, 116, 111, 114, 115, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 118, 97, 114, 32, 97, 61, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 97, 44, 10, 50, 124, 52, 124, 49, 44, 10, 91, 34, 110, 101, 120, 116, 34, 44, 71, 101, 110, 101, 114, 97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 78, 101, 120, 116, 44, 10, 34, 116, 104, 114, 111, 119, 34, 44, 71, 101, 110, 101, 114, 97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 84, 104, 114, 111, 119, 93, 41, 59, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 34, 44, 10, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 124, 52, 124, 49, 41, 59, 10, 37, 83, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101, 44, 36, 70, 117, 110, 99, 116, 105, 111, 110, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 59, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101, 44, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 41, 59, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 34, 44, 10, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 44, 50, 124, 52, 124, 49, 41, 59, 10, 37, 83, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 44, 36, 70, 117, 110, 99, 116, 105, 111, 110, 41, 59, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 44, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 41, 59, 10, 125, 10, 10, 83, 101, 116, 85, 112, 71, 101, 110, 101, 114, 97, 116, 111, 114, 115, 40, 41, 59, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 10, 10, 10, 10, 10, 118, 97, 114, 32, 65, 82, 82, 65, 89, 95, 73, 84, 69, 82, 65, 84, 79, 82, 95, 75, 73, 78, 68, 95, 75, 69, 89, 83, 61, 49, 59, 10, 118, 97, 114, 32, 65, 82, 82, 65, 89, 95, 73, 84, 69, 82, 65, 84, 79, 82, 95, 75, 73, 78, 68, 95, 86, 65, 76, 85, 69, 83, 61, 50, 59, 10, 118, 97, 114, 32, 65, 82, 82, 65, 89, 95, 73, 84, 69, 82, 65, 84, 79, 82, 95, 75, 73, 78, 68, 95, 69, 78, 84, 82, 73, 69, 83, 61, 51, 59, 10, 10, 10, 118, 97, 114, 32, 105, 116, 101, 114, 97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 83, 121, 109, 98, 111, 108, 61, 37, 67, 114, 101, 97, 116, 101, 83, 121, 109, 98, 111, 108, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 118, 97, 114, 32, 97, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 78, 101, 120, 116, 73, 110, 100, 101, 120, 83, 121, 109, 98, 111, 108, 61, 37, 67, 114, 101, 97, 116, 101, 83, 121, 109, 98, 111, 108, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 118, 97, 114, 32, 97, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 105, 111, 110, 75, 105, 110, 100, 83, 121, 109, 98, 111, 108, 61, 37, 67, 114, 101, 97, 116, 101, 83, 121, 109, 98, 111, 108, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 40, 41, 123, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 114, 101, 97, 116, 101, 65, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 97, 41, 59, 10, 118, 97, 114, 32, 100, 61, 110, 101, 119, 32, 65, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 59, 10, 100, 91, 105, 116, 101, 114, 97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 83, 121, 109, 98, 111, 108, 93, 61, 99, 59, 10, 100, 91, 97, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 78, 101, 120, 116, 73, 110, 100, 101, 120, 83, 121, 109, 98, 111, 108, 93, 61, 48, 59, 10, 100, 91, 97, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 105, 111, 110, 75, 105, 110, 100, 83, 121, 109, 98, 111, 108, 93, 61, 98, 59, 10, 114, 101, 116, 117, 114, 110, 32, 100, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 114, 101, 97, 116, 101, 73, 116, 101, 114, 97, 116, 111, 114, 82, 101, 115, 117, 108, 116, 79, 98, 106, 101, 99, 116, 40, 97, 44, 98, 41, 123, 10, 114, 101, 116, 117, 114, 110, 123, 118, 97, 108, 117, 101, 58, 97, 44, 100, 111, 110, 101, 58, 98, 125, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 78, 101, 120, 116, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 98, 61, 97, 91, 105, 116, 101, 114, 97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 83, 121, 109, 98, 111, 108, 93, 59, 10, 105, 102, 40, 33, 98, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 65, 114, 114, 97, 121, 32, 73, 116, 101, 114, 97, 116, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 110, 101, 120, 116, 39, 93, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 99, 61, 97, 91, 97, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 78, 101, 120, 116, 73, 110, 100, 101, 120, 83, 121, 109, 98, 111, 108, 93, 59, 10, 118, 97, 114, 32, 100, 61, 97, 91, 97, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 105, 111, 110, 75, 105, 110, 100, 83, 121, 109, 98, 111, 108, 93, 59, 10, 118, 97, 114, 32, 101, 61, 40, 98, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 10, 10, 10, 105, 102, 40, 99, 62, 61, 101, 41, 123, 10, 97, 91, 97, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 78, 101, 120, 116, 73, 110, 100, 101, 120, 83, 121, 109, 98, 111, 108, 93, 61, 49, 47, 48, 59, 10, 114, 101, 116, 117, 114, 110, 32, 67, 114, 101, 97, 116, 101, 73, 116, 101, 114, 97, 116, 111, 114, 82, 101, 115, 117, 108, 116, 79, 98, 106, 101, 99, 116, 40, 118, 111, 105, 100, 32, 48, 44, 116, 114, 117, 101, 41, 59, 10, 125, 10, 10, 97, 91, 97, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 78, 101, 120, 116, 73, 110, 100, 101, 120, 83, 121, 109, 98, 111, 108, 93, 61, 99, 43, 49, 59, 10, 10, 105, 102, 40, 100, 61, 61, 65, 82, 82, 65, 89, 95, 73, 84, 69, 82, 65, 84, 79, 82, 95, 75, 73, 78, 68, 95, 86, 65, 76, 85, 69, 83, 41, 10, 114, 101, 116, 117, 114, 110, 32, 67, 114, 101, 97, 116, 101, 73, 116, 101, 114, 97, 116, 111, 114, 82, 101, 115, 117, 108, 116, 79, 98, 106, 101, 99, 116, 40, 98, 91, 99, 93, 44, 102, 97, 108, 115, 101, 41, 59, 10, 10, 105, 102, 40, 100, 61, 61, 65, 82, 82, 65, 89, 95, 73, 84, 69, 82, 65, 84, 79, 82, 95, 75, 73, 78, 68, 95, 69, 78, 84, 82, 73, 69, 83, 41, 10, 114, 101, 116, 117, 114, 110, 32, 67, 114, 101, 97, 116, 101, 73, 116, 101, 114, 97, 116, 111, 114, 82, 101, 115, 117, 108, 116, 79, 98, 106, 101, 99, 116, 40, 91, 99, 44, 98, 91, 99, 93, 93, 44, 102, 97, 108, 115, 101, 41, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 67, 114, 101, 97, 116, 101, 73, 116, 101, 114, 97, 116, 111, 114, 82, 101, 115, 117, 108, 116, 79, 98, 106, 101, 99, 116, 40, 99, 44, 102, 97, 108, 115, 101, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 69, 110, 116, 114, 105, 101, 115, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 67, 114, 101, 97, 116, 101, 65, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 40, 116, 104, 105, 115, 44, 65, 82, 82, 65, 89, 95, 73, 84, 69, 82, 65, 84, 79, 82, 95, 75, 73, 78, 68, 95, 69, 78, 84, 82, 73, 69, 83, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 86, 97, 108, 117, 101, 115, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 67, 114, 101, 97, 116, 101, 65, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 40, 116, 104, 105, 115, 44, 65, 82, 82, 65, 89, 95, 73, 84, 69, 82, 65, 84, 79, 82, 95, 75, 73, 78, 68, 95, 86, 65, 76, 85, 69, 83, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 67, 114, 101, 97, 116, 101, 65, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 40, 116, 104, 105, 115, 44, 65, 82, 82, 65, 89, 95, 73, 84, 69, 82, 65, 84, 79, 82, 95, 75, 73, 78, 68, 95, 75, 69, 89, 83, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 85, 112, 65, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 73, 110, 115, 116, 97, 110, 99, 101, 67, 108, 97, 115, 115, 78, 97, 109, 101, 40, 65, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 44, 39, 65, 114, 114, 97, 121, 32, 73, 116, 101, 114, 97, 116, 111, 114, 39, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 82, 101, 97, 100, 79, 110, 108, 121, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 65, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 41, 59, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 65, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 39, 110, 101, 120, 116, 39, 44, 65, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 78, 101, 120, 116, 10, 41, 41, 59, 10, 125, 10, 10, 83, 101, 116, 85, 112, 65, 114, 114, 97, 121, 73, 116, 101, 114, 97, 116, 111, 114, 40, 41, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 120, 116, 101, 110, 100, 65, 114, 114, 97, 121, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 39, 101, 110, 116, 114, 105, 101, 115, 39, 44, 65, 114, 114, 97, 121, 69, 110, 116, 114, 105, 101, 115, 44, 10, 39, 118, 97, 108, 117, 101, 115, 39, 44, 65, 114, 114, 97, 121, 86, 97, 108, 117, 101, 115, 44, 10, 39, 107, 101, 121, 115, 39, 44, 65, 114, 114, 97, 121, 75, 101, 121, 115, 10, 41, 41, 59, 10, 125, 10, 10, 69, 120, 116, 101, 110, 100, 65, 114, 114, 97, 121, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41, 59, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 82, 101, 112, 101, 97, 116, 40, 97, 41, 123, 10, 105, 102, 40, 40, 116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 99, 97, 108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117, 110, 100, 101, 102, 105, 110, 101, 100, 34, 44, 10, 91, 34, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 112, 101, 97, 116, 34, 93, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 99, 61, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 97, 41, 59, 10, 105, 102, 40, 99, 60, 48, 124, 124, 33, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 99, 41, 41, 124, 124, 40, 40, 99, 61, 61, 99, 41, 38, 38, 40, 99, 33, 61, 49, 47, 48, 41, 38, 38, 40, 99, 33, 61, 45, 49, 47, 48, 41, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 34, 105, 110, 118, 97, 108, 105, 100, 95, 99, 111, 117, 110, 116, 95, 118, 97, 108, 117, 101, 34, 44, 91, 93, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 100, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 99, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 101, 61, 48, 59, 101, 60, 99, 59, 101, 43, 43, 41, 123, 10, 100, 91, 101, 93, 61, 98, 59, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 66, 117, 105, 108, 100, 101, 114, 67, 111, 110, 99, 97, 116, 40, 100, 44, 99, 44, 34, 34, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 116, 97, 114, 116, 115, 87, 105, 116, 104, 40, 97, 41, 123, 10, 105, 102, 40, 40, 116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 99, 97, 108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117, 110, 100, 101, 102, 105, 110, 101, 100, 34, 44, 10, 91, 34, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 116, 97, 114, 116, 115, 87, 105, 116, 104, 34, 93, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 118, 97, 114, 32, 100, 61, 48, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 100, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 100, 61, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 100, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 101, 61, 98, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 102, 61, 77, 97, 116, 104, 77, 105, 110, 40, 77, 97, 116, 104, 77, 97, 120, 40, 100, 44, 48, 41, 44, 101, 41, 59, 10, 118, 97, 114, 32, 103, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 105, 102, 40, 103, 43, 102, 62, 101, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 40, 98, 44, 99, 44, 102, 41, 61, 61, 61, 102, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 69, 110, 100, 115, 87, 105, 116, 104, 40, 97, 41, 123, 10, 105, 102, 40, 40, 116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 99, 97, 108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117, 110, 100, 101, 102, 105, 110, 101, 100, 34, 44, 10, 91, 34, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 101, 110, 100, 115, 87, 105, 116, 104, 34, 93, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 118, 97, 114, 32, 100, 61, 98, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 101, 61, 100, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 118, 97, 114, 32, 102, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 102, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 101, 61, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 102, 41, 59, 10, 125, 10, 125, 10, 10, 118, 97, 114, 32, 103, 61, 77, 97, 116, 104, 77, 105, 110, 40, 77, 97, 116, 104, 77, 97, 120, 40, 101, 44, 48, 41, 44, 100, 41, 59, 10, 118, 97, 114, 32, 104, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 105, 61, 103, 45, 104, 59, 10, 105, 102, 40, 105, 60, 48, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 76, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 40, 98, 44, 99, 44, 105, 41, 61, 61, 61, 105, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 67, 111, 110, 116, 97, 105, 110, 115, 40, 97, 41, 123, 10, 105, 102, 40, 40, 116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 99, 97, 108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117, 110, 100, 101, 102, 105, 110, 101, 100, 34, 44, 10, 91, 34, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 111, 110, 116, 97, 105, 110, 115, 34, 93, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 118, 97, 114, 32, 100, 61, 48, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 100, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 100, 61, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 100, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 101, 61, 98, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 102, 61, 77, 97, 116, 104, 77, 105, 110, 40, 77, 97, 116, 104, 77, 97, 120, 40, 100, 44, 48, 41, 44, 101, 41, 59, 10, 118, 97, 114, 32, 103, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 105, 102, 40, 103, 43, 102, 62, 101, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 40, 98, 44, 99, 44, 102, 41, 33, 61, 61, 45, 49, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 120, 116, 101, 110, 100, 83, 116, 114, 105, 110, 103, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 114, 101, 112, 101, 97, 116, 34, 44, 83, 116, 114, 105, 110, 103, 82, 101, 112, 101, 97, 116, 44, 10, 34, 115, 116, 97, 114, 116, 115, 87, 105, 116, 104, 34, 44, 83, 116, 114, 105, 110, 103, 83, 116, 97, 114, 116, 115, 87, 105, 116, 104, 44, 10, 34, 101, 110, 100, 115, 87, 105, 116, 104, 34, 44, 83, 116, 114, 105, 110, 103, 69, 110, 100, 115, 87, 105, 116, 104, 44, 10, 34, 99, 111, 110, 116, 97, 105, 110, 115, 34, 44, 83, 116, 114, 105, 110, 103, 67, 111, 110, 116, 97, 105, 110, 115, 10, 41, 41, 59, 10, 125, 10, 10, 69, 120, 116, 101, 110, 100, 83, 116, 114, 105, 110, 103, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41, 59, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 10, 10, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 70, 105, 110, 100, 40, 97, 41, 123, 10, 105, 102, 40, 40, 116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 99, 97, 108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117, 110, 100, 101, 102, 105, 110, 101, 100, 34, 44, 10, 91, 34, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 102, 105, 110, 100, 34, 93, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 98, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 99, 61, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 98, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 97, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 100, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 100, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 125, 10, 10, 105, 102, 40, 40, 100, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 100, 61, 37, 71, 101, 116, 68, 101, 102, 97, 117, 108, 116, 82, 101, 99, 101, 105, 118, 101, 114, 40, 97, 41, 124, 124, 100, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 100, 41, 41, 38, 38, 37, 73, 115, 67, 108, 97, 115, 115, 105, 99, 77, 111, 100, 101, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 123, 10, 100, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 100, 41, 59, 10, 125, 10, 10, 102, 111, 114, 40, 118, 97, 114, 32, 101, 61, 48, 59, 101, 60, 99, 59, 101, 43, 43, 41, 123, 10, 105, 102, 40, 101, 32, 105, 110, 32, 98, 41, 123, 10, 118, 97, 114, 32, 102, 61, 98, 91, 101, 93, 59, 10, 105, 102, 40, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 100, 44, 102, 44, 101, 44, 98, 44, 97, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 59, 10, 125, 10, 125, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 70, 105, 110, 100, 73, 110, 100, 101, 120, 40, 97, 41, 123, 10, 105, 102, 40, 40, 116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 99, 97, 108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117, 110, 100, 101, 102, 105, 110, 101, 100, 34, 44, 10, 91, 34, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 102, 105, 110, 100, 73, 110, 100, 101, 120, 34, 93, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 98, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 99, 61, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 98, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 97, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 100, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 100, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 125, 10, 10, 105, 102, 40, 40, 100, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 100, 61, 37, 71, 101, 116, 68, 101, 102, 97, 117, 108, 116, 82, 101, 99, 101, 105, 118, 101, 114, 40, 97, 41, 124, 124, 100, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 100, 41, 41, 38, 38, 37, 73, 115, 67, 108, 97, 115, 115, 105, 99, 77, 111, 100, 101, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 123, 10, 100, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 100, 41, 59, 10, 125, 10, 10, 102, 111, 114, 40, 118, 97, 114, 32, 101, 61, 48, 59, 101, 60, 99, 59, 101, 43, 43, 41, 123, 10, 105, 102, 40, 101, 32, 105, 110, 32, 98, 41, 123, 10, 118, 97, 114, 32, 102, 61, 98, 91, 101, 93, 59, 10, 105, 102, 40, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 100, 44, 102, 44, 101, 44, 98, 44, 97, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 101, 59, 10, 125, 10, 125, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 72, 97, 114, 109, 111, 110, 121, 65, 114, 114, 97, 121, 69, 120, 116, 101, 110, 100, 65, 114, 114, 97, 121, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 102, 105, 110, 100, 34, 44, 65, 114, 114, 97, 121, 70, 105, 110, 100, 44, 10, 34, 102, 105, 110, 100, 73, 110, 100, 101, 120, 34, 44, 65, 114, 114, 97, 121, 70, 105, 110, 100, 73, 110, 100, 101, 120, 10, 41, 41, 59, 10, 125, 10, 10, 72, 97, 114, 109, 111, 110, 121, 65, 114, 114, 97, 121, 69, 120, 116, 101, 110, 100, 65, 114, 114, 97, 121, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41, 59, 10 };
+
+  static const char* raw_sources = reinterpret_cast<const char*>(sources);
+
+  template <>
+  int NativesCollection<EXPERIMENTAL>::GetBuiltinsCount() {
+    return 10;
+  }
+
+  template <>
+  int NativesCollection<EXPERIMENTAL>::GetDebuggerCount() {
+    return 0;
+  }
+
+  template <>
+  int NativesCollection<EXPERIMENTAL>::GetIndex(const char* name) {
+    if (strcmp(name, "symbol") == 0) return 0;
+    if (strcmp(name, "proxy") == 0) return 1;
+    if (strcmp(name, "collection") == 0) return 2;
+    if (strcmp(name, "object-observe") == 0) return 3;
+    if (strcmp(name, "arraybuffer") == 0) return 4;
+    if (strcmp(name, "typedarray") == 0) return 5;
+    if (strcmp(name, "generator") == 0) return 6;
+    if (strcmp(name, "array-iterator") == 0) return 7;
+    if (strcmp(name, "harmony-string") == 0) return 8;
+    if (strcmp(name, "harmony-array") == 0) return 9;
+    return -1;
+  }
+
+  template <>
+  int NativesCollection<EXPERIMENTAL>::GetRawScriptsSize() {
+    return 40719;
+  }
+
+  template <>
+  Vector<const char> NativesCollection<EXPERIMENTAL>::GetRawScriptSource(int index) {
+    if (index == 0) return Vector<const char>(raw_sources + 0, 1135);
+    if (index == 1) return Vector<const char>(raw_sources + 1135, 3319);
+    if (index == 2) return Vector<const char>(raw_sources + 4454, 6977);
+    if (index == 3) return Vector<const char>(raw_sources + 11431, 8499);
+    if (index == 4) return Vector<const char>(raw_sources + 19930, 1543);
+    if (index == 5) return Vector<const char>(raw_sources + 21473, 12109);
+    if (index == 6) return Vector<const char>(raw_sources + 33582, 1429);
+    if (index == 7) return Vector<const char>(raw_sources + 35011, 1957);
+    if (index == 8) return Vector<const char>(raw_sources + 36968, 2339);
+    if (index == 9) return Vector<const char>(raw_sources + 39307, 1412);
+    return Vector<const char>("", 0);
+  }
+
+  template <>
+  Vector<const char> NativesCollection<EXPERIMENTAL>::GetScriptName(int index) {
+    if (index == 0) return Vector<const char>("native symbol.js", 16);
+    if (index == 1) return Vector<const char>("native proxy.js", 15);
+    if (index == 2) return Vector<const char>("native collection.js", 20);
+    if (index == 3) return Vector<const char>("native object-observe.js", 24);
+    if (index == 4) return Vector<const char>("native arraybuffer.js", 21);
+    if (index == 5) return Vector<const char>("native typedarray.js", 20);
+    if (index == 6) return Vector<const char>("native generator.js", 19);
+    if (index == 7) return Vector<const char>("native array-iterator.js", 24);
+    if (index == 8) return Vector<const char>("native harmony-string.js", 24);
+    if (index == 9) return Vector<const char>("native harmony-array.js", 23);
+    return Vector<const char>("", 0);
+  }
+
+  template <>
+  Vector<const byte> NativesCollection<EXPERIMENTAL>::GetScriptsSource() {
+    return Vector<const byte>(sources, 40719);
+  }
+
+  template <>
+  void NativesCollection<EXPERIMENTAL>::SetRawScriptsSource(Vector<const char> raw_source) {
+    ASSERT(40719 == raw_source.length());
+    raw_sources = raw_source.start();
+  }
+
+}  // internal
+}  // v8
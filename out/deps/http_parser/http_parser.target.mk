@@ -0,0 +1,132 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := http_parser
+DEFS_Debug := \
+	'-DOPENSSL_NO_SSL2=1' \
+	'-DHTTP_PARSER_STRICT=0' \
+	'-DDEBUG' \
+	'-D_DEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wno-unused-parameter \
+	-m64 \
+	-g \
+	-O0
+
+# Flags passed to only C files.
+CFLAGS_C_Debug :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fno-rtti \
+	-fno-exceptions
+
+INCS_Debug := \
+	-I$(srcdir)/deps/http_parser
+
+DEFS_Release := \
+	'-DOPENSSL_NO_SSL2=1' \
+	'-DHTTP_PARSER_STRICT=0' \
+	'-DNDEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wno-unused-parameter \
+	-m64 \
+	-O3 \
+	-ffunction-sections \
+	-fdata-sections \
+	-fno-tree-vrp
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fno-rtti \
+	-fno-exceptions
+
+INCS_Release := \
+	-I$(srcdir)/deps/http_parser
+
+OBJS := \
+	$(obj).target/$(TARGET)/deps/http_parser/http_parser.o
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# CFLAGS et al overrides must be target-local.
+# See "Target-specific Variable Values" in the GNU Make manual.
+$(OBJS): TOOLSET := $(TOOLSET)
+$(OBJS): GYP_CFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_C_$(BUILDTYPE))
+$(OBJS): GYP_CXXFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_CC_$(BUILDTYPE))
+
+# Suffix rules, putting all outputs into $(obj).
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.c FORCE_DO_CMD
+	@$(call do_cmd,cc,1)
+
+# Try building from generated source, too.
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.c FORCE_DO_CMD
+	@$(call do_cmd,cc,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.c FORCE_DO_CMD
+	@$(call do_cmd,cc,1)
+
+# End of this set of suffix rules
+### Rules for final target.
+LDFLAGS_Debug := \
+	-pthread \
+	-rdynamic \
+	-m64
+
+LDFLAGS_Release := \
+	-pthread \
+	-rdynamic \
+	-m64 \
+	-Wl,--gc-sections
+
+LIBS :=
+
+$(obj).target/deps/http_parser/libhttp_parser.a: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
+$(obj).target/deps/http_parser/libhttp_parser.a: LIBS := $(LIBS)
+$(obj).target/deps/http_parser/libhttp_parser.a: TOOLSET := $(TOOLSET)
+$(obj).target/deps/http_parser/libhttp_parser.a: $(OBJS) FORCE_DO_CMD
+	$(call do_cmd,alink)
+
+all_deps += $(obj).target/deps/http_parser/libhttp_parser.a
+# Add target alias
+.PHONY: http_parser
+http_parser: $(obj).target/deps/http_parser/libhttp_parser.a
+
+# Add target alias to "all" target.
+.PHONY: all
+all: http_parser
+
+# Add target alias
+.PHONY: http_parser
+http_parser: $(builddir)/libhttp_parser.a
+
+# Copy this to the static library output path.
+$(builddir)/libhttp_parser.a: TOOLSET := $(TOOLSET)
+$(builddir)/libhttp_parser.a: $(obj).target/deps/http_parser/libhttp_parser.a FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += $(builddir)/libhttp_parser.a
+# Short alias for building this static library.
+.PHONY: libhttp_parser.a
+libhttp_parser.a: $(obj).target/deps/http_parser/libhttp_parser.a $(builddir)/libhttp_parser.a
+
+# Add static library to "all" target.
+.PHONY: all
+all: $(builddir)/libhttp_parser.a
+
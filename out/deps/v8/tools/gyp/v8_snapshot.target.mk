@@ -0,0 +1,184 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := v8_snapshot
+### Rules for action "run_mksnapshot":
+quiet_cmd__root_repo_deps_v8_tools_gyp_v8_gyp_v8_snapshot_target_run_mksnapshot = ACTION _root_repo_deps_v8_tools_gyp_v8_gyp_v8_snapshot_target_run_mksnapshot $@
+cmd__root_repo_deps_v8_tools_gyp_v8_gyp_v8_snapshot_target_run_mksnapshot = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/deps/v8/tools/gyp; mkdir -p $(obj).$(TOOLSET)/v8_snapshot/geni; "$(builddir)/mksnapshot.x64" --log-snapshot-positions --logfile "$(obj).$(TOOLSET)/v8_snapshot/geni/snapshot.log" "$(obj).$(TOOLSET)/v8_snapshot/geni/snapshot.cc"
+
+$(obj).$(TOOLSET)/$(TARGET)/geni/snapshot.cc: obj := $(abs_obj)
+$(obj).$(TOOLSET)/$(TARGET)/geni/snapshot.cc: builddir := $(abs_builddir)
+$(obj).$(TOOLSET)/$(TARGET)/geni/snapshot.cc: TOOLSET := $(TOOLSET)
+$(obj).$(TOOLSET)/$(TARGET)/geni/snapshot.cc: $(builddir)/mksnapshot.x64 FORCE_DO_CMD
+	$(call do_cmd,_root_repo_deps_v8_tools_gyp_v8_gyp_v8_snapshot_target_run_mksnapshot)
+
+all_deps += $(obj).$(TOOLSET)/$(TARGET)/geni/snapshot.cc
+action__root_repo_deps_v8_tools_gyp_v8_gyp_v8_snapshot_target_run_mksnapshot_outputs := $(obj).$(TOOLSET)/$(TARGET)/geni/snapshot.cc
+
+
+DEFS_Debug := \
+	'-DOPENSSL_NO_SSL2=1' \
+	'-DV8_TARGET_ARCH_X64' \
+	'-DENABLE_DEBUGGER_SUPPORT' \
+	'-DDEBUG' \
+	'-D_DEBUG' \
+	'-DENABLE_DISASSEMBLER' \
+	'-DV8_ENABLE_CHECKS' \
+	'-DOBJECT_PRINT' \
+	'-DVERIFY_HEAP' \
+	'-DENABLE_EXTRA_CHECKS'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wno-unused-parameter \
+	-m64 \
+	-fno-strict-aliasing \
+	-m64 \
+	-g \
+	-Wall \
+	-Werror \
+	-W \
+	-Wno-unused-parameter \
+	-Wnon-virtual-dtor \
+	-Woverloaded-virtual \
+	 \
+	-fdata-sections \
+	-ffunction-sections
+
+# Flags passed to only C files.
+CFLAGS_C_Debug :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fno-rtti \
+	-fno-exceptions
+
+INCS_Debug := \
+	-I$(srcdir)/deps/v8/src
+
+DEFS_Release := \
+	'-DOPENSSL_NO_SSL2=1' \
+	'-DV8_TARGET_ARCH_X64' \
+	'-DENABLE_DEBUGGER_SUPPORT'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wno-unused-parameter \
+	-m64 \
+	-fno-strict-aliasing \
+	-m64 \
+	-O3 \
+	-ffunction-sections \
+	-fdata-sections \
+	-fno-tree-vrp \
+	-fdata-sections \
+	-ffunction-sections \
+	-O3 \
+	
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fno-rtti \
+	-fno-exceptions
+
+INCS_Release := \
+	-I$(srcdir)/deps/v8/src
+
+OBJS := \
+	$(obj).target/$(TARGET)/gen/libraries.o \
+	$(obj).target/$(TARGET)/gen/experimental-libraries.o \
+	$(obj).$(TOOLSET)/$(TARGET)/geni/snapshot.o
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(builddir)/mksnapshot.x64 $(obj).target/deps/v8/tools/gyp/js2c.stamp
+
+# Make sure our actions/rules run before any of us.
+$(OBJS): | $(action__root_repo_deps_v8_tools_gyp_v8_gyp_v8_snapshot_target_run_mksnapshot_outputs)
+
+# CFLAGS et al overrides must be target-local.
+# See "Target-specific Variable Values" in the GNU Make manual.
+$(OBJS): TOOLSET := $(TOOLSET)
+$(OBJS): GYP_CFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_C_$(BUILDTYPE))
+$(OBJS): GYP_CXXFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_CC_$(BUILDTYPE))
+
+# Suffix rules, putting all outputs into $(obj).
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# Try building from generated source, too.
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# End of this set of suffix rules
+### Rules for final target.
+# Build our special outputs first.
+$(obj).target/deps/v8/tools/gyp/libv8_snapshot.a: | $(action__root_repo_deps_v8_tools_gyp_v8_gyp_v8_snapshot_target_run_mksnapshot_outputs)
+
+# Preserve order dependency of special output on deps.
+$(action__root_repo_deps_v8_tools_gyp_v8_gyp_v8_snapshot_target_run_mksnapshot_outputs): | $(builddir)/mksnapshot.x64 $(obj).target/deps/v8/tools/gyp/js2c.stamp
+
+LDFLAGS_Debug := \
+	-pthread \
+	-rdynamic \
+	-m64 \
+	-m64
+
+LDFLAGS_Release := \
+	-pthread \
+	-rdynamic \
+	-m64 \
+	-m64 \
+	-Wl,--gc-sections
+
+LIBS :=
+
+$(obj).target/deps/v8/tools/gyp/libv8_snapshot.a: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
+$(obj).target/deps/v8/tools/gyp/libv8_snapshot.a: LIBS := $(LIBS)
+$(obj).target/deps/v8/tools/gyp/libv8_snapshot.a: TOOLSET := $(TOOLSET)
+$(obj).target/deps/v8/tools/gyp/libv8_snapshot.a: $(OBJS) FORCE_DO_CMD
+	$(call do_cmd,alink)
+
+all_deps += $(obj).target/deps/v8/tools/gyp/libv8_snapshot.a
+# Add target alias
+.PHONY: v8_snapshot
+v8_snapshot: $(obj).target/deps/v8/tools/gyp/libv8_snapshot.a
+
+# Add target alias to "all" target.
+.PHONY: all
+all: v8_snapshot
+
+# Add target alias
+.PHONY: v8_snapshot
+v8_snapshot: $(builddir)/libv8_snapshot.a
+
+# Copy this to the static library output path.
+$(builddir)/libv8_snapshot.a: TOOLSET := $(TOOLSET)
+$(builddir)/libv8_snapshot.a: $(obj).target/deps/v8/tools/gyp/libv8_snapshot.a FORCE_DO_CMD
+	$(call do_cmd,copy)
+
+all_deps += $(builddir)/libv8_snapshot.a
+# Short alias for building this static library.
+.PHONY: libv8_snapshot.a
+libv8_snapshot.a: $(obj).target/deps/v8/tools/gyp/libv8_snapshot.a $(builddir)/libv8_snapshot.a
+
+# Add static library to "all" target.
+.PHONY: all
+all: $(builddir)/libv8_snapshot.a
+
@@ -0,0 +1,189 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := node
+DEFS_Debug := \
+	'-DOPENSSL_NO_SSL2=1' \
+	'-DNODE_WANT_INTERNALS=1' \
+	'-DARCH="x64"' \
+	'-DPLATFORM="linux"' \
+	'-DNODE_TAG=""' \
+	'-DHAVE_OPENSSL=1' \
+	'-D__POSIX__' \
+	'-D_LARGEFILE_SOURCE' \
+	'-D_FILE_OFFSET_BITS=64' \
+	'-D_POSIX_C_SOURCE=200112' \
+	'-DDEBUG' \
+	'-D_DEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Debug := \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wno-unused-parameter \
+	-m64 \
+	-g \
+	-O0
+
+# Flags passed to only C files.
+CFLAGS_C_Debug :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := \
+	-fno-rtti \
+	-fno-exceptions
+
+INCS_Debug := \
+	-I$(srcdir)/src \
+	-I$(srcdir)/tools/msvs/genfiles \
+	-I$(srcdir)/deps/uv/src/ares \
+	-I$(obj)/gen \
+	-I$(srcdir)/deps/openssl/openssl/include \
+	-I$(srcdir)/deps/v8/include \
+	-I$(srcdir)/deps/zlib \
+	-I$(srcdir)/deps/http_parser \
+	-I$(srcdir)/deps/cares/include \
+	-I$(srcdir)/deps/uv/include
+
+DEFS_Release := \
+	'-DOPENSSL_NO_SSL2=1' \
+	'-DNODE_WANT_INTERNALS=1' \
+	'-DARCH="x64"' \
+	'-DPLATFORM="linux"' \
+	'-DNODE_TAG=""' \
+	'-DHAVE_OPENSSL=1' \
+	'-D__POSIX__' \
+	'-D_LARGEFILE_SOURCE' \
+	'-D_FILE_OFFSET_BITS=64' \
+	'-D_POSIX_C_SOURCE=200112'
+
+# Flags passed to all source files.
+CFLAGS_Release := \
+	-pthread \
+	-Wall \
+	-Wextra \
+	-Wno-unused-parameter \
+	-m64 \
+	-O3 \
+	-ffunction-sections \
+	-fdata-sections \
+	-fno-tree-vrp
+
+# Flags passed to only C files.
+CFLAGS_C_Release :=
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := \
+	-fno-rtti \
+	-fno-exceptions
+
+INCS_Release := \
+	-I$(srcdir)/src \
+	-I$(srcdir)/tools/msvs/genfiles \
+	-I$(srcdir)/deps/uv/src/ares \
+	-I$(obj)/gen \
+	-I$(srcdir)/deps/openssl/openssl/include \
+	-I$(srcdir)/deps/v8/include \
+	-I$(srcdir)/deps/zlib \
+	-I$(srcdir)/deps/http_parser \
+	-I$(srcdir)/deps/cares/include \
+	-I$(srcdir)/deps/uv/include
+
+OBJS := \
+	$(obj).target/$(TARGET)/src/fs_event_wrap.o \
+	$(obj).target/$(TARGET)/src/cares_wrap.o \
+	$(obj).target/$(TARGET)/src/handle_wrap.o \
+	$(obj).target/$(TARGET)/src/node.o \
+	$(obj).target/$(TARGET)/src/node_buffer.o \
+	$(obj).target/$(TARGET)/src/node_constants.o \
+	$(obj).target/$(TARGET)/src/node_extensions.o \
+	$(obj).target/$(TARGET)/src/node_file.o \
+	$(obj).target/$(TARGET)/src/node_http_parser.o \
+	$(obj).target/$(TARGET)/src/node_javascript.o \
+	$(obj).target/$(TARGET)/src/node_main.o \
+	$(obj).target/$(TARGET)/src/node_os.o \
+	$(obj).target/$(TARGET)/src/node_script.o \
+	$(obj).target/$(TARGET)/src/node_stat_watcher.o \
+	$(obj).target/$(TARGET)/src/node_threadpool.o \
+	$(obj).target/$(TARGET)/src/node_watchdog.o \
+	$(obj).target/$(TARGET)/src/node_zlib.o \
+	$(obj).target/$(TARGET)/src/pipe_wrap.o \
+	$(obj).target/$(TARGET)/src/signal_wrap.o \
+	$(obj).target/$(TARGET)/src/slab_allocator.o \
+	$(obj).target/$(TARGET)/src/smalloc.o \
+	$(obj).target/$(TARGET)/src/string_bytes.o \
+	$(obj).target/$(TARGET)/src/stream_wrap.o \
+	$(obj).target/$(TARGET)/src/tcp_wrap.o \
+	$(obj).target/$(TARGET)/src/timer_wheel.o \
+	$(obj).target/$(TARGET)/src/timer_wrap.o \
+	$(obj).target/$(TARGET)/src/tty_wrap.o \
+	$(obj).target/$(TARGET)/src/process_wrap.o \
+	$(obj).target/$(TARGET)/src/udp_wrap.o \
+	$(obj).target/$(TARGET)/src/uv.o \
+	$(obj).target/$(TARGET)/src/node_crypto.o \
+	$(obj).target/$(TARGET)/src/node_crypto_bio.o \
+	$(obj).target/$(TARGET)/src/node_crypto_clienthello.o \
+	$(obj).target/$(TARGET)/src/tls_wrap.o
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).host/node_js2c.stamp $(builddir)/libopenssl.a $(obj).target/deps/v8/tools/gyp/postmortem-metadata.stamp $(obj).target/deps/v8/tools/gyp/v8.stamp $(builddir)/libchrome_zlib.a $(builddir)/libhttp_parser.a $(builddir)/libcares.a $(builddir)/libuv.a $(builddir)/libv8_base.x64.a $(builddir)/libv8_snapshot.a $(obj).target/deps/v8/tools/gyp/js2c.stamp $(obj).target/deps/openssl/libopenssl.a $(obj).target/deps/zlib/libchrome_zlib.a $(obj).target/deps/http_parser/libhttp_parser.a $(obj).target/deps/cares/libcares.a $(obj).target/deps/uv/libuv.a $(obj).target/deps/v8/tools/gyp/libv8_base.x64.a $(obj).target/deps/v8/tools/gyp/libv8_snapshot.a
+
+# CFLAGS et al overrides must be target-local.
+# See "Target-specific Variable Values" in the GNU Make manual.
+$(OBJS): TOOLSET := $(TOOLSET)
+$(OBJS): GYP_CFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_C_$(BUILDTYPE))
+$(OBJS): GYP_CXXFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_CC_$(BUILDTYPE))
+
+# Suffix rules, putting all outputs into $(obj).
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# Try building from generated source, too.
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# End of this set of suffix rules
+### Rules for final target.
+LDFLAGS_Debug := \
+	-pthread \
+	-rdynamic \
+	-m64 \
+	-pthread
+
+LDFLAGS_Release := \
+	-pthread \
+	-rdynamic \
+	-m64 \
+	-pthread \
+	-Wl,--gc-sections
+
+LIBS := \
+	-lm \
+	-ldl \
+	-lrt
+
+$(builddir)/node: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
+$(builddir)/node: LIBS := $(LIBS)
+$(builddir)/node: LD_INPUTS := $(OBJS) $(obj).target/deps/openssl/libopenssl.a $(obj).target/deps/zlib/libchrome_zlib.a $(obj).target/deps/http_parser/libhttp_parser.a $(obj).target/deps/cares/libcares.a $(obj).target/deps/uv/libuv.a $(obj).target/deps/v8/tools/gyp/libv8_base.x64.a $(obj).target/deps/v8/tools/gyp/libv8_snapshot.a
+$(builddir)/node: TOOLSET := $(TOOLSET)
+$(builddir)/node: $(OBJS) $(obj).target/deps/openssl/libopenssl.a $(obj).target/deps/zlib/libchrome_zlib.a $(obj).target/deps/http_parser/libhttp_parser.a $(obj).target/deps/cares/libcares.a $(obj).target/deps/uv/libuv.a $(obj).target/deps/v8/tools/gyp/libv8_base.x64.a $(obj).target/deps/v8/tools/gyp/libv8_snapshot.a FORCE_DO_CMD
+	$(call do_cmd,link)
+
+all_deps += $(builddir)/node
+# Add target alias
+.PHONY: node
+node: $(builddir)/node
+
+# Add executable to "all" target.
+.PHONY: all
+all: $(builddir)/node
+
@@ -22,6 +22,7 @@
 #define CARES_STATICLIB
 #include "ares.h"
 #include "node.h"
+#include "node_threadpool.h"
 #include "req_wrap.h"
 #include "tree.h"
 #include "uv.h"
@@ -294,6 +295,8 @@ class QueryWrap {
     MakeCallback(object(), oncomplete_sym, ARRAY_SIZE(argv), argv);
   }
 
+  // The extra argument is family for getaddrinfo, and the smallest TTL of
+  // the records in seconds for A and AAAA queries.
   void CallOnComplete(Local<Value> answer, Local<Value> family) {
     HandleScope scope(node_isolate);
     Local<Value> argv[3] = { Integer::New(0, node_isolate), answer, family };
@@ -323,6 +326,21 @@ class QueryWrap {
 };
 
 
+// Records past this many don't count towards the TTL of a reply.
+static const int kMaxTtls = 64;
+
+
+template <typename T>
+static Local<Integer> MinTtl(const T* ttls, int nttls) {
+  int ttl = 0;
+  for (int i = 0; i < nttls; i++) {
+    if (i == 0 || ttls[i].ttl < ttl)
+      ttl = ttls[i].ttl;
+  }
+  return Integer::New(ttl, node_isolate);
+}
+
+
 class QueryAWrap: public QueryWrap {
  public:
   explicit QueryAWrap(Local<Object> req_wrap_obj) : QueryWrap(req_wrap_obj) {
@@ -338,8 +356,10 @@ class QueryAWrap: public QueryWrap {
     HandleScope scope(node_isolate);
 
     struct hostent* host;
+    struct ares_addrttl ttls[kMaxTtls];
+    int nttls = ARRAY_SIZE(ttls);
 
-    int status = ares_parse_a_reply(buf, len, &host, NULL, NULL);
+    int status = ares_parse_a_reply(buf, len, &host, ttls, &nttls);
     if (status != ARES_SUCCESS) {
       this->ParseError(status);
       return;
@@ -348,7 +368,7 @@ class QueryAWrap: public QueryWrap {
     Local<Array> addresses = HostentToAddresses(host);
     ares_free_hostent(host);
 
-    this->CallOnComplete(addresses);
+    this->CallOnComplete(addresses, MinTtl(ttls, nttls));
   }
 };
 
@@ -373,8 +393,10 @@ class QueryAaaaWrap: public QueryWrap {
     HandleScope scope(node_isolate);
 
     struct hostent* host;
+    struct ares_addr6ttl ttls[kMaxTtls];
+    int nttls = ARRAY_SIZE(ttls);
 
-    int status = ares_parse_aaaa_reply(buf, len, &host, NULL, NULL);
+    int status = ares_parse_aaaa_reply(buf, len, &host, ttls, &nttls);
     if (status != ARES_SUCCESS) {
       this->ParseError(status);
       return;
@@ -383,7 +405,7 @@ class QueryAaaaWrap: public QueryWrap {
     Local<Array> addresses = HostentToAddresses(host);
     ares_free_hostent(host);
 
-    this->CallOnComplete(addresses);
+    this->CallOnComplete(addresses, MinTtl(ttls, nttls));
   }
 };
 
@@ -742,6 +764,9 @@ void AfterGetAddrInfo(uv_getaddrinfo_t* req, int status, struct addrinfo* res) {
   HandleScope scope(node_isolate);
 
   GetAddrInfoReqWrap* req_wrap = static_cast<GetAddrInfoReqWrap*>(req->data);
+  threadpool::RecordWork("dns",
+                         "getaddrinfo",
+                         reinterpret_cast<uv_req_t*>(req));
 
   Local<Value> argv[] = {
     Integer::New(status, node_isolate),
@@ -1045,6 +1070,10 @@ static void Initialize(Handle<Object> target) {
               Integer::New(AF_INET6, node_isolate));
   target->Set(FIXED_ONE_BYTE_STRING(node_isolate, "AF_UNSPEC"),
               Integer::New(AF_UNSPEC, node_isolate));
+  target->Set(FIXED_ONE_BYTE_STRING(node_isolate, "ARES_ENODATA"),
+              Integer::New(ARES_ENODATA, node_isolate));
+  target->Set(FIXED_ONE_BYTE_STRING(node_isolate, "ARES_ENOTFOUND"),
+              Integer::New(ARES_ENOTFOUND, node_isolate));
 
   oncomplete_sym = FIXED_ONE_BYTE_STRING(node_isolate, "oncomplete");
 }
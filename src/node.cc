@@ -27,6 +27,7 @@
 #include "node_javascript.h"
 #include "node_script.h"
 #include "node_version.h"
+#include "node_zlib.h"
 
 #if defined HAVE_PERFCTR
 #include "node_counters.h"
@@ -34,6 +35,7 @@
 
 #if HAVE_OPENSSL
 #include "node_crypto.h"
+#include "node_crypto_bio.h"
 #endif
 
 #if defined HAVE_DTRACE || defined HAVE_ETW || defined HAVE_SYSTEMTAP
@@ -130,9 +132,9 @@ Cached<String> domain_symbol;
 Persistent<Object> process_p;
 
 static Persistent<Function> process_tickCallback;
+static Persistent<Function> domain_callback;
 static Persistent<Object> binding_cache;
 static Persistent<Array> module_load_list;
-static Persistent<Array> p_domain_box;
 
 static Cached<String> exports_symbol;
 
@@ -144,13 +146,13 @@ static Cached<String> code_symbol;
 static Cached<String> rss_symbol;
 static Cached<String> heap_total_symbol;
 static Cached<String> heap_used_symbol;
+static Cached<String> zlib_symbol;
+#if HAVE_OPENSSL
+static Cached<String> tls_buffers_symbol;
+#endif
 
 static Cached<String> fatal_exception_symbol;
 
-static Cached<String> enter_symbol;
-static Cached<String> exit_symbol;
-static Cached<String> disposed_symbol;
-
 // Essential for node_wrap.h
 Persistent<FunctionTemplate> pipeConstructorTmpl;
 Persistent<FunctionTemplate> tcpConstructorTmpl;
@@ -176,17 +178,19 @@ static uv_idle_t idle_immediate_dummy;
 static bool need_immediate_cb;
 static Cached<String> immediate_callback_sym;
 
-// for quick ref to tickCallback values
+// for quick ref to tickCallback values, see startup.processNextTick in
+// src/node.js. length is the number of queued callbacks, MakeCallback() only
+// calls into _tickCallback when there are any.
 static struct {
   uint32_t length;
-  uint32_t index;
   uint32_t in_tick;
   uint32_t last_threw;
 } tick_infobox;
 
-// easily communicate domain depth
+// easily communicate domain depth, and whether a domain was ever created
 static struct {
   uint32_t count;
+  uint32_t created;
 } domain_flag;
 
 #ifdef OPENSSL_NPN_NEGOTIATED
@@ -923,19 +927,19 @@ void SetupDomainUse(const FunctionCallbackInfo<Value>& args) {
   Local<Function> tdc = tdc_v.As<Function>();
   process->Set(FIXED_ONE_BYTE_STRING(node_isolate, "_tickCallback"), tdc);
   process_tickCallback.Reset(node_isolate, tdc);
-  if (!args[0]->IsArray()) {
-    fprintf(stderr, "_setupDomainUse first argument must be an array\n");
+  if (!args[0]->IsObject()) {
+    fprintf(stderr, "_setupDomainUse first argument must be an object\n");
     abort();
   }
-  p_domain_box.Reset(node_isolate, args[0].As<Array>());
-  if (!args[1]->IsObject()) {
-    fprintf(stderr, "_setupDomainUse second argument must be an object\n");
+  Local<Object> flag = args[0].As<Object>();
+  if (!args[1]->IsFunction()) {
+    fprintf(stderr, "_setupDomainUse second argument must be a function\n");
     abort();
   }
-  Local<Object> flag = args[1].As<Object>();
+  domain_callback.Reset(node_isolate, args[1].As<Function>());
   flag->SetIndexedPropertiesToExternalArrayData(&domain_flag,
                                                 kExternalUnsignedIntArray,
-                                                1);
+                                                2);
 }
 
 
@@ -946,10 +950,11 @@ bool InDomain() {
 
 Handle<Value> GetDomain() {
   // no domain can exist if no domain module has been loaded
-  if (!InDomain() || p_domain_box.IsEmpty())
+  if (!InDomain())
     return Null(node_isolate);
 
-  return PersistentToLocal(node_isolate, p_domain_box)->Get(0);
+  Local<Object> process = PersistentToLocal(node_isolate, process_p);
+  return process->Get(domain_symbol);
 }
 
 
@@ -959,55 +964,39 @@ MakeDomainCallback(const Handle<Object> object,
                    int argc,
                    Handle<Value> argv[]) {
   // TODO(trevnorris) Hook for long stack traces to be made here.
-
-  // lazy load domain specific symbols
-  if (enter_symbol.IsEmpty()) {
-    enter_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "enter");
-    exit_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "exit");
-    disposed_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "_disposed");
-  }
-
-  Local<Value> domain_v = object->Get(domain_symbol);
-  Local<Object> domain;
-  Local<Function> enter;
-  Local<Function> exit;
+  UpdateLoopTime();
 
   TryCatch try_catch;
   try_catch.SetVerbose(true);
 
-  bool has_domain = domain_v->IsObject();
-  if (has_domain) {
-    domain = domain_v->ToObject();
-    assert(!domain.IsEmpty());
-    if (domain->Get(disposed_symbol)->IsTrue()) {
-      // domain has been disposed of.
-      return Undefined(node_isolate);
-    }
-    enter = Local<Function>::Cast(domain->Get(enter_symbol));
-    assert(!enter.IsEmpty());
-    enter->Call(domain, 0, NULL);
-
-    if (try_catch.HasCaught()) {
-      return Undefined(node_isolate);
-    }
+  // Nothing belongs to a domain before the first one is created. Processes
+  // that merely load the domain module skip the lookup. After that, only
+  // objects with a domain of their own are looked at: an own property check
+  // doesn't walk the prototype chain like Get() does when it misses.
+  Local<Value> domain;
+  if (domain_flag.created && object->HasRealNamedProperty(domain_symbol))
+    domain = object->Get(domain_symbol);
+
+  Local<Value> ret;
+  if (!domain.IsEmpty() && domain->IsObject()) {
+    // Entering the domain, making the call and exiting again is done by
+    // the function domain.js registered, one call into JS instead of three.
+    Local<Array> args = Array::New(argc);
+    for (int i = 0; i < argc; i++)
+      args->Set(i, argv[i]);
+    Local<Value> call_argv[] = { domain, object, callback, args };
+    Local<Object> process = PersistentToLocal(node_isolate, process_p);
+    Local<Function> trampoline =
+        PersistentToLocal(node_isolate, domain_callback);
+    ret = trampoline->Call(process, ARRAY_SIZE(call_argv), call_argv);
+  } else {
+    ret = callback->Call(object, argc, argv);
   }
 
-  Local<Value> ret = callback->Call(object, argc, argv);
-
   if (try_catch.HasCaught()) {
     return Undefined(node_isolate);
   }
 
-  if (has_domain) {
-    exit = Local<Function>::Cast(domain->Get(exit_symbol));
-    assert(!exit.IsEmpty());
-    exit->Call(domain, 0, NULL);
-
-    if (try_catch.HasCaught()) {
-      return Undefined(node_isolate);
-    }
-  }
-
   if (tick_infobox.last_threw == 1) {
     tick_infobox.last_threw = 0;
     return ret;
@@ -1017,10 +1006,8 @@ MakeDomainCallback(const Handle<Object> object,
     return ret;
   }
 
-  if (tick_infobox.length == 0) {
-    tick_infobox.index = 0;
+  if (tick_infobox.length == 0)
     return ret;
-  }
 
   // process nextTicks after call
   Local<Object> process = PersistentToLocal(node_isolate, process_p);
@@ -1046,6 +1033,8 @@ MakeCallback(const Handle<Object> object,
   if (using_domains)
     return MakeDomainCallback(object, callback, argc, argv);
 
+  UpdateLoopTime();
+
   // lazy load no domain next tick callbacks
   if (process_tickCallback.IsEmpty()) {
     Local<Value> cb_v =
@@ -1070,10 +1059,8 @@ MakeCallback(const Handle<Object> object,
     return ret;
   }
 
-  if (tick_infobox.length == 0) {
-    tick_infobox.index = 0;
+  if (tick_infobox.length == 0)
     return ret;
-  }
 
   // process nextTicks after call
   Local<Function> fn = PersistentToLocal(node_isolate, process_tickCallback);
@@ -1758,6 +1745,10 @@ void MemoryUsage(const FunctionCallbackInfo<Value>& args) {
     rss_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "rss");
     heap_total_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "heapTotal");
     heap_used_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "heapUsed");
+    zlib_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "zlib");
+#if HAVE_OPENSSL
+    tls_buffers_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "tlsBuffers");
+#endif
   }
 
   info->Set(rss_symbol, Number::New(rss));
@@ -1772,6 +1763,14 @@ void MemoryUsage(const FunctionCallbackInfo<Value>& args) {
             Integer::NewFromUnsigned(v8_heap_stats.used_heap_size(),
                                      node_isolate));
 
+  // Memory held by zlib streams
+  info->Set(zlib_symbol, Number::New(zlib::AllocatedBytes()));
+
+#if HAVE_OPENSSL
+  // Memory held by TLS buffers
+  info->Set(tls_buffers_symbol, Number::New(NodeBIO::AllocatedBytes()));
+#endif
+
   args.GetReturnValue().Set(info);
 }
 
@@ -2504,7 +2503,7 @@ Handle<Object> SetupProcessObject(int argc, char *argv[]) {
   Local<Object> info_box = Object::New();
   info_box->SetIndexedPropertiesToExternalArrayData(&tick_infobox,
                                                     kExternalUnsignedIntArray,
-                                                    4);
+                                                    3);
   process->Set(FIXED_ONE_BYTE_STRING(node_isolate, "_tickInfoBox"), info_box);
 
   // pre-set _events object for faster emit checks
@@ -2622,6 +2621,34 @@ static void ParseDebugOpt(const char* arg) {
   exit(12);
 }
 
+static void ParseThreadpoolOpt(const char* arg) {
+  static const struct {
+    const char* name;
+    uv_work_class kind;
+  } options[] = {
+    { "--threadpool-io=", UV_WORK_IO },
+    { "--threadpool-cpu=", UV_WORK_CPU },
+    { "--threadpool-dns=", UV_WORK_DNS }
+  };
+
+  for (size_t i = 0; i < ARRAY_SIZE(options); i++) {
+    if (strstr(arg, options[i].name) != arg)
+      continue;
+    int size = atoi(1 + strchr(arg, '='));
+    if (size < 0)
+      break;
+    // The thread pool isn't running yet. Fails with UV_ENOSYS on Windows,
+    // where the system thread pool is used, that's fine.
+    if (uv_threadpool_set_size(options[i].kind, size) == UV_EINVAL)
+      break;
+    return;
+  }
+
+  fprintf(stderr, "Bad threadpool option.\n");
+  PrintHelp();
+  exit(9);
+}
+
 static void PrintHelp() {
   printf("Usage: node [options] [ -e script | script.js ] [arguments] \n"
          "       node debug script.js [arguments] \n"
@@ -2636,6 +2663,12 @@ static void PrintHelp() {
          "  --trace-deprecation  show stack traces on deprecations\n"
          "  --v8-options         print v8 command line options\n"
          "  --max-stack-size=val set max v8 stack size (bytes)\n"
+         "  --threadpool-io=n    number of threads for file system work,\n"
+         "                       they run other work too (default: 4)\n"
+         "  --threadpool-cpu=n   number of extra threads for CPU-bound work\n"
+         "                       (crypto, zlib and addons, default: 0)\n"
+         "  --threadpool-dns=n   number of extra threads for dns.lookup()\n"
+         "                       (default: 0)\n"
          "\n"
          "Environment variables:\n"
 #ifdef _WIN32
@@ -2647,6 +2680,9 @@ static void PrintHelp() {
          "NODE_MODULE_CONTEXTS   Set to 1 to load modules in their own\n"
          "                       global contexts.\n"
          "NODE_DISABLE_COLORS    Set to 1 to disable colors in the REPL\n"
+         "UV_THREADPOOL_SIZE     Same as --threadpool-io.\n"
+         "UV_THREADPOOL_CPU_SIZE Same as --threadpool-cpu.\n"
+         "UV_THREADPOOL_DNS_SIZE Same as --threadpool-dns.\n"
          "\n"
          "Documentation can be found at http://nodejs.org/\n");
 }
@@ -2670,6 +2706,9 @@ static void ParseArgs(int argc, char **argv) {
       p = 1 + strchr(arg, '=');
       max_stack_size = atoi(p);
       argv[i] = const_cast<char*>("");
+    } else if (strstr(arg, "--threadpool-") == arg) {
+      ParseThreadpoolOpt(arg);
+      argv[i] = const_cast<char*>("");
     } else if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
       PrintHelp();
       exit(0);
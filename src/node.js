@@ -315,36 +315,36 @@
   };
 
   startup.processNextTick = function() {
-    var nextTickQueue = [];
+    // queue[head] is the next tick to run. A drained queue starts over at the
+    // front. One that never drains, because every tick queues another, is cut
+    // down by nextTick() once most of it has run.
+    var queue = [];
+    var head = 0;
 
     // this infoBox thing is used so that the C++ code in src/node.cc
     // can have easy access to our nextTick state, and avoid unnecessary
     // calls into process._tickCallback.
-    // order is [length, index, inTick, lastThrew]
+    // order is [length, inTick, lastThrew]
     // Never write code like this without very good reason!
     var infoBox = process._tickInfoBox;
     var length = 0;
-    var index = 1;
-    var inTick = 2;
-    var lastThrew = 3;
+    var inTick = 1;
+    var lastThrew = 2;
 
     process.nextTick = nextTick;
     // needs to be accessible from cc land
     process._tickCallback = _tickCallback;
     process._tickDomainCallback = _tickDomainCallback;
 
+    // While the queue runs, MakeCallback() leaves it alone and infoBox[length]
+    // is only kept up to date here, at the end.
     function tickDone() {
-      if (infoBox[length] !== 0) {
-        if (infoBox[length] <= infoBox[index]) {
-          nextTickQueue = [];
-          infoBox[length] = 0;
-        } else {
-          nextTickQueue.splice(0, infoBox[index]);
-          infoBox[length] = nextTickQueue.length;
-        }
+      if (head === queue.length) {
+        queue = [];
+        head = 0;
       }
+      infoBox[length] = queue.length - head;
       infoBox[inTick] = 0;
-      infoBox[index] = 0;
     }
 
     // run callbacks that have no domain
@@ -354,8 +354,8 @@
 
       infoBox[inTick] = 1;
 
-      while (infoBox[index] < infoBox[length]) {
-        callback = nextTickQueue[infoBox[index]++].callback;
+      while (head < queue.length) {
+        callback = queue[head++].callback;
         threw = true;
         try {
           callback();
@@ -373,8 +373,8 @@
 
       infoBox[inTick] = 1;
 
-      while (infoBox[index] < infoBox[length]) {
-        tock = nextTickQueue[infoBox[index]++];
+      while (head < queue.length) {
+        tock = queue[head++];
         callback = tock.callback;
         domain = tock.domain;
         if (domain) {
@@ -400,7 +400,11 @@
       if (process._exiting)
         return;
 
-      nextTickQueue.push({
+      if (head >= 1024 && (queue.length - head) * 8 <= head) {
+        queue = queue.slice(head);
+        head = 0;
+      }
+      queue.push({
         callback: callback,
         domain: process.domain || null
       });
@@ -685,6 +689,9 @@
       // Make sure it's not accidentally inherited by child processes.
       delete process.env.NODE_CHANNEL_FD;
 
+      var serialization = process.env.NODE_CHANNEL_SERIALIZATION;
+      delete process.env.NODE_CHANNEL_SERIALIZATION;
+
       var cp = NativeModule.require('child_process');
 
       // Load tcp_wrap to avoid situation where we might immediately receive
@@ -692,7 +699,7 @@
       // FIXME is this really necessary?
       process.binding('tcp_wrap');
 
-      cp._forkChild(fd);
+      cp._forkChild(fd, serialization);
       assert(process.send);
     }
   }
@@ -25,6 +25,7 @@
 #include "node_crypto_bio.h"
 #include "node_crypto_groups.h"
 #include "node_root_certs.h"
+#include "node_threadpool.h"
 #include "tls_wrap.h"  // TLSCallbacks
 
 #include "string_bytes.h"
@@ -2526,6 +2527,358 @@ void Hash::HashDigest(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Reads a public key in PEM format. Accepts PKCS#8 and RSA public keys and
+// falls back to X.509 certificates. Returns NULL on error, the reason is left
+// on the OpenSSL error stack. Doesn't touch V8, safe to call from the thread
+// pool.
+static EVP_PKEY* LoadPublicKey(const char* key_pem, int key_pem_len) {
+  EVP_PKEY* pkey = NULL;
+  X509* x509 = NULL;
+
+  BIO* bp = BIO_new(BIO_s_mem());
+  if (bp == NULL)
+    return NULL;
+
+  if (!BIO_write(bp, key_pem, key_pem_len))
+    goto exit;
+
+  // Check if this is a PKCS#8 or RSA public key before trying as X.509.
+  if (strncmp(key_pem, PUBLIC_KEY_PFX, PUBLIC_KEY_PFX_LEN) == 0) {
+    pkey = PEM_read_bio_PUBKEY(bp, NULL, NULL, NULL);
+  } else if (strncmp(key_pem, PUBRSA_KEY_PFX, PUBRSA_KEY_PFX_LEN) == 0) {
+    RSA* rsa = PEM_read_bio_RSAPublicKey(bp, NULL, NULL, NULL);
+    if (rsa) {
+      pkey = EVP_PKEY_new();
+      if (pkey) EVP_PKEY_set1_RSA(pkey, rsa);
+      RSA_free(rsa);
+    }
+  } else {
+    // X.509 fallback
+    x509 = PEM_read_bio_X509(bp, NULL, NULL, NULL);
+    if (x509 != NULL)
+      pkey = X509_get_pubkey(x509);
+  }
+
+ exit:
+  if (x509 != NULL)
+    X509_free(x509);
+  BIO_free_all(bp);
+  return pkey;
+}
+
+
+// Computes the shared secret into `data`, which must be DH_size(dh) bytes.
+// Returns an error message or NULL on success.
+static const char* ComputeDHSecret(DH* dh,
+                                   BIGNUM* key,
+                                   char* data,
+                                   int data_size) {
+  int size = DH_compute_key(reinterpret_cast<unsigned char*>(data), key, dh);
+
+  if (size == -1) {
+    int checkResult;
+    if (!DH_check_pub_key(dh, key, &checkResult))
+      return "Invalid key";
+    if (checkResult & DH_CHECK_PUBKEY_TOO_SMALL)
+      return "Supplied key is too small";
+    if (checkResult & DH_CHECK_PUBKEY_TOO_LARGE)
+      return "Supplied key is too large";
+    return "Invalid key";
+  }
+
+  assert(size >= 0);
+
+  // DH_size returns number of bytes in a prime number
+  // DH_compute_key returns number of bytes in a remainder of exponent, which
+  // may have less bytes than a prime number. Therefore add 0-padding to the
+  // allocated buffer.
+  if (size != data_size) {
+    assert(data_size > size);
+    memmove(data + data_size - size, data, size);
+    memset(data, 0, data_size - size);
+  }
+
+  return NULL;
+}
+
+
+// Base class for sign, verify and Diffie-Hellman operations that run on the
+// thread pool. DoWork() runs on a worker thread and must not touch V8 or the
+// object that started the job, subclasses carry copies of everything they
+// need. The result is passed to `ondone` as (err, result).
+class CryptoJob {
+ public:
+  explicit CryptoJob(const char* name)
+      : name_(name), error_(0), message_(NULL) {
+  }
+
+  virtual ~CryptoJob() {}
+
+  void Queue(Handle<Object> owner, Handle<Value> cb) {
+    HandleScope scope(node_isolate);
+    Local<Object> obj = Object::New();
+    obj->Set(FIXED_ONE_BYTE_STRING(node_isolate, "ondone"), cb);
+    // Keeps the owner alive until the job is done.
+    obj->Set(FIXED_ONE_BYTE_STRING(node_isolate, "owner"), owner);
+    obj_.Reset(node_isolate, obj);
+    work_req_.data = this;
+    uv_queue_work(uv_default_loop(), &work_req_, Work, After);
+  }
+
+ protected:
+  virtual void DoWork() = 0;
+  virtual Local<Value> Result(Local<Object> obj) = 0;
+
+  // Records why the job failed: either the first error on the OpenSSL error
+  // stack or a fixed message.
+  void SetError(const char* message) {
+    error_ = ERR_get_error();
+    message_ = message;
+    ERR_clear_error();
+  }
+
+ private:
+  static void Work(uv_work_t* work_req) {
+    CryptoJob* job = static_cast<CryptoJob*>(work_req->data);
+    job->DoWork();
+  }
+
+  static void After(uv_work_t* work_req, int status) {
+    assert(status == 0);
+    CryptoJob* job = static_cast<CryptoJob*>(work_req->data);
+    threadpool::RecordWork("crypto",
+                           job->name_,
+                           reinterpret_cast<uv_req_t*>(work_req));
+    HandleScope scope(node_isolate);
+    Local<Object> obj = Local<Object>::New(node_isolate, job->obj_);
+    job->obj_.Dispose();
+
+    Local<Value> argv[2];
+    if (job->error_ != 0) {
+      char errmsg[128];
+      ERR_error_string_n(job->error_, errmsg, sizeof(errmsg));
+      argv[0] = Exception::Error(OneByteString(node_isolate, errmsg));
+      argv[1] = Undefined(node_isolate);
+    } else if (job->message_ != NULL) {
+      argv[0] = Exception::Error(OneByteString(node_isolate, job->message_));
+      argv[1] = Undefined(node_isolate);
+    } else {
+      argv[0] = Null(node_isolate);
+      argv[1] = job->Result(obj);
+    }
+
+    delete job;
+    MakeCallback(obj, "ondone", ARRAY_SIZE(argv), argv);
+  }
+
+  uv_work_t work_req_;
+  Persistent<Object> obj_;
+  const char* name_;
+  unsigned long error_;
+  const char* message_;
+};
+
+
+// Copies `len` bytes into a new buffer. Free it with FreeKeyMaterial(),
+// which wipes it first.
+static char* CopyKeyMaterial(const char* data, size_t len) {
+  char* copy = new char[len];
+  memcpy(copy, data, len);
+  return copy;
+}
+
+
+static void FreeKeyMaterial(char* data, size_t len) {
+  OPENSSL_cleanse(data, len);
+  delete[] data;
+}
+
+
+class SignJob : public CryptoJob {
+ public:
+  SignJob(Sign* sign, const char* key_pem, size_t key_pem_len)
+      : CryptoJob("sign"),
+        key_pem_(CopyKeyMaterial(key_pem, key_pem_len)),
+        key_pem_len_(key_pem_len),
+        sig_(NULL),
+        sig_len_(0) {
+    initialised_ = sign->TransferContext(&mdctx_);
+  }
+
+  virtual ~SignJob() {
+    if (initialised_) EVP_MD_CTX_cleanup(&mdctx_);
+    FreeKeyMaterial(key_pem_, key_pem_len_);
+    delete[] sig_;
+  }
+
+ protected:
+  virtual void DoWork() {
+    if (!initialised_) return SetError("Sign not initialised");
+
+    BIO* bp = BIO_new(BIO_s_mem());
+    if (bp == NULL || !BIO_write(bp, key_pem_, key_pem_len_)) {
+      BIO_free_all(bp);
+      return SetError("Sign failed");
+    }
+
+    EVP_PKEY* pkey = PEM_read_bio_PrivateKey(bp, NULL, NULL, NULL);
+    BIO_free_all(bp);
+    if (pkey == NULL) return SetError("Sign failed");
+
+    sig_ = new unsigned char[EVP_PKEY_size(pkey)];
+    if (!EVP_SignFinal(&mdctx_, sig_, &sig_len_, pkey))
+      SetError("Sign failed");
+    EVP_PKEY_free(pkey);
+  }
+
+  virtual Local<Value> Result(Local<Object> obj) {
+    return Encode(sig_, sig_len_, BUFFER);
+  }
+
+ private:
+  EVP_MD_CTX mdctx_;
+  bool initialised_;
+  char* key_pem_;
+  size_t key_pem_len_;
+  unsigned char* sig_;
+  unsigned int sig_len_;
+};
+
+
+class VerifyJob : public CryptoJob {
+ public:
+  VerifyJob(Verify* verify,
+            const char* key_pem,
+            size_t key_pem_len,
+            const char* sig,
+            size_t sig_len)
+      : CryptoJob("verify"),
+        key_pem_(CopyKeyMaterial(key_pem, key_pem_len)),
+        key_pem_len_(key_pem_len),
+        sig_(CopyKeyMaterial(sig, sig_len)),
+        sig_len_(sig_len),
+        verified_(false) {
+    initialised_ = verify->TransferContext(&mdctx_);
+  }
+
+  virtual ~VerifyJob() {
+    if (initialised_) EVP_MD_CTX_cleanup(&mdctx_);
+    FreeKeyMaterial(key_pem_, key_pem_len_);
+    FreeKeyMaterial(sig_, sig_len_);
+  }
+
+ protected:
+  virtual void DoWork() {
+    if (!initialised_) return SetError("Verify not initalised");
+
+    EVP_PKEY* pkey = LoadPublicKey(key_pem_, key_pem_len_);
+    if (pkey == NULL) return SetError("Verify failed");
+
+    int r = EVP_VerifyFinal(&mdctx_,
+                            reinterpret_cast<const unsigned char*>(sig_),
+                            sig_len_,
+                            pkey);
+    EVP_PKEY_free(pkey);
+    verified_ = r == 1;
+    // A bad signature is an answer, not an error.
+    ERR_clear_error();
+  }
+
+  virtual Local<Value> Result(Local<Object> obj) {
+    return Boolean::New(verified_);
+  }
+
+ private:
+  EVP_MD_CTX mdctx_;
+  bool initialised_;
+  char* key_pem_;
+  size_t key_pem_len_;
+  char* sig_;
+  size_t sig_len_;
+  bool verified_;
+};
+
+
+class DHKeysJob : public CryptoJob {
+ public:
+  explicit DHKeysJob(DiffieHellman* diffieHellman)
+      : CryptoJob("dhGenerateKeys"),
+        dh_(diffieHellman->CopyKeys()) {
+  }
+
+  virtual ~DHKeysJob() {
+    if (dh_ != NULL) DH_free(dh_);
+  }
+
+ protected:
+  virtual void DoWork() {
+    if (dh_ == NULL || !DH_generate_key(dh_))
+      SetError("Key generation failed");
+  }
+
+  virtual Local<Value> Result(Local<Object> obj) {
+    Local<Object> owner =
+        obj->Get(FIXED_ONE_BYTE_STRING(node_isolate, "owner")).As<Object>();
+    DiffieHellman* diffieHellman = ObjectWrap::Unwrap<DiffieHellman>(owner);
+
+    int size = BN_num_bytes(dh_->pub_key);
+    char* data = new char[size];
+    BN_bn2bin(dh_->pub_key, reinterpret_cast<unsigned char*>(data));
+    Local<Value> rc = Encode(data, size, BUFFER);
+    delete[] data;
+
+    // The owner takes over the keys.
+    diffieHellman->SetKeys(dh_->pub_key, dh_->priv_key);
+    dh_->pub_key = NULL;
+    dh_->priv_key = NULL;
+    return rc;
+  }
+
+ private:
+  DH* dh_;
+};
+
+
+class DHSecretJob : public CryptoJob {
+ public:
+  DHSecretJob(DiffieHellman* diffieHellman, BIGNUM* key)
+      : CryptoJob("dhComputeSecret"),
+        dh_(diffieHellman->CopyKeys()),
+        key_(key),
+        data_(NULL),
+        data_size_(0) {
+  }
+
+  virtual ~DHSecretJob() {
+    if (dh_ != NULL) DH_free(dh_);
+    BN_free(key_);
+    if (data_ != NULL) FreeKeyMaterial(data_, data_size_);
+  }
+
+ protected:
+  virtual void DoWork() {
+    if (dh_ == NULL) return SetError("Invalid key");
+    data_size_ = DH_size(dh_);
+    data_ = new char[data_size_];
+    const char* error = ComputeDHSecret(dh_, key_, data_, data_size_);
+    if (error != NULL) {
+      ERR_clear_error();
+      SetError(error);
+    }
+  }
+
+  virtual Local<Value> Result(Local<Object> obj) {
+    return Encode(data_, data_size_, BUFFER);
+  }
+
+ private:
+  DH* dh_;
+  BIGNUM* key_;
+  char* data_;
+  int data_size_;
+};
+
+
 void Sign::Initialize(v8::Handle<v8::Object> target) {
   HandleScope scope(node_isolate);
 
@@ -2637,6 +2990,16 @@ bool Sign::SignFinal(unsigned char** md_value,
 }
 
 
+bool Sign::TransferContext(EVP_MD_CTX* ctx) {
+  if (!initialised_) return false;
+  EVP_MD_CTX_init(ctx);
+  EVP_MD_CTX_copy_ex(ctx, &mdctx_);
+  EVP_MD_CTX_cleanup(&mdctx_);
+  initialised_ = false;
+  return true;
+}
+
+
 void Sign::SignFinal(const FunctionCallbackInfo<Value>& args) {
   HandleScope scope(node_isolate);
 
@@ -2645,15 +3008,21 @@ void Sign::SignFinal(const FunctionCallbackInfo<Value>& args) {
   unsigned char* md_value;
   unsigned int md_len;
 
+  ASSERT_IS_BUFFER(args[0]);
+  ssize_t len = Buffer::Length(args[0]);
+  char* buf = Buffer::Data(args[0]);
+
+  if (args[1]->IsFunction()) {
+    SignJob* job = new SignJob(sign, buf, len);
+    job->Queue(args.This(), args[1]);
+    return;
+  }
+
   enum encoding encoding = BUFFER;
   if (args.Length() >= 2) {
     encoding = ParseEncoding(args[1]->ToString(), BUFFER);
   }
 
-  ASSERT_IS_BUFFER(args[0]);
-  ssize_t len = Buffer::Length(args[0]);
-  char* buf = Buffer::Data(args[0]);
-
   md_len = 8192;  // Maximum key size is 8192 bits
   md_value = new unsigned char[md_len];
 
@@ -2771,64 +3140,20 @@ bool Verify::VerifyFinal(const char* key_pem,
     return false;
   }
 
-  EVP_PKEY* pkey = NULL;
-  BIO* bp = NULL;
-  X509* x509 = NULL;
-  bool fatal = true;
   int r = 0;
-
-  bp = BIO_new(BIO_s_mem());
-  if (bp == NULL)
-    goto exit;
-
-  if (!BIO_write(bp, key_pem, key_pem_len))
-    goto exit;
-
-  // Check if this is a PKCS#8 or RSA public key before trying as X.509.
-  // Split this out into a separate function once we have more than one
-  // consumer of public keys.
-  if (strncmp(key_pem, PUBLIC_KEY_PFX, PUBLIC_KEY_PFX_LEN) == 0) {
-    pkey = PEM_read_bio_PUBKEY(bp, NULL, NULL, NULL);
-    if (pkey == NULL)
-      goto exit;
-  } else if (strncmp(key_pem, PUBRSA_KEY_PFX, PUBRSA_KEY_PFX_LEN) == 0) {
-    RSA* rsa = PEM_read_bio_RSAPublicKey(bp, NULL, NULL, NULL);
-    if (rsa) {
-      pkey = EVP_PKEY_new();
-      if (pkey) EVP_PKEY_set1_RSA(pkey, rsa);
-      RSA_free(rsa);
-    }
-    if (pkey == NULL)
-      goto exit;
-  } else {
-    // X.509 fallback
-    x509 = PEM_read_bio_X509(bp, NULL, NULL, NULL);
-    if (x509 == NULL)
-      goto exit;
-
-    pkey = X509_get_pubkey(x509);
-    if (pkey == NULL)
-      goto exit;
-  }
-
-  fatal = false;
-  r = EVP_VerifyFinal(&mdctx_,
-                      reinterpret_cast<const unsigned char*>(sig),
-                      siglen,
-                      pkey);
-
- exit:
-  if (pkey != NULL)
+  EVP_PKEY* pkey = LoadPublicKey(key_pem, key_pem_len);
+  if (pkey != NULL) {
+    r = EVP_VerifyFinal(&mdctx_,
+                        reinterpret_cast<const unsigned char*>(sig),
+                        siglen,
+                        pkey);
     EVP_PKEY_free(pkey);
-  if (bp != NULL)
-    BIO_free_all(bp);
-  if (x509 != NULL)
-    X509_free(x509);
+  }
 
   EVP_MD_CTX_cleanup(&mdctx_);
   initialised_ = false;
 
-  if (fatal) {
+  if (pkey == NULL) {
     unsigned long err = ERR_get_error();
     ThrowCryptoError(err);
     return false;
@@ -2838,6 +3163,16 @@ bool Verify::VerifyFinal(const char* key_pem,
 }
 
 
+bool Verify::TransferContext(EVP_MD_CTX* ctx) {
+  if (!initialised_) return false;
+  EVP_MD_CTX_init(ctx);
+  EVP_MD_CTX_copy_ex(ctx, &mdctx_);
+  EVP_MD_CTX_cleanup(&mdctx_);
+  initialised_ = false;
+  return true;
+}
+
+
 void Verify::VerifyFinal(const FunctionCallbackInfo<Value>& args) {
   HandleScope scope(node_isolate);
 
@@ -2850,8 +3185,10 @@ void Verify::VerifyFinal(const FunctionCallbackInfo<Value>& args) {
   ASSERT_IS_STRING_OR_BUFFER(args[1]);
   // BINARY works for both buffers and binary strings.
   enum encoding encoding = BINARY;
-  if (args.Length() >= 3) {
+  Local<Value> cb = args[2];
+  if (args.Length() >= 3 && !args[2]->IsFunction()) {
     encoding = ParseEncoding(args[2]->ToString(), BINARY);
+    cb = args[3];
   }
 
   ssize_t hlen = StringBytes::Size(args[1], encoding);
@@ -2866,6 +3203,15 @@ void Verify::VerifyFinal(const FunctionCallbackInfo<Value>& args) {
     hbuf = Buffer::Data(args[1]);
   }
 
+  if (cb->IsFunction()) {
+    VerifyJob* job = new VerifyJob(verify, kbuf, klen, hbuf, hlen);
+    job->Queue(args.This(), cb);
+    if (args[1]->IsString()) {
+      delete[] hbuf;
+    }
+    return;
+  }
+
   bool rc = verify->VerifyFinal(kbuf, klen, hbuf, hlen);
   if (args[1]->IsString()) {
     delete[] hbuf;
@@ -3001,6 +3347,12 @@ void DiffieHellman::GenerateKeys(const FunctionCallbackInfo<Value>& args) {
     return ThrowError("Not initialized");
   }
 
+  if (args[0]->IsFunction()) {
+    DHKeysJob* job = new DHKeysJob(diffieHellman);
+    job->Queue(args.This(), args[0]);
+    return;
+  }
+
   if (!DH_generate_key(diffieHellman->dh)) {
     return ThrowError("Key generation failed");
   }
@@ -3125,47 +3477,21 @@ void DiffieHellman::ComputeSecret(const FunctionCallbackInfo<Value>& args) {
         0);
   }
 
+  if (args[1]->IsFunction()) {
+    DHSecretJob* job = new DHSecretJob(diffieHellman, key);
+    job->Queue(args.This(), args[1]);
+    return;
+  }
+
   int dataSize = DH_size(diffieHellman->dh);
   char* data = new char[dataSize];
 
-  int size = DH_compute_key(reinterpret_cast<unsigned char*>(data),
-                            key,
-                            diffieHellman->dh);
-
-  if (size == -1) {
-    int checkResult;
-    int checked;
-
-    checked = DH_check_pub_key(diffieHellman->dh, key, &checkResult);
-    BN_free(key);
-    delete[] data;
-
-    if (!checked) {
-      return ThrowError("Invalid key");
-    } else if (checkResult) {
-      if (checkResult & DH_CHECK_PUBKEY_TOO_SMALL) {
-        return ThrowError("Supplied key is too small");
-      } else if (checkResult & DH_CHECK_PUBKEY_TOO_LARGE) {
-        return ThrowError("Supplied key is too large");
-      } else {
-        return ThrowError("Invalid key");
-      }
-    } else {
-      return ThrowError("Invalid key");
-    }
-  }
-
+  const char* error = ComputeDHSecret(diffieHellman->dh, key, data, dataSize);
   BN_free(key);
-  assert(size >= 0);
 
-  // DH_size returns number of bytes in a prime number
-  // DH_compute_key returns number of bytes in a remainder of exponent, which
-  // may have less bytes than a prime number. Therefore add 0-padding to the
-  // allocated buffer.
-  if (size != dataSize) {
-    assert(dataSize > size);
-    memmove(data + dataSize - size, data, size);
-    memset(data, 0, dataSize - size);
+  if (error != NULL) {
+    delete[] data;
+    return ThrowError(error);
   }
 
   args.GetReturnValue().Set(Encode(data, dataSize, BUFFER));
@@ -3216,6 +3542,23 @@ void DiffieHellman::SetPrivateKey(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+DH* DiffieHellman::CopyKeys() const {
+  DH* copy = DHparams_dup(dh);
+  if (copy == NULL) return NULL;
+  if (dh->pub_key != NULL) copy->pub_key = BN_dup(dh->pub_key);
+  if (dh->priv_key != NULL) copy->priv_key = BN_dup(dh->priv_key);
+  return copy;
+}
+
+
+void DiffieHellman::SetKeys(BIGNUM* pub_key, BIGNUM* priv_key) {
+  if (dh->pub_key != NULL) BN_free(dh->pub_key);
+  if (dh->priv_key != NULL) BN_clear_free(dh->priv_key);
+  dh->pub_key = pub_key;
+  dh->priv_key = priv_key;
+}
+
+
 bool DiffieHellman::VerifyContext() {
   int codes;
   if (!DH_check(dh, &codes)) return false;
@@ -3282,6 +3625,9 @@ void EIO_PBKDF2After(pbkdf2_req* req, Local<Value> argv[2]) {
 void EIO_PBKDF2After(uv_work_t* work_req, int status) {
   assert(status == 0);
   pbkdf2_req* req = container_of(work_req, pbkdf2_req, work_req);
+  threadpool::RecordWork("crypto",
+                         "pbkdf2",
+                         reinterpret_cast<uv_req_t*>(work_req));
   HandleScope scope(node_isolate);
   // Create a new Local that's associated with the current HandleScope.
   // PersistentToLocal() returns a handle that gets zeroed when we call
@@ -3456,6 +3802,9 @@ void RandomBytesAfter(uv_work_t* work_req, int status) {
   RandomBytesRequest* req = container_of(work_req,
                                          RandomBytesRequest,
                                          work_req_);
+  threadpool::RecordWork("crypto",
+                         "randomBytes",
+                         reinterpret_cast<uv_req_t*>(work_req));
   HandleScope scope(node_isolate);
   Local<Value> argv[2];
   RandomBytesCheck(req, argv);
@@ -402,6 +402,9 @@ class Sign : public ObjectWrap {
                  unsigned int *md_len,
                  const char* key_pem,
                  int key_pem_len);
+  // Moves the digest state into `ctx` so it can be finished on the thread
+  // pool. Returns false if SignInit() wasn't called.
+  bool TransferContext(EVP_MD_CTX* ctx);
 
  protected:
   static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -433,6 +436,9 @@ class Verify : public ObjectWrap {
                    int key_pem_len,
                    const char* sig,
                    int siglen);
+  // Moves the digest state into `ctx` so it can be finished on the thread
+  // pool. Returns false if VerifyInit() wasn't called.
+  bool TransferContext(EVP_MD_CTX* ctx);
 
  protected:
   static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -462,6 +468,11 @@ class DiffieHellman : public ObjectWrap {
   bool Init(const char* p, int p_len);
   bool Init(const char* p, int p_len, const char* g, int g_len);
 
+  // The thread pool works on a private copy of the parameters and keys.
+  // SetKeys() stores keys that were generated on such a copy.
+  DH* CopyKeys() const;
+  void SetKeys(BIGNUM* pub_key, BIGNUM* priv_key);
+
  protected:
   static void DiffieHellmanGroup(
       const v8::FunctionCallbackInfo<v8::Value>& args);
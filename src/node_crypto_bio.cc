@@ -38,6 +38,11 @@ BIO_METHOD NodeBIO::method_ = {
   NULL
 };
 
+NodeBIO::Buffer* NodeBIO::pool_ = NULL;
+size_t NodeBIO::pool_size_ = 0;
+size_t NodeBIO::allocated_bytes_ = 0;
+size_t NodeBIO::instances_ = 0;
+
 
 int NodeBIO::New(BIO* bio) {
   bio->ptr = new NodeBIO();
@@ -83,11 +88,42 @@ int NodeBIO::Read(BIO* bio, char* out, int len) {
 
 
 char* NodeBIO::Peek(size_t* size) {
+  if (read_head_ == NULL) {
+    *size = 0;
+    return NULL;
+  }
+
   *size = read_head_->write_pos_ - read_head_->read_pos_;
   return read_head_->data_ + read_head_->read_pos_;
 }
 
 
+size_t NodeBIO::PeekMultiple(char** out, size_t* size, size_t* count) {
+  Buffer* pos = read_head_;
+  size_t max = *count;
+  size_t total = 0;
+  size_t i = 0;
+
+  while (pos != NULL && i < max) {
+    size_t avail = pos->write_pos_ - pos->read_pos_;
+    if (avail != 0) {
+      out[i] = pos->data_ + pos->read_pos_;
+      size[i] = avail;
+      total += avail;
+      i++;
+    }
+
+    // Don't get past write head
+    if (pos == write_head_)
+      break;
+    pos = pos->next_;
+  }
+
+  *count = i;
+  return total;
+}
+
+
 int NodeBIO::Write(BIO* bio, const char* data, int len) {
   BIO_clear_retry_flags(bio);
 
@@ -217,14 +253,20 @@ size_t NodeBIO::Read(char* out, size_t size) {
   assert(expected == bytes_read);
   length_ -= bytes_read;
 
-  // Free all empty buffers, but write_head's child
-  FreeEmpty();
+  // Free all buffers once drained, otherwise all empty buffers
+  // but write_head's child
+  if (length_ == 0)
+    ReleaseBuffers();
+  else
+    FreeEmpty();
 
   return bytes_read;
 }
 
 
 void NodeBIO::FreeEmpty() {
+  if (write_head_ == NULL)
+    return;
   Buffer* child = write_head_->next_;
   if (child == write_head_ || child == read_head_)
     return;
@@ -232,24 +274,74 @@ void NodeBIO::FreeEmpty() {
   if (cur == write_head_ || cur == read_head_)
     return;
 
-  Buffer* prev = child;
   while (cur != read_head_) {
-    // Skip embedded buffer, and continue deallocating again starting from it
-    if (cur == &head_) {
-      prev->next_ = cur;
-      prev = cur;
-      cur = head_.next_;
-      continue;
-    }
     assert(cur != write_head_);
     assert(cur->write_pos_ == cur->read_pos_);
 
     Buffer* next = cur->next_;
-    delete cur;
+    DeleteBuffer(cur);
     cur = next;
   }
-  assert(prev == child || prev == &head_);
-  prev->next_ = cur;
+  child->next_ = cur;
+}
+
+
+void NodeBIO::ReleaseBuffers() {
+  assert(length_ == 0);
+
+  // Space handed out by PeekWritable() may still be written to
+  if (write_reserved_ || read_head_ == NULL)
+    return;
+
+  Buffer* cur = read_head_;
+  do {
+    Buffer* next = cur->next_;
+    DeleteBuffer(cur);
+    cur = next;
+  } while (cur != read_head_);
+
+  read_head_ = NULL;
+  write_head_ = NULL;
+}
+
+
+NodeBIO::Buffer* NodeBIO::NewBuffer() {
+  Buffer* buffer = pool_;
+  if (buffer == NULL) {
+    allocated_bytes_ += sizeof(*buffer);
+    return new Buffer();
+  }
+
+  pool_ = buffer->next_;
+  pool_size_--;
+  buffer->read_pos_ = 0;
+  buffer->write_pos_ = 0;
+  buffer->next_ = NULL;
+  return buffer;
+}
+
+
+void NodeBIO::DeleteBuffer(Buffer* buffer) {
+  if (pool_size_ >= kMaxPoolSize) {
+    allocated_bytes_ -= sizeof(*buffer);
+    delete buffer;
+    return;
+  }
+
+  buffer->next_ = pool_;
+  pool_ = buffer;
+  pool_size_++;
+}
+
+
+void NodeBIO::FreePool() {
+  while (pool_ != NULL) {
+    Buffer* next = pool_->next_;
+    allocated_bytes_ -= sizeof(*pool_);
+    delete pool_;
+    pool_ = next;
+  }
+  pool_size_ = 0;
 }
 
 
@@ -296,6 +388,10 @@ size_t NodeBIO::IndexOf(char delim, size_t limit) {
 void NodeBIO::Write(const char* data, size_t size) {
   size_t offset = 0;
   size_t left = size;
+
+  if (left > 0)
+    TryAllocateForWrite();
+
   while (left > 0) {
     size_t to_write = left;
     assert(write_head_->write_pos_ <= kBufferLength);
@@ -328,6 +424,9 @@ void NodeBIO::Write(const char* data, size_t size) {
 
 
 char* NodeBIO::PeekWritable(size_t* size) {
+  TryAllocateForWrite();
+  write_reserved_ = true;
+
   size_t available = kBufferLength - write_head_->write_pos_;
   if (*size != 0 && available > *size)
     available = *size;
@@ -339,10 +438,16 @@ char* NodeBIO::PeekWritable(size_t* size) {
 
 
 void NodeBIO::Commit(size_t size) {
+  assert(write_head_ != NULL);
+  write_reserved_ = false;
   write_head_->write_pos_ += size;
   length_ += size;
   assert(write_head_->write_pos_ <= kBufferLength);
 
+  // Nothing was written, and nothing is buffered
+  if (length_ == 0)
+    return ReleaseBuffers();
+
   // Allocate new buffer if write head is full,
   // and there're no other place to go
   TryAllocateForWrite();
@@ -352,11 +457,20 @@ void NodeBIO::Commit(size_t size) {
 
 
 void NodeBIO::TryAllocateForWrite() {
+  // First write since the BIO was drained
+  if (write_head_ == NULL) {
+    Buffer* head = NewBuffer();
+    head->next_ = head;
+    read_head_ = head;
+    write_head_ = head;
+    return;
+  }
+
   // If write head is full, next buffer is either read head or not empty.
   if (write_head_->write_pos_ == kBufferLength &&
       (write_head_->next_ == read_head_ ||
        write_head_->next_->write_pos_ != 0)) {
-    Buffer* next = new Buffer();
+    Buffer* next = NewBuffer();
     next->next_ = write_head_->next_;
     write_head_->next_ = next;
   }
@@ -364,6 +478,9 @@ void NodeBIO::TryAllocateForWrite() {
 
 
 void NodeBIO::Reset() {
+  if (read_head_ == NULL)
+    return;
+
   while (read_head_->read_pos_ != read_head_->write_pos_) {
     assert(read_head_->write_pos_ > read_head_->read_pos_);
 
@@ -375,19 +492,27 @@ void NodeBIO::Reset() {
   }
   write_head_ = read_head_;
   assert(length_ == 0);
+
+  ReleaseBuffers();
 }
 
 
 NodeBIO::~NodeBIO() {
-  Buffer* current = head_.next_;
-  while (current != &head_) {
-    Buffer* next = current->next_;
-    delete current;
-    current = next;
+  if (read_head_ != NULL) {
+    Buffer* current = read_head_;
+    do {
+      Buffer* next = current->next_;
+      DeleteBuffer(current);
+      current = next;
+    } while (current != read_head_);
   }
 
   read_head_ = NULL;
   write_head_ = NULL;
+
+  assert(instances_ > 0);
+  if (--instances_ == 0)
+    FreePool();
 }
 
 }  // namespace node
@@ -33,9 +33,11 @@ class NodeBIO {
     return &method_;
   }
 
-  NodeBIO() : length_(0), read_head_(&head_), write_head_(&head_) {
-    // Loop head
-    head_.next_ = &head_;
+  NodeBIO() : length_(0),
+              read_head_(NULL),
+              write_head_(NULL),
+              write_reserved_(false) {
+    instances_++;
   }
 
   ~NodeBIO();
@@ -51,6 +53,9 @@ class NodeBIO {
   // Allocate new buffer for write if needed
   void TryAllocateForWrite();
 
+  // Return all buffers to the pool, only valid when there's no data left
+  void ReleaseBuffers();
+
   // Read `len` bytes maximum into `out`, return actual number of read bytes
   size_t Read(char* out, size_t size);
 
@@ -62,6 +67,11 @@ class NodeBIO {
   // contiguous data available to read
   char* Peek(size_t* size);
 
+  // Fill `out` and `size` with pointers to and sizes of up to `count`
+  // non-empty chunks of internal data, starting from the read head. Store the
+  // number of chunks in `count` and return their total size.
+  size_t PeekMultiple(char** out, size_t* size, size_t* count);
+
   // Find first appearance of `delim` in buffer or `limit` if `delim`
   // wasn't found.
   size_t IndexOf(char delim, size_t limit);
@@ -89,6 +99,11 @@ class NodeBIO {
     return static_cast<NodeBIO*>(bio->ptr);
   }
 
+  // Return amount of memory held by buffers, both in use and pooled
+  static inline size_t AllocatedBytes() {
+    return allocated_bytes_;
+  }
+
  protected:
   // NOTE: Size is maximum TLS frame length, this is required if we want
   // to fit whole ClientHello into one Buffer of NodeBIO.
@@ -105,12 +120,27 @@ class NodeBIO {
     char data_[kBufferLength];
   };
 
+  // NOTE: Buffers are allocated lazily and handed back to a process-wide
+  // pool as soon as the BIO is drained, so idle connections hold no memory.
+  // The pool itself is emptied when the last BIO goes away.
+  static const size_t kMaxPoolSize = 64;
+
+  static Buffer* NewBuffer();
+  static void DeleteBuffer(Buffer* buffer);
+  static void FreePool();
+
   size_t length_;
-  Buffer head_;
   Buffer* read_head_;
   Buffer* write_head_;
 
+  // Set by PeekWritable() until the reserved space is committed
+  bool write_reserved_;
+
   static BIO_METHOD method_;
+  static Buffer* pool_;
+  static size_t pool_size_;
+  static size_t allocated_bytes_;
+  static size_t instances_;
 };
 
 }  // namespace node
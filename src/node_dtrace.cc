@@ -29,6 +29,9 @@
 #include <string.h>
 #include "node_win32_etw_provider.h"
 #include "node_win32_etw_provider-inl.h"
+// Thread pool events aren't part of the ETW manifest.
+#define NODE_THREADPOOL_WORK_DONE(arg0, arg1, arg2, arg3)
+#define NODE_THREADPOOL_WORK_DONE_ENABLED() (0)
 #elif HAVE_SYSTEMTAP
 #include <string.h>
 #include <node.h>
@@ -296,6 +299,21 @@ void DTRACE_HTTP_CLIENT_RESPONSE(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+void TraceThreadpoolWork(const char* category,
+                         const char* name,
+                         uint64_t wait,
+                         uint64_t run) {
+#ifndef HAVE_SYSTEMTAP
+  if (!NODE_THREADPOOL_WORK_DONE_ENABLED())
+    return;
+#endif
+  NODE_THREADPOOL_WORK_DONE(const_cast<char*>(category),
+                            const_cast<char*>(name),
+                            wait,
+                            run);
+}
+
+
 static int dtrace_gc_start(GCType type, GCCallbackFlags flags) {
   NODE_GC_START(type, flags);
   /*
@@ -76,6 +76,12 @@ namespace node {
 
 void InitDTrace(v8::Handle<v8::Object> target);
 
+// Fires the threadpool-work-done probe, `wait` and `run` are in nanoseconds.
+void TraceThreadpoolWork(const char* category,
+                         const char* name,
+                         uint64_t wait,
+                         uint64_t run);
+
 }  // namespace node
 
 #endif  // SRC_NODE_DTRACE_H_
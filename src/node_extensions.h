@@ -39,6 +39,7 @@
     ITEM(node_http_parser)                                                    \
     ITEM(node_os)                                                             \
     ITEM(node_smalloc)                                                        \
+    ITEM(node_threadpool)                                                     \
     ITEM(node_zlib)                                                           \
                                                                               \
     ITEM(node_uv)                                                             \
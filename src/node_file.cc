@@ -24,7 +24,9 @@
 #include "node_buffer.h"
 #include "node_internals.h"
 #include "node_stat_watcher.h"
+#include "node_threadpool.h"
 #include "req_wrap.h"
+#include "smalloc.h"
 #include "string_bytes.h"
 
 #include <fcntl.h>
@@ -34,6 +36,7 @@
 #include <string.h>
 #include <errno.h>
 #include <limits.h>
+#include <math.h>
 
 #if defined(__MINGW32__) || defined(_MSC_VER)
 # include <io.h>
@@ -83,6 +86,7 @@ class FSReqWrap: public ReqWrap<uv_fs_t> {
 
 
 static Cached<String> oncomplete_sym;
+static Cached<String> onbatch_sym;
 
 
 #define ASSERT_OFFSET(a) \
@@ -107,6 +111,9 @@ static void After(uv_fs_t *req) {
   FSReqWrap* req_wrap = static_cast<FSReqWrap*>(req->data);
   assert(&req_wrap->req_ == req);
   req_wrap->ReleaseEarly();  // Free memory that's no longer used now.
+  threadpool::RecordWork("fs",
+                         req_wrap->syscall(),
+                         reinterpret_cast<uv_req_t*>(req));
 
   // there is always at least one argument. "error"
   int argc = 1;
@@ -181,6 +188,10 @@ static void After(uv_fs_t *req) {
         argv[1] = Integer::New(req->result, node_isolate);
         break;
 
+      case UV_FS_SENDFILE:
+        argv[1] = Number::New(static_cast<double>(req->result));
+        break;
+
       case UV_FS_READDIR:
         {
           char *namebuf = static_cast<char*>(req->ptr);
@@ -271,101 +282,94 @@ static void Close(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// The raw fields of a stat result: a libuv error code, zero on success, then
+// the fields of its uv_stat_t. fs.Stats objects are built from these, and
+// statMany() returns kStatFields of them for every path. lib/fs.js knows the
+// layout.
+enum StatField {
+  kStatError,
+  kStatDev,
+  kStatMode,
+  kStatNlink,
+  kStatUid,
+  kStatGid,
+  kStatRdev,
+  kStatBlksize,
+  kStatIno,
+  kStatSize,
+  kStatBlocks,
+  kStatAtime,
+  kStatMtime,
+  kStatCtime,
+  kStatFields
+};
+
+
+static void FillStatFields(const uv_stat_t* s, double* fields) {
+  fields[kStatError] = 0;
+  fields[kStatDev] = s->st_dev;
+  fields[kStatMode] = s->st_mode;
+  fields[kStatNlink] = s->st_nlink;
+  fields[kStatUid] = s->st_uid;
+  fields[kStatGid] = s->st_gid;
+  fields[kStatRdev] = s->st_rdev;
+  fields[kStatIno] = s->st_ino;
+  fields[kStatSize] = s->st_size;
+#if defined(__POSIX__)
+  fields[kStatBlksize] = s->st_blksize;
+  fields[kStatBlocks] = s->st_blocks;
+#else
+  fields[kStatBlksize] = NAN;
+  fields[kStatBlocks] = NAN;
+#endif
+#define X(field, rec)                                                         \
+  fields[field] = static_cast<double>(s->st_##rec.tv_sec) * 1000 +            \
+                  static_cast<double>(s->st_##rec.tv_nsec / 1000000);
+  X(kStatAtime, atim)
+  X(kStatMtime, mtim)
+  X(kStatCtime, ctim)
+#undef X
+}
+
+
 static Persistent<Function> stats_constructor;
 
-static Cached<String> dev_symbol;
-static Cached<String> ino_symbol;
-static Cached<String> mode_symbol;
-static Cached<String> nlink_symbol;
-static Cached<String> uid_symbol;
-static Cached<String> gid_symbol;
-static Cached<String> rdev_symbol;
-static Cached<String> size_symbol;
-static Cached<String> blksize_symbol;
-static Cached<String> blocks_symbol;
-static Cached<String> atime_symbol;
-static Cached<String> mtime_symbol;
-static Cached<String> ctime_symbol;
+// stat(), lstat() and fstat() leave their result here, and hand the array
+// that exposes it to the fs.Stats constructor.
+static double stat_values[kStatFields];
+static Persistent<Object> stat_values_object;
 
 Local<Object> BuildStatsObject(const uv_stat_t* s) {
   HandleScope scope(node_isolate);
 
-  if (dev_symbol.IsEmpty()) {
-    dev_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "dev");
-    ino_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "ino");
-    mode_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "mode");
-    nlink_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "nlink");
-    uid_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "uid");
-    gid_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "gid");
-    rdev_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "rdev");
-    size_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "size");
-    blksize_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "blksize");
-    blocks_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "blocks");
-    atime_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "atime");
-    mtime_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "mtime");
-    ctime_symbol = FIXED_ONE_BYTE_STRING(node_isolate, "ctime");
-  }
-
-  Local<Function> constructor =
-      PersistentToLocal(node_isolate, stats_constructor);
-  Local<Object> stats = constructor->NewInstance();
-  if (stats.IsEmpty()) return Local<Object>();
+  FillStatFields(s, stat_values);
 
-  // The code below is very nasty-looking but it prevents a segmentation fault
-  // when people run JS code like the snippet below. It's apparently more
-  // common than you would expect, several people have reported this crash...
+  // NewInstance() returns an empty handle when the stack is exhausted, which
+  // happens more often than you'd think in code like the snippet below. Bail
+  // out instead of crashing.
   //
   //   function crash() {
   //     fs.statSync('.');
   //     crash();
   //   }
   //
-  // We need to check the return value of Integer::New() and Date::New()
-  // and make sure that we bail out when V8 returns an empty handle.
-#define X(name)                                                               \
-  {                                                                           \
-    Local<Value> val = Integer::New(s->st_##name, node_isolate);              \
-    if (val.IsEmpty()) return Local<Object>();                                \
-    stats->Set(name##_symbol, val);                                           \
-  }
-  X(dev)
-  X(mode)
-  X(nlink)
-  X(uid)
-  X(gid)
-  X(rdev)
-# if defined(__POSIX__)
-  X(blksize)
-# endif
-#undef X
+  Local<Function> constructor =
+      PersistentToLocal(node_isolate, stats_constructor);
+  Local<Value> argv[] = {
+    PersistentToLocal(node_isolate, stat_values_object)
+  };
+  Local<Object> stats = constructor->NewInstance(ARRAY_SIZE(argv), argv);
+  if (stats.IsEmpty()) return Local<Object>();
 
-#define X(name)                                                               \
-  {                                                                           \
-    Local<Value> val = Number::New(static_cast<double>(s->st_##name));        \
-    if (val.IsEmpty()) return Local<Object>();                                \
-    stats->Set(name##_symbol, val);                                           \
-  }
-  X(ino)
-  X(size)
-# if defined(__POSIX__)
-  X(blocks)
-# endif
-#undef X
+  return scope.Close(stats);
+}
 
-#define X(name, rec)                                                          \
-  {                                                                           \
-    double msecs = static_cast<double>(s->st_##rec.tv_sec) * 1000;            \
-    msecs += static_cast<double>(s->st_##rec.tv_nsec / 1000000);              \
-    Local<Value> val = v8::Date::New(msecs);                                  \
-    if (val.IsEmpty()) return Local<Object>();                                \
-    stats->Set(name##_symbol, val);                                           \
-  }
-  X(atime, atim)
-  X(mtime, mtim)
-  X(ctime, ctim)
-#undef X
 
-  return scope.Close(stats);
+// FSInitialize(Stats)
+static void FSInitialize(const FunctionCallbackInfo<Value>& args) {
+  HandleScope scope(node_isolate);
+  assert(args[0]->IsFunction());
+  stats_constructor.Reset(node_isolate, args[0].As<Function>());
 }
 
 static void Stat(const FunctionCallbackInfo<Value>& args) {
@@ -420,6 +424,491 @@ static void FStat(const FunctionCallbackInfo<Value>& args) {
   }
 }
 
+// Synchronous uv_fs calls register themselves with the loop, which is only
+// safe on the loop's own thread. Work done on the thread pool borrows a loop
+// of its own for them. Loops are kept for reuse, so there are never more of
+// them than work items that ran at the same time; each one holds fds.
+static uv_once_t private_loops_once = UV_ONCE_INIT;
+static uv_mutex_t private_loops_mutex;
+static uv_loop_t* private_loops;  // free list, linked through loop->data
+
+
+static void InitPrivateLoops() {
+  if (uv_mutex_init(&private_loops_mutex))
+    abort();
+}
+
+
+static uv_loop_t* AcquirePrivateLoop() {
+  uv_once(&private_loops_once, InitPrivateLoops);
+  uv_mutex_lock(&private_loops_mutex);
+  uv_loop_t* loop = private_loops;
+  if (loop != NULL)
+    private_loops = static_cast<uv_loop_t*>(loop->data);
+  uv_mutex_unlock(&private_loops_mutex);
+
+  if (loop == NULL) {
+    loop = uv_loop_new();
+    if (loop == NULL)
+      FatalError("node::AcquirePrivateLoop()", "Out Of Memory");
+  }
+  return loop;
+}
+
+
+static void ReleasePrivateLoop(uv_loop_t* loop) {
+  uv_mutex_lock(&private_loops_mutex);
+  loop->data = private_loops;
+  private_loops = loop;
+  uv_mutex_unlock(&private_loops_mutex);
+}
+
+
+class StatManyReq : public ReqWrap<uv_work_t> {
+ public:
+  StatManyReq(Local<Object> object, char** paths, uint32_t count, bool lstat)
+      : ReqWrap<uv_work_t>(object),
+        paths_(paths),
+        count_(count),
+        lstat_(lstat),
+        fields_(new double[count * kStatFields]) {
+  }
+
+  ~StatManyReq() {
+    for (uint32_t i = 0; i < count_; i++)
+      delete[] paths_[i];
+    delete[] paths_;
+    delete[] fields_;
+  }
+
+  void Run(uv_loop_t* loop) {
+    for (uint32_t i = 0; i < count_; i++) {
+      uv_fs_t req;
+      double* fields = fields_ + i * kStatFields;
+      int err = lstat_ ? uv_fs_lstat(loop, &req, paths_[i], NULL) :
+                         uv_fs_stat(loop, &req, paths_[i], NULL);
+      if (err < 0) {
+        for (int k = 0; k < kStatFields; k++)
+          fields[k] = 0;
+        fields[kStatError] = err;
+      } else {
+        FillStatFields(static_cast<const uv_stat_t*>(req.ptr), fields);
+      }
+      uv_fs_req_cleanup(&req);
+    }
+  }
+
+  // Hands the stats over to a new object, as an external double array.
+  Local<Object> Result() {
+    Local<Object> result = Object::New();
+    smalloc::Alloc(result,
+                   reinterpret_cast<char*>(fields_),
+                   count_ * kStatFields * sizeof(*fields_),
+                   v8::kExternalDoubleArray);
+    fields_ = NULL;
+    return result;
+  }
+
+  static void Work(uv_work_t* req) {
+    StatManyReq* req_wrap = static_cast<StatManyReq*>(req->data);
+    uv_loop_t* loop = AcquirePrivateLoop();
+    req_wrap->Run(loop);
+    ReleasePrivateLoop(loop);
+  }
+
+  static void AfterWork(uv_work_t* req, int status) {
+    assert(status == 0);
+    HandleScope scope(node_isolate);
+    StatManyReq* req_wrap = static_cast<StatManyReq*>(req->data);
+    threadpool::RecordWork("fs",
+                           req_wrap->lstat_ ? "lstatMany" : "statMany",
+                           reinterpret_cast<uv_req_t*>(req));
+    Local<Value> argv[2] = { Null(node_isolate), req_wrap->Result() };
+    MakeCallback(req_wrap->object(), oncomplete_sym, ARRAY_SIZE(argv), argv);
+    delete req_wrap;
+  }
+
+ private:
+  char** paths_;
+  uint32_t count_;
+  bool lstat_;
+  double* fields_;
+};
+
+
+// statMany(paths, lstat, [req])
+static void StatMany(const FunctionCallbackInfo<Value>& args) {
+  HandleScope scope(node_isolate);
+
+  if (!args[0]->IsArray()) return TYPE_ERROR("paths must be an array");
+
+  Local<Array> list = args[0].As<Array>();
+  uint32_t count = list->Length();
+  char** paths = new char*[count];
+  for (uint32_t i = 0; i < count; i++) {
+    String::Utf8Value path(list->Get(i));
+    paths[i] = new char[path.length() + 1];
+    memcpy(paths[i], *path, path.length() + 1);
+  }
+
+  if (args[2]->IsObject()) {
+    StatManyReq* req_wrap = new StatManyReq(args[2].As<Object>(),
+                                            paths,
+                                            count,
+                                            args[1]->IsTrue());
+    req_wrap->Dispatched();
+    uv_queue_work2(uv_default_loop(),
+                   &req_wrap->req_,
+                   UV_WORK_IO,
+                   StatManyReq::Work,
+                   StatManyReq::AfterWork);
+  } else {
+    StatManyReq req_wrap(Object::New(), paths, count, args[1]->IsTrue());
+    req_wrap.Dispatched();
+    req_wrap.Run(uv_default_loop());
+    args.GetReturnValue().Set(req_wrap.Result());
+  }
+}
+
+
+// Turns an error code from statMany() or a walker into an exception object
+// that looks like the one the synchronous call would have thrown.
+static void UVError(const FunctionCallbackInfo<Value>& args) {
+  HandleScope scope(node_isolate);
+  String::Utf8Value syscall(args[1]);
+  String::Utf8Value path(args[2]);
+  args.GetReturnValue().Set(
+      UVException(args[0]->Int32Value(), *syscall, NULL, *path));
+}
+
+
+/**
+ * fs.walk() goes through a directory tree depth first on the thread pool.
+ * Every read() produces one batch of entries, in directory order, and the
+ * walker stays idle until it is asked for the next one.
+ */
+class Walker : public ObjectWrap {
+ public:
+  enum EntryType {
+    kOther,
+    kFile,
+    kDirectory,
+    kSymlink
+  };
+
+  // walker.read(batchSize) calls walker.onbatch(err, entries, done) with
+  // a flat array of path, type and depth triplets.
+  static void New(const FunctionCallbackInfo<Value>& args) {
+    HandleScope scope(node_isolate);
+    assert(args.IsConstructCall());
+
+    // new Walker(root, maxDepth, types, ignore, extensions)
+    if (!args[0]->IsString()) return TYPE_ERROR("path must be a string");
+
+    Walker* walker = new Walker();
+    walker->Wrap(args.This());
+
+    String::Utf8Value root(args[0]);
+    walker->max_depth_ = args[1]->IsNumber() ? args[1]->Uint32Value() : ~0U;
+    walker->types_ = args[2]->Uint32Value();
+    CopyList(args[3], &walker->ignore_, &walker->ignore_count_);
+    CopyList(args[4], &walker->extensions_, &walker->extensions_count_);
+
+    walker->PushDirectory(Copy(*root, root.length()), 0);
+  }
+
+  static void Read(const FunctionCallbackInfo<Value>& args) {
+    HandleScope scope(node_isolate);
+    Walker* walker = ObjectWrap::Unwrap<Walker>(args.This());
+    assert(!walker->reading_ && "read already in progress");
+
+    walker->batch_size_ = args[0]->Uint32Value();
+    if (walker->batch_size_ == 0)
+      walker->batch_size_ = 1;
+    walker->batch_ = new Entry[walker->batch_size_];
+    walker->batch_count_ = 0;
+    walker->reading_ = true;
+
+    walker->Ref();
+    uv_queue_work2(uv_default_loop(),
+                   &walker->work_req_,
+                   UV_WORK_IO,
+                   Walker::Work,
+                   Walker::AfterWork);
+  }
+
+ private:
+  struct Entry {
+    char* path;
+    EntryType type;
+    uint32_t depth;
+  };
+
+  struct Directory {
+    char* path;
+    uint32_t depth;
+    bool read;
+    char* names;  // from readdir
+    char* next_name;
+    int remaining;
+    Directory* parent;
+  };
+
+  Walker() : ObjectWrap(),
+             max_depth_(0),
+             types_(0),
+             ignore_(NULL),
+             ignore_count_(0),
+             extensions_(NULL),
+             extensions_count_(0),
+             stack_(NULL),
+             loop_(NULL),
+             reading_(false),
+             batch_(NULL),
+             batch_size_(0),
+             batch_count_(0),
+             err_(0),
+             err_path_(NULL) {
+  }
+
+  ~Walker() {
+    while (stack_ != NULL)
+      PopDirectory();
+    FreeList(ignore_, ignore_count_);
+    FreeList(extensions_, extensions_count_);
+    delete[] err_path_;
+  }
+
+  static char* Copy(const char* s, size_t length) {
+    char* copy = new char[length + 1];
+    memcpy(copy, s, length);
+    copy[length] = '\0';
+    return copy;
+  }
+
+  static void CopyList(Handle<Value> value, char*** list, uint32_t* count) {
+    if (!value->IsArray())
+      return;
+    Local<Array> array = value.As<Array>();
+    *count = array->Length();
+    *list = new char*[*count];
+    for (uint32_t i = 0; i < *count; i++) {
+      String::Utf8Value s(array->Get(i));
+      (*list)[i] = Copy(*s, s.length());
+    }
+  }
+
+  static void FreeList(char** list, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++)
+      delete[] list[i];
+    delete[] list;
+  }
+
+  void PushDirectory(char* path, uint32_t depth) {
+    Directory* dir = new Directory;
+    dir->path = path;
+    dir->depth = depth;
+    dir->read = false;
+    dir->names = NULL;
+    dir->next_name = NULL;
+    dir->remaining = 0;
+    dir->parent = stack_;
+    stack_ = dir;
+  }
+
+  void PopDirectory() {
+    Directory* dir = stack_;
+    stack_ = dir->parent;
+    delete[] dir->path;
+    free(dir->names);
+    delete dir;
+  }
+
+  bool Ignored(const char* name) const {
+    for (uint32_t i = 0; i < ignore_count_; i++) {
+      if (strcmp(ignore_[i], name) == 0)
+        return true;
+    }
+    return false;
+  }
+
+  bool Wanted(const char* name, EntryType type) const {
+    if ((types_ & (1 << type)) == 0)
+      return false;
+    if (extensions_count_ == 0 || type == kDirectory)
+      return true;
+    size_t length = strlen(name);
+    for (uint32_t i = 0; i < extensions_count_; i++) {
+      size_t ext_length = strlen(extensions_[i]);
+      if (length >= ext_length &&
+          strcmp(name + length - ext_length, extensions_[i]) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static EntryType TypeOf(const uv_stat_t* s) {
+    switch (s->st_mode & S_IFMT) {
+      case S_IFREG: return kFile;
+      case S_IFDIR: return kDirectory;
+#ifdef S_IFLNK
+      case S_IFLNK: return kSymlink;
+#endif
+      default: return kOther;
+    }
+  }
+
+  // Runs on the thread pool, fills up the batch.
+  static void Work(uv_work_t* req) {
+    Walker* walker = container_of(req, Walker, work_req_);
+    // the loop is only borrowed for this batch, an idle walker holds none.
+    walker->loop_ = AcquirePrivateLoop();
+    while (walker->stack_ != NULL &&
+           walker->batch_count_ < walker->batch_size_ &&
+           walker->err_ == 0) {
+      walker->Step();
+    }
+    ReleasePrivateLoop(walker->loop_);
+    walker->loop_ = NULL;
+  }
+
+  void Step() {
+    Directory* dir = stack_;
+    uv_fs_t req;
+
+    if (!dir->read) {
+      int err = uv_fs_readdir(loop_, &req, dir->path, 0, NULL);
+      if (err < 0) {
+        // directories that disappear or can't be read are skipped, but
+        // the walk fails if the root can't be read.
+        if (dir->parent == NULL) {
+          err_ = err;
+          err_path_ = Copy(dir->path, strlen(dir->path));
+        }
+        uv_fs_req_cleanup(&req);
+        PopDirectory();
+        return;
+      }
+      dir->read = true;
+      dir->names = static_cast<char*>(req.ptr);
+      dir->next_name = dir->names;
+      dir->remaining = err;
+      req.ptr = NULL;
+      uv_fs_req_cleanup(&req);
+    }
+
+    if (dir->remaining == 0) {
+      PopDirectory();
+      return;
+    }
+
+    const char* name = dir->next_name;
+    size_t name_length = strlen(name);
+    dir->next_name += name_length + 1;
+    dir->remaining--;
+
+    if (Ignored(name))
+      return;
+
+    size_t dir_length = strlen(dir->path);
+    bool separator = dir_length > 0 && dir->path[dir_length - 1] != '/';
+#ifdef _WIN32
+    separator = separator && dir->path[dir_length - 1] != '\\';
+#endif
+    char* path = new char[dir_length + separator + name_length + 1];
+    memcpy(path, dir->path, dir_length);
+    if (separator) {
+#ifdef _WIN32
+      path[dir_length] = '\\';
+#else
+      path[dir_length] = '/';
+#endif
+    }
+    memcpy(path + dir_length + separator, name, name_length + 1);
+
+    if (uv_fs_lstat(loop_, &req, path, NULL) < 0) {
+      // gone since the readdir, skip it.
+      uv_fs_req_cleanup(&req);
+      delete[] path;
+      return;
+    }
+    EntryType type = TypeOf(static_cast<const uv_stat_t*>(req.ptr));
+    uv_fs_req_cleanup(&req);
+
+    uint32_t depth = dir->depth + 1;
+    bool descend = type == kDirectory && depth < max_depth_;
+
+    if (Wanted(name, type)) {
+      Entry* entry = &batch_[batch_count_++];
+      entry->path = descend ? Copy(path, strlen(path)) : path;
+      entry->type = type;
+      entry->depth = depth;
+    } else if (!descend) {
+      delete[] path;
+    }
+
+    if (descend)
+      PushDirectory(path, depth);  // after the entry, in the same batch
+  }
+
+  static void AfterWork(uv_work_t* req, int status) {
+    assert(status == 0);
+    HandleScope scope(node_isolate);
+    Walker* walker = container_of(req, Walker, work_req_);
+    threadpool::RecordWork("fs", "walk", reinterpret_cast<uv_req_t*>(req));
+
+    Local<Array> entries = Array::New(walker->batch_count_ * 3);
+    for (uint32_t i = 0; i < walker->batch_count_; i++) {
+      Entry* entry = &walker->batch_[i];
+      entries->Set(i * 3, String::NewFromUtf8(node_isolate, entry->path));
+      entries->Set(i * 3 + 1, Integer::New(entry->type, node_isolate));
+      entries->Set(i * 3 + 2, Integer::NewFromUnsigned(entry->depth,
+                                                       node_isolate));
+      delete[] entry->path;
+    }
+    delete[] walker->batch_;
+    walker->batch_ = NULL;
+    walker->reading_ = false;
+
+    Local<Value> argv[3] = {
+      Null(node_isolate),
+      entries,
+      v8::Boolean::New(walker->stack_ == NULL)
+    };
+    if (walker->err_ != 0) {
+      argv[0] = UVException(walker->err_, "readdir", NULL, walker->err_path_);
+      argv[2] = v8::True(node_isolate);
+    }
+
+    MakeCallback(walker->handle(node_isolate),
+                 onbatch_sym,
+                 ARRAY_SIZE(argv),
+                 argv);
+    walker->Unref();
+  }
+
+  uint32_t max_depth_;
+  uint32_t types_;
+  char** ignore_;
+  uint32_t ignore_count_;
+  char** extensions_;
+  uint32_t extensions_count_;
+
+  Directory* stack_;
+  uv_loop_t* loop_;
+
+  bool reading_;
+  Entry* batch_;
+  uint32_t batch_size_;
+  uint32_t batch_count_;
+  int err_;
+  char* err_path_;
+
+  uv_work_t work_req_;
+};
+
+
 static void Symlink(const FunctionCallbackInfo<Value>& args) {
   HandleScope scope(node_isolate);
 
@@ -832,6 +1321,45 @@ static void Read(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+/*
+ * Wrapper for sendfile(2).
+ *
+ * 0 out_fd    integer. socket to write to
+ * 1 in_fd     integer. file to read from
+ * 2 position  integer. offset in the file
+ * 3 length    integer. number of bytes to send
+ * 4 cb        optional.
+ *
+ * Returns the number of bytes sent, which can be less than `length`. Fails
+ * with EAGAIN when the socket is non-blocking and its send buffer is full.
+ */
+static void SendFile(const FunctionCallbackInfo<Value>& args) {
+  HandleScope scope(node_isolate);
+
+  if (args.Length() < 4 || !args[0]->IsInt32() || !args[1]->IsInt32()) {
+    return THROW_BAD_ARGS;
+  }
+
+  int out_fd = args[0]->Int32Value();
+  int in_fd = args[1]->Int32Value();
+  int64_t pos = GET_OFFSET(args[2]);
+  int64_t len = args[3]->IntegerValue();
+
+  if (pos < 0 || len < 0) {
+    return ThrowRangeError("Position and length must be >= 0");
+  }
+
+  Local<Value> cb = args[4];
+
+  if (cb->IsFunction()) {
+    ASYNC_CALL(sendfile, cb, out_fd, in_fd, pos, len)
+  } else {
+    SYNC_CALL(sendfile, 0, out_fd, in_fd, pos, len)
+    args.GetReturnValue().Set(static_cast<double>(SYNC_RESULT));
+  }
+}
+
+
 /* fs.chmod(path, mode);
  * Wrapper for chmod(1) / EIO_CHMOD
  */
@@ -975,6 +1503,7 @@ void File::Initialize(Handle<Object> target) {
   NODE_SET_METHOD(target, "close", Close);
   NODE_SET_METHOD(target, "open", Open);
   NODE_SET_METHOD(target, "read", Read);
+  NODE_SET_METHOD(target, "sendfile", SendFile);
   NODE_SET_METHOD(target, "fdatasync", Fdatasync);
   NODE_SET_METHOD(target, "fsync", Fsync);
   NODE_SET_METHOD(target, "rename", Rename);
@@ -985,6 +1514,8 @@ void File::Initialize(Handle<Object> target) {
   NODE_SET_METHOD(target, "stat", Stat);
   NODE_SET_METHOD(target, "lstat", LStat);
   NODE_SET_METHOD(target, "fstat", FStat);
+  NODE_SET_METHOD(target, "statMany", StatMany);
+  NODE_SET_METHOD(target, "uvError", UVError);
   NODE_SET_METHOD(target, "link", Link);
   NODE_SET_METHOD(target, "symlink", Symlink);
   NODE_SET_METHOD(target, "readlink", ReadLink);
@@ -1007,14 +1538,25 @@ void File::Initialize(Handle<Object> target) {
 void InitFs(Handle<Object> target) {
   HandleScope scope(node_isolate);
 
-  // Initialize the stats object
-  Local<Function> constructor = FunctionTemplate::New()->GetFunction();
-  target->Set(FIXED_ONE_BYTE_STRING(node_isolate, "Stats"), constructor);
-  stats_constructor.Reset(node_isolate, constructor);
+  Local<Object> values = Object::New();
+  values->SetIndexedPropertiesToExternalArrayData(stat_values,
+                                                  v8::kExternalDoubleArray,
+                                                  kStatFields);
+  stat_values_object.Reset(node_isolate, values);
+  target->Set(FIXED_ONE_BYTE_STRING(node_isolate, "statValues"), values);
+  NODE_SET_METHOD(target, "FSInitialize", FSInitialize);
 
   File::Initialize(target);
 
   oncomplete_sym = FIXED_ONE_BYTE_STRING(node_isolate, "oncomplete");
+  onbatch_sym = FIXED_ONE_BYTE_STRING(node_isolate, "onbatch");
+
+  Local<FunctionTemplate> walker = FunctionTemplate::New(Walker::New);
+  walker->InstanceTemplate()->SetInternalFieldCount(1);
+  walker->SetClassName(FIXED_ONE_BYTE_STRING(node_isolate, "Walker"));
+  NODE_SET_PROTOTYPE_METHOD(walker, "read", Walker::Read);
+  target->Set(FIXED_ONE_BYTE_STRING(node_isolate, "Walker"),
+              walker->GetFunction());
 
   StatWatcher::Initialize(target);
 }
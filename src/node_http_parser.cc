@@ -22,10 +22,16 @@
 #include "node.h"
 #include "node_buffer.h"
 #include "node_http_parser.h"
+#include "node_internals.h"
+#include "node_wrap.h"  // WITH_GENERIC_STREAM
+#include "stream_wrap.h"
 #include "v8.h"
 
+#include <assert.h>
+#include <stdio.h>  // snprintf()
 #include <stdlib.h>  // free()
 #include <string.h>  // strdup()
+#include <time.h>
 
 #if defined(_MSC_VER)
 #define strcasecmp _stricmp
@@ -43,6 +49,10 @@
 //     ...
 // No copying is performed when slicing the buffer, only small reference
 // allocations.
+//
+// A server parser can also consume() a socket's handle. Reads then go
+// straight from the handle into http_parser_execute() without a Buffer or
+// a trip through the socket's onread, see HTTPParserCallbacks.
 
 
 namespace node {
@@ -58,12 +68,15 @@ using v8::Integer;
 using v8::Local;
 using v8::Object;
 using v8::String;
+using v8::TryCatch;
+using v8::Undefined;
 using v8::Value;
 
 const uint32_t kOnHeaders = 0;
 const uint32_t kOnHeadersComplete = 1;
 const uint32_t kOnBody = 2;
 const uint32_t kOnMessageComplete = 3;
+const uint32_t kOnExecute = 4;
 
 static Cached<String> method_sym;
 static Cached<String> status_code_sym;
@@ -73,7 +86,9 @@ static Cached<String> version_minor_sym;
 static Cached<String> should_keep_alive_sym;
 static Cached<String> upgrade_sym;
 static Cached<String> headers_sym;
+static Cached<String> headers_object_sym;
 static Cached<String> url_sym;
+static Cached<String> comma_sym;
 
 static Cached<String> unknown_method_sym;
 
@@ -84,6 +99,159 @@ HTTP_METHOD_MAP(X)
 static struct http_parser_settings settings;
 
 
+// How IncomingMessage#_addHeaderLine() merges repeated headers.
+enum HeaderMerge {
+  kDropDuplicates,  // The first one wins.
+  kJoinValues,      // Joined with ', '.
+  kArrayValues      // Collected in an array.
+};
+
+// Header names that show up in practically every message. The parser hands
+// out internalized strings for them instead of allocating new ones for
+// every header of every message.
+static const struct {
+  const char* name;
+  HeaderMerge merge;
+} known_headers[] = {
+  { "Accept", kJoinValues },
+  { "Accept-Charset", kJoinValues },
+  { "Accept-Encoding", kJoinValues },
+  { "Accept-Language", kJoinValues },
+  { "Accept-Ranges", kDropDuplicates },
+  { "Access-Control-Allow-Origin", kDropDuplicates },
+  { "Age", kDropDuplicates },
+  { "Allow", kDropDuplicates },
+  { "Authorization", kDropDuplicates },
+  { "Cache-Control", kDropDuplicates },
+  { "Connection", kJoinValues },
+  { "Content-Disposition", kDropDuplicates },
+  { "Content-Encoding", kDropDuplicates },
+  { "Content-Language", kDropDuplicates },
+  { "Content-Length", kDropDuplicates },
+  { "Content-Location", kDropDuplicates },
+  { "Content-MD5", kDropDuplicates },
+  { "Content-Range", kDropDuplicates },
+  { "Content-Type", kDropDuplicates },
+  { "Cookie", kJoinValues },
+  { "Date", kDropDuplicates },
+  { "DNT", kDropDuplicates },
+  { "ETag", kDropDuplicates },
+  { "Expect", kDropDuplicates },
+  { "Expires", kDropDuplicates },
+  { "From", kDropDuplicates },
+  { "Host", kDropDuplicates },
+  { "If-Match", kDropDuplicates },
+  { "If-Modified-Since", kDropDuplicates },
+  { "If-None-Match", kDropDuplicates },
+  { "If-Range", kDropDuplicates },
+  { "If-Unmodified-Since", kDropDuplicates },
+  { "Keep-Alive", kDropDuplicates },
+  { "Last-Modified", kDropDuplicates },
+  { "Link", kJoinValues },
+  { "Location", kDropDuplicates },
+  { "Max-Forwards", kDropDuplicates },
+  { "Origin", kDropDuplicates },
+  { "Pragma", kJoinValues },
+  { "Proxy-Authenticate", kJoinValues },
+  { "Proxy-Authorization", kDropDuplicates },
+  { "Range", kDropDuplicates },
+  { "Referer", kDropDuplicates },
+  { "Retry-After", kDropDuplicates },
+  { "Sec-WebSocket-Extensions", kJoinValues },
+  { "Sec-WebSocket-Key", kDropDuplicates },
+  { "Sec-WebSocket-Protocol", kJoinValues },
+  { "Sec-WebSocket-Version", kDropDuplicates },
+  { "Server", kDropDuplicates },
+  { "Set-Cookie", kArrayValues },
+  { "TE", kDropDuplicates },
+  { "Trailer", kDropDuplicates },
+  { "Transfer-Encoding", kDropDuplicates },
+  { "Upgrade", kDropDuplicates },
+  { "User-Agent", kDropDuplicates },
+  { "Vary", kDropDuplicates },
+  { "Via", kDropDuplicates },
+  { "Warning", kDropDuplicates },
+  { "WWW-Authenticate", kJoinValues },
+  { "X-Forwarded-For", kJoinValues },
+  { "X-Forwarded-Host", kJoinValues },
+  { "X-Forwarded-Proto", kJoinValues },
+  { "X-Powered-By", kJoinValues },
+  { "X-Real-IP", kJoinValues },
+  { "X-Requested-With", kJoinValues }
+};
+
+static const size_t kMaxKnownHeaderLength = 32;
+static const unsigned kHeaderBuckets = 64;
+
+static char known_header_keys[ARRAY_SIZE(known_headers)]
+                             [kMaxKnownHeaderLength];
+static Cached<String> known_header_name_syms[ARRAY_SIZE(known_headers)];
+static Cached<String> known_header_key_syms[ARRAY_SIZE(known_headers)];
+// Hash chains, indices into known_headers[] plus one. Zero ends the chain.
+static uint8_t known_header_buckets[kHeaderBuckets];
+static uint8_t known_header_chain[ARRAY_SIZE(known_headers)];
+
+
+static inline char ToLower(char c) {
+  return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+}
+
+
+static inline unsigned HeaderBucket(const char* name, size_t length) {
+  return (length * 31 + ToLower(name[0]) + ToLower(name[length - 1])) %
+         kHeaderBuckets;
+}
+
+
+// Returns the index in known_headers[] or -1.
+static int FindKnownHeader(const char* name, size_t length) {
+  if (length == 0 || length >= kMaxKnownHeaderLength)
+    return -1;
+
+  unsigned entry = known_header_buckets[HeaderBucket(name, length)];
+  while (entry != 0) {
+    const char* key = known_header_keys[entry - 1];
+    size_t i = 0;
+    while (i < length && ToLower(name[i]) == key[i])
+      i++;
+    if (i == length && key[i] == '\0')
+      return entry - 1;
+    entry = known_header_chain[entry - 1];
+  }
+
+  return -1;
+}
+
+
+static void InitKnownHeaders() {
+  for (size_t i = 0; i < ARRAY_SIZE(known_headers); ++i) {
+    const char* name = known_headers[i].name;
+    size_t length = strlen(name);
+    assert(length < kMaxKnownHeaderLength);
+
+    char* key = known_header_keys[i];
+    for (size_t k = 0; k < length; ++k)
+      key[k] = ToLower(name[k]);
+    key[length] = '\0';
+
+    known_header_name_syms[i] = String::NewFromOneByte(
+        node_isolate,
+        reinterpret_cast<const uint8_t*>(name),
+        String::kInternalizedString,
+        length);
+    known_header_key_syms[i] = String::NewFromOneByte(
+        node_isolate,
+        reinterpret_cast<const uint8_t*>(key),
+        String::kInternalizedString,
+        length);
+
+    unsigned bucket = HeaderBucket(name, length);
+    known_header_chain[i] = known_header_buckets[bucket];
+    known_header_buckets[bucket] = i + 1;
+  }
+}
+
+
 // This is a hack to get the current_buffer to the callbacks with the least
 // amount of overhead. Nothing else will run while http_parser_execute()
 // runs, therefore this pointer can be set and used for the execution.
@@ -91,6 +259,11 @@ static Local<Value>* current_buffer;
 static char* current_buffer_data;
 static size_t current_buffer_len;
 
+// Set instead when the parser runs straight on a read from a stream. The
+// read is only turned into a Buffer when on_body() needs one, until then
+// *current_buffer is empty.
+static uv_buf_t* current_read;
+
 
 #define HTTP_CB(name)                                                         \
   static int name(http_parser* p_) {                                          \
@@ -185,20 +358,84 @@ struct StringPtr {
   }
 
 
+  // Returns the string in lower case and in `merge` how repeated headers
+  // with this name are merged. Returns an empty handle if the string is
+  // not ASCII.
+  Local<String> ToLowerCaseString(HeaderMerge* merge) const {
+    char stack[256];
+    char* s = size_ <= sizeof(stack) ? stack : new char[size_];
+    bool ascii = true;
+    for (size_t i = 0; i < size_; ++i) {
+      ascii = ascii && !(str_[i] & 0x80);
+      s[i] = ToLower(str_[i]);
+    }
+
+    Local<String> result;
+    if (ascii) {
+      result = OneByteString(node_isolate, s, size_);
+      // Extension headers are always joined.
+      bool extension = size_ >= 2 && s[0] == 'x' && s[1] == '-';
+      *merge = extension ? kJoinValues : kDropDuplicates;
+    }
+
+    if (s != stack)
+      delete[] s;
+    return result;
+  }
+
+
   const char* str_;
   bool on_heap_;
   size_t size_;
 };
 
 
+class Parser;
+
+
+// Stream callbacks that hand every read to a Parser. JS land only hears
+// about the parser's events, and once per read through kOnExecute so it
+// can do the bookkeeping the socket's onread would otherwise have done.
+class HTTPParserCallbacks : public StreamWrapCallbacks {
+ public:
+  HTTPParserCallbacks(Parser* parser, StreamWrapCallbacks* old)
+      : StreamWrapCallbacks(old),
+        parser_(parser),
+        in_read_(false),
+        detached_(false) {
+  }
+
+  ~HTTPParserCallbacks();
+
+  void DoRead(uv_stream_t* handle,
+              ssize_t nread,
+              uv_buf_t buf,
+              uv_handle_type pending);
+
+  // Go back to the stream's default callbacks. Deletes this object, but
+  // not before DoRead() is done with it.
+  void Detach();
+
+ private:
+  Parser* parser_;
+  bool in_read_;
+  bool detached_;
+
+  friend class Parser;
+};
+
+
 class Parser : public ObjectWrap {
  public:
-  explicit Parser(enum http_parser_type type) : ObjectWrap() {
+  explicit Parser(enum http_parser_type type) : ObjectWrap(),
+                                                consumer_(NULL) {
     Init(type);
   }
 
 
   ~Parser() {
+    if (consumer_ != NULL)
+      consumer_->parser_ = NULL;
   }
 
 
@@ -266,8 +503,13 @@ class Parser : public ObjectWrap {
       // Slow case, flush remaining headers.
       Flush();
     } else {
-      // Fast case, pass headers and URL to JS land.
-      message_info->Set(headers_sym, CreateHeaders());
+      // Fast case, pass headers and URL to JS land. The headers are also
+      // passed as the object IncomingMessage#headers, so JS land doesn't
+      // have to merge them again.
+      Local<Object> headers_object;
+      message_info->Set(headers_sym, CreateHeaders(&headers_object));
+      if (!headers_object.IsEmpty())
+        message_info->Set(headers_object_sym, headers_object);
       if (parser_.type == HTTP_REQUEST)
         message_info->Set(url_sym, url_.ToString());
     }
@@ -312,6 +554,14 @@ class Parser : public ObjectWrap {
 
 
   HTTP_DATA_CB(on_body) {
+    // Made in the caller's scope, later calls and the caller use it too.
+    if (current_buffer->IsEmpty()) {
+      assert(current_read != NULL);
+      *current_buffer =
+          StreamWrapCallbacks::UseReadBuffer(*current_read,
+                                             current_buffer_len);
+    }
+
     HandleScope scope(node_isolate);
 
     Local<Object> obj = handle(node_isolate);
@@ -408,16 +658,28 @@ class Parser : public ObjectWrap {
     char *buffer_data = Buffer::Data(buffer_obj);
     size_t buffer_len = Buffer::Length(buffer_obj);
 
+    Local<Value> ret = parser->Execute(buffer_data, buffer_len, &buffer_v);
+
+    // If there was an exception in one of the callbacks
+    if (ret.IsEmpty()) return;
+
+    args.GetReturnValue().Set(ret);
+  }
+
+
+  // Returns the number of bytes parsed or a parse error, or an empty handle
+  // if one of the callbacks threw. on_body() slices `buffer`. Handles end up
+  // in the caller's HandleScope.
+  Local<Value> Execute(char* data, size_t len, Local<Value>* buffer) {
     // Assign 'buffer_' while we parse. The callbacks will access that varible.
-    current_buffer = &buffer_v;
-    current_buffer_data = buffer_data;
-    current_buffer_len = buffer_len;
-    parser->got_exception_ = false;
+    current_buffer = buffer;
+    current_buffer_data = data;
+    current_buffer_len = len;
+    got_exception_ = false;
 
-    size_t nparsed =
-      http_parser_execute(&parser->parser_, &settings, buffer_data, buffer_len);
+    size_t nparsed = http_parser_execute(&parser_, &settings, data, len);
 
-    parser->Save();
+    Save();
 
     // Unassign the 'buffer_' variable
     assert(current_buffer);
@@ -425,13 +687,13 @@ class Parser : public ObjectWrap {
     current_buffer_data = NULL;
 
     // If there was an exception in one of the callbacks
-    if (parser->got_exception_) return;
+    if (got_exception_) return Local<Value>();
 
     Local<Integer> nparsed_obj = Integer::New(nparsed, node_isolate);
     // If there was a parse error in one of the callbacks
     // TODO(bnoordhuis) What if there is an error on EOF?
-    if (!parser->parser_.upgrade && nparsed != buffer_len) {
-      enum http_errno err = HTTP_PARSER_ERRNO(&parser->parser_);
+    if (!parser_.upgrade && nparsed != len) {
+      enum http_errno err = HTTP_PARSER_ERRNO(&parser_);
 
       Local<Value> e = Exception::Error(
           FIXED_ONE_BYTE_STRING(node_isolate, "Parse Error"));
@@ -439,10 +701,49 @@ class Parser : public ObjectWrap {
       obj->Set(FIXED_ONE_BYTE_STRING(node_isolate, "bytesParsed"), nparsed_obj);
       obj->Set(FIXED_ONE_BYTE_STRING(node_isolate, "code"),
                OneByteString(node_isolate, http_errno_name(err)));
-      args.GetReturnValue().Set(e);
-    } else {
-      args.GetReturnValue().Set(nparsed_obj);
+      return e;
     }
+
+    return nparsed_obj;
+  }
+
+
+  // var consumed = parser.consume(handle);
+  static void Consume(const FunctionCallbackInfo<Value>& args) {
+    HandleScope scope(node_isolate);
+
+    Parser* parser = ObjectWrap::Unwrap<Parser>(args.This());
+
+    if (!args[0]->IsObject())
+      return ThrowTypeError("Argument should be a stream handle");
+
+    if (parser->consumer_ != NULL)
+      return ThrowError("Already consuming a stream");
+
+    // Streams that already have their own callbacks (TLS) and IPC pipes are
+    // left alone, the caller falls back to parser.execute().
+    Local<Object> stream = args[0].As<Object>();
+    WITH_GENERIC_STREAM(stream, {
+      if (wrap->has_default_callbacks() && !wrap->is_named_pipe_ipc()) {
+        parser->consumer_ = new HTTPParserCallbacks(parser, wrap->callbacks());
+        wrap->OverrideCallbacks(parser->consumer_);
+      }
+    });
+
+    args.GetReturnValue().Set(parser->consumer_ != NULL);
+  }
+
+
+  static void Unconsume(const FunctionCallbackInfo<Value>& args) {
+    HandleScope scope(node_isolate);
+
+    Parser* parser = ObjectWrap::Unwrap<Parser>(args.This());
+
+    if (parser->consumer_ == NULL)
+      return;
+
+    parser->consumer_->Detach();
+    parser->consumer_ = NULL;
   }
 
 
@@ -487,20 +788,115 @@ class Parser : public ObjectWrap {
 
  private:
 
-  Local<Array> CreateHeaders() {
+  // Returns the headers as a flat array of names and values. If `object` is
+  // not NULL, it also gets the headers as IncomingMessage#headers.
+  Local<Array> CreateHeaders(Local<Object>* object = NULL) {
     // num_values_ is either -1 or the entry # of the last header
     // so num_values_ == 0 means there's a single header
     Local<Array> headers = Array::New(2 * num_values_);
+    Local<String> values[ARRAY_SIZE(values_)];
+    int known[ARRAY_SIZE(fields_)];
 
     for (int i = 0; i < num_values_; ++i) {
-      headers->Set(2 * i, fields_[i].ToString());
-      headers->Set(2 * i + 1, values_[i].ToString());
+      const StringPtr& field = fields_[i];
+      Handle<String> name;
+
+      known[i] = FindKnownHeader(field.str_, field.size_);
+      if (known[i] == -1) {
+        name = field.ToString();
+      } else if (memcmp(field.str_,
+                        known_headers[known[i]].name,
+                        field.size_) == 0) {
+        name = known_header_name_syms[known[i]];
+      } else if (memcmp(field.str_,
+                        known_header_keys[known[i]],
+                        field.size_) == 0) {
+        name = known_header_key_syms[known[i]];
+      } else {
+        name = field.ToString();
+      }
+
+      values[i] = values_[i].ToString();
+      headers->Set(2 * i, name);
+      headers->Set(2 * i + 1, values[i]);
     }
 
+    if (object != NULL)
+      *object = CreateHeadersObject(known, values);
+
     return headers;
   }
 
 
+  bool SameHeader(int a, int b, const int* known) const {
+    if (known[a] != -1 || known[b] != -1)
+      return known[a] == known[b];
+    if (fields_[a].size_ != fields_[b].size_)
+      return false;
+    for (size_t i = 0; i < fields_[a].size_; ++i) {
+      if (ToLower(fields_[a].str_[i]) != ToLower(fields_[b].str_[i]))
+        return false;
+    }
+    return true;
+  }
+
+
+  // Merges the headers into an object the way IncomingMessage#_addHeaderLine()
+  // does. Repeated headers are merged here so every name is stored once.
+  // Returns an empty handle if a name is not ASCII, JS land knows how to
+  // lowercase those.
+  Local<Object> CreateHeadersObject(const int* known,
+                                    const Local<String>* values) {
+    Local<Object> object = Object::New();
+
+    for (int i = 0; i < num_values_; ++i) {
+      int first = 0;
+      while (first < i && !SameHeader(first, i, known))
+        first++;
+      if (first < i)
+        continue;  // Merged with the first one.
+
+      Handle<String> key;
+      HeaderMerge merge;
+      if (known[i] != -1) {
+        key = known_header_key_syms[known[i]];
+        merge = known_headers[known[i]].merge;
+      } else {
+        key = fields_[i].ToLowerCaseString(&merge);
+        if (key.IsEmpty())
+          return Local<Object>();
+        // Names like 'constructor' already exist on Object.prototype.
+        if (merge == kDropDuplicates && !object->Get(key)->IsUndefined())
+          continue;
+      }
+
+      Local<Value> value = values[i];
+      if (merge == kArrayValues) {
+        Local<Array> array = Array::New(1);
+        array->Set(0, values[i]);
+        for (int k = i + 1; k < num_values_; ++k) {
+          if (SameHeader(i, k, known))
+            array->Set(array->Length(), values[k]);
+        }
+        value = array;
+      } else if (merge == kJoinValues) {
+        Local<String> joined = values[i];
+        for (int k = i + 1; k < num_values_; ++k) {
+          if (SameHeader(i, k, known)) {
+            joined = String::Concat(joined, comma_sym);
+            joined = String::Concat(joined, values[k]);
+          }
+        }
+        value = joined;
+      }
+
+      object->Set(key, value);
+    }
+
+    return object;
+  }
+
+
   // spill headers and request path to JS land
   void Flush() {
     HandleScope scope(node_isolate);
@@ -544,9 +940,611 @@ class Parser : public ObjectWrap {
   int num_values_;
   bool have_flushed_;
   bool got_exception_;
+  HTTPParserCallbacks* consumer_;
+
+  friend class HTTPParserCallbacks;
+};
+
+
+HTTPParserCallbacks::~HTTPParserCallbacks() {
+  if (parser_ != NULL)
+    parser_->consumer_ = NULL;
+}
+
+
+void HTTPParserCallbacks::DoRead(uv_stream_t* handle,
+                                 ssize_t nread,
+                                 uv_buf_t buf,
+                                 uv_handle_type pending) {
+  // EOF and errors are for the socket to deal with.
+  if (nread <= 0 || parser_ == NULL)
+    return StreamWrapCallbacks::DoRead(handle, nread, buf, pending);
+
+  // The parser's callbacks are called straight from here, not through
+  // MakeCallback().
+  UpdateLoopTime();
+
+  HandleScope scope(node_isolate);
+
+  Parser* parser = parser_;
+  Local<Object> obj = parser->handle(node_isolate);
+  Local<Value> buffer;
+
+  TryCatch try_catch;
+  try_catch.SetVerbose(true);
+
+  in_read_ = true;
+  current_read = &buf;
+  Local<Value> ret = parser->Execute(buf.base, nread, &buffer);
+  current_read = NULL;
+
+  if (!ret.IsEmpty() && parser->parser_.upgrade && buffer.IsEmpty()) {
+    // JS land wants what comes after the headers.
+    buffer = UseReadBuffer(buf, nread);
+  }
+
+  if (buffer.IsEmpty())
+    ReleaseReadBuffer(buf);
+
+  if (!ret.IsEmpty() && obj->Get(kOnExecute)->IsFunction()) {
+    if (buffer.IsEmpty())
+      buffer = Undefined(node_isolate);
+    Local<Value> argv[3] = {
+      ret,
+      Integer::New(nread, node_isolate),
+      buffer
+    };
+    MakeCallback(obj, kOnExecute, ARRAY_SIZE(argv), argv);
+  }
+
+  in_read_ = false;
+  if (detached_)
+    wrap()->ResetCallbacks();
+}
+
+
+void HTTPParserCallbacks::Detach() {
+  if (parser_ != NULL) {
+    parser_->consumer_ = NULL;
+    parser_ = NULL;
+  }
+  if (in_read_)
+    detached_ = true;
+  else
+    wrap()->ResetCallbacks();
+}
+
+
+// Outgoing headers.
+//
+// OutgoingMessage#_storeHeader() hands the first line and the header fields
+// to SerializeHeaders(), which builds the whole header block as one flat
+// string. It also makes the keep-alive and transfer-encoding decisions that
+// used to cost a handful of regular expressions per header. The caller
+// describes the message with the flags below. The flags that apply to the
+// finished header are returned in outgoing_state[0].
+enum OutgoingFlags {
+  kSendDate = 1 << 0,
+  kShouldKeepAlive = 1 << 1,
+  kChunkedEncoding = 1 << 2,
+  kUseChunkedEncodingByDefault = 1 << 3,
+  kHasAgent = 1 << 4,
+  kRemovedConnection = 1 << 5,
+  kRemovedTransferEncoding = 1 << 6,
+  kHasBody = 1 << 7,
+  kNoBodyStatus = 1 << 8,  // 204 or 304, must not be chunked.
+  kLast = 1 << 9,
+  kSentExpect = 1 << 10,
+  kForcedClose = 1 << 11  // A chunked 204 or 304 was turned into a close.
+};
+
+static uint32_t outgoing_state[1];
+
+// The header fields that /Connection/i and friends used to look for.
+enum HeaderMatch {
+  kConnectionHeader = 1 << 0,
+  kTransferEncodingHeader = 1 << 1,
+  kContentLengthHeader = 1 << 2,
+  kDateHeader = 1 << 3,
+  kExpectHeader = 1 << 4
 };
 
 
+// Builds the header block in a buffer that is reused from one message to
+// the next. Char is uint8_t as long as every string that goes in is a
+// one-byte string, uint16_t otherwise. Header values are converted to
+// strings while the block is built, and a toString() that serializes
+// headers of its own gets a buffer of its own.
+template <typename Char>
+class HeaderWriter {
+ public:
+  HeaderWriter() : length_(0), shared_(!shared_in_use_) {
+    if (shared_) {
+      shared_in_use_ = true;
+      storage_ = shared_storage_;
+      capacity_ = shared_capacity_;
+    } else {
+      storage_ = NULL;
+      capacity_ = 0;
+    }
+  }
+
+  ~HeaderWriter() {
+    if (shared_) {
+      shared_storage_ = storage_;
+      shared_capacity_ = capacity_;
+      shared_in_use_ = false;
+    } else {
+      free(storage_);
+    }
+  }
+
+  void Append(const char* s, size_t n) {
+    Char* dst = Reserve(n);
+    for (size_t i = 0; i < n; i++)
+      dst[i] = static_cast<unsigned char>(s[i]);
+    length_ += n;
+  }
+
+  // Returns false if a one-byte writer is handed a two-byte string.
+  bool Append(Handle<String> s);
+
+  void Truncate(size_t length) {
+    assert(length <= length_);
+    length_ = length;
+  }
+
+  Char* data() const {
+    return storage_;
+  }
+
+  size_t length() const {
+    return length_;
+  }
+
+  Local<String> ToString() const;
+
+ private:
+  Char* Reserve(size_t n) {
+    if (length_ + n > capacity_) {
+      size_t capacity = capacity_ == 0 ? 1024 : capacity_;
+      while (capacity < length_ + n)
+        capacity *= 2;
+      Char* storage =
+          static_cast<Char*>(realloc(storage_, capacity * sizeof(Char)));
+      if (storage == NULL)
+        FatalError("node::HeaderWriter", "Out Of Memory");
+      storage_ = storage;
+      capacity_ = capacity;
+    }
+    return storage_ + length_;
+  }
+
+  Char* storage_;
+  size_t capacity_;
+  size_t length_;
+  bool shared_;
+
+  static Char* shared_storage_;
+  static size_t shared_capacity_;
+  static bool shared_in_use_;
+};
+
+template <typename Char> Char* HeaderWriter<Char>::shared_storage_;
+template <typename Char> size_t HeaderWriter<Char>::shared_capacity_;
+template <typename Char> bool HeaderWriter<Char>::shared_in_use_;
+
+
+template <>
+bool HeaderWriter<uint8_t>::Append(Handle<String> s) {
+  if (!s->IsOneByte())
+    return false;
+  int n = s->Length();
+  s->WriteOneByte(Reserve(n), 0, n, String::NO_NULL_TERMINATION);
+  length_ += n;
+  return true;
+}
+
+
+template <>
+bool HeaderWriter<uint16_t>::Append(Handle<String> s) {
+  int n = s->Length();
+  s->Write(Reserve(n), 0, n, String::NO_NULL_TERMINATION);
+  length_ += n;
+  return true;
+}
+
+
+template <>
+Local<String> HeaderWriter<uint8_t>::ToString() const {
+  return String::NewFromOneByte(node_isolate,
+                                storage_,
+                                String::kNormalString,
+                                length_);
+}
+
+
+template <>
+Local<String> HeaderWriter<uint16_t>::ToString() const {
+  return String::NewFromTwoByte(node_isolate,
+                                storage_,
+                                String::kNormalString,
+                                length_);
+}
+
+
+template <typename Char>
+static inline Char ToLowerASCII(Char c) {
+  return c >= 'A' && c <= 'Z' ? c | 0x20 : c;
+}
+
+
+template <typename Char>
+static inline bool MatchIgnoreCase(const Char* s,
+                                   size_t n,
+                                   const char* word,
+                                   size_t word_length) {
+  if (n < word_length)
+    return false;
+  for (size_t i = 0; i < word_length; i++) {
+    if (ToLowerASCII(s[i]) != word[i])
+      return false;
+  }
+  return true;
+}
+
+
+// Same as /word/i.test(s), word is lower case.
+template <typename Char>
+static bool ContainsIgnoreCase(const Char* s, size_t n, const char* word) {
+  size_t word_length = strlen(word);
+  for (size_t i = 0; i + word_length <= n; i++) {
+    if (MatchIgnoreCase(s + i, n - i, word, word_length))
+      return true;
+  }
+  return false;
+}
+
+
+// Which of the interesting names occur anywhere in the field name, in a
+// single pass.
+template <typename Char>
+static uint32_t MatchHeaderField(const Char* s, size_t n) {
+#define MATCH(word)                                                           \
+  MatchIgnoreCase(s + i, n - i, word, sizeof(word) - 1)
+  uint32_t match = 0;
+  for (size_t i = 0; i < n; i++) {
+    switch (ToLowerASCII(s[i])) {
+      case 'c':
+        if (MATCH("connection"))
+          match |= kConnectionHeader;
+        else if (MATCH("content-length"))
+          match |= kContentLengthHeader;
+        break;
+      case 't':
+        if (MATCH("transfer-encoding"))
+          match |= kTransferEncodingHeader;
+        break;
+      case 'd':
+        if (MATCH("date"))
+          match |= kDateHeader;
+        break;
+      case 'e':
+        if (MATCH("expect"))
+          match |= kExpectHeader;
+        break;
+    }
+  }
+  return match;
+#undef MATCH
+}
+
+
+// Protects against response splitting, same as
+// value.replace(/[\r\n]+[ \t]*/g, ''). Returns the new length.
+template <typename Char>
+static size_t StripLineBreaks(Char* s, size_t n) {
+  size_t k = 0;
+  for (size_t i = 0; i < n;) {
+    if (s[i] != '\r' && s[i] != '\n') {
+      s[k++] = s[i++];
+      continue;
+    }
+    while (i < n && (s[i] == '\r' || s[i] == '\n'))
+      i++;
+    while (i < n && (s[i] == ' ' || s[i] == '\t'))
+      i++;
+  }
+  return k;
+}
+
+
+// "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n", the same as what
+// Date#toUTCString() returns. Rebuilt at most once per second.
+static char date_header[64];
+static size_t date_header_length;
+static time_t date_header_time = -1;
+
+static void UpdateDateHeader() {
+  static const char days[7][4] = {
+    "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"
+  };
+  static const char months[12][4] = {
+    "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+    "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+  };
+
+  time_t now = time(NULL);
+  if (now == date_header_time)
+    return;
+
+  struct tm tm;
+#ifdef _WIN32
+  gmtime_s(&tm, &now);
+#else
+  gmtime_r(&now, &tm);
+#endif
+
+  int n = snprintf(date_header,
+                   sizeof(date_header),
+                   "Date: %s, %02d %s %04d %02d:%02d:%02d GMT\r\n",
+                   days[tm.tm_wday],
+                   tm.tm_mday,
+                   months[tm.tm_mon],
+                   tm.tm_year + 1900,
+                   tm.tm_hour,
+                   tm.tm_min,
+                   tm.tm_sec);
+  assert(n > 0 && static_cast<size_t>(n) < sizeof(date_header));
+  date_header_length = n;
+  date_header_time = now;
+}
+
+
+// "HTTP/1.1 200 OK\r\n" and friends, built the first time a status code is
+// used and kept for as long as the reason phrase stays the same.
+struct StatusLine {
+  v8::Persistent<String> reason;
+  size_t length;
+  char data[64];
+};
+
+static StatusLine* status_lines[1000];
+
+template <typename Char>
+static bool AppendStatusLine(HeaderWriter<Char>* w,
+                             Handle<Value> code,
+                             Handle<String> reason) {
+  uint32_t status_code = ARRAY_SIZE(status_lines);
+  if (code->IsUint32())
+    status_code = code->Uint32Value();
+
+  StatusLine* line = status_code < ARRAY_SIZE(status_lines) ?
+      status_lines[status_code] : NULL;
+
+  if (line != NULL &&
+      PersistentToLocal(node_isolate, line->reason)->StrictEquals(reason)) {
+    w->Append(line->data, line->length);
+    return true;
+  }
+
+  size_t start = w->length();
+  w->Append("HTTP/1.1 ", 9);
+  w->Append(code->ToString());
+  w->Append(" ", 1);
+  if (!w->Append(reason))
+    return false;
+  w->Append("\r\n", 2);
+
+  size_t length = w->length() - start;
+  if (sizeof(Char) != 1 ||
+      status_code >= ARRAY_SIZE(status_lines) ||
+      length > sizeof(line->data)) {
+    return true;
+  }
+
+  if (line == NULL)
+    line = status_lines[status_code] = new StatusLine;
+  line->reason.Reset(node_isolate, reason);
+  memcpy(line->data, w->data() + start, length);
+  line->length = length;
+  return true;
+}
+
+
+// Appends 'field: value\r\n' and works out what it means for the message.
+template <typename Char>
+static bool AppendHeaderField(HeaderWriter<Char>* w,
+                              Handle<String> field,
+                              Handle<String> value,
+                              uint32_t* flags,
+                              uint32_t* sent) {
+  size_t field_start = w->length();
+  if (!w->Append(field))
+    return false;
+  size_t field_length = w->length() - field_start;
+  w->Append(": ", 2);
+  size_t value_start = w->length();
+  if (!w->Append(value))
+    return false;
+  size_t value_length = w->length() - value_start;
+
+  Char* v = w->data() + value_start;
+  for (size_t i = 0; i < value_length; i++) {
+    if (v[i] == '\r' || v[i] == '\n') {
+      value_length = StripLineBreaks(v, value_length);
+      w->Truncate(value_start + value_length);
+      break;
+    }
+  }
+  w->Append("\r\n", 2);
+
+  // The first of these that matches wins, like the if/else chain it
+  // replaces.
+  Char* f = w->data() + field_start;
+  v = w->data() + value_start;
+  uint32_t match = MatchHeaderField(f, field_length);
+  if (match & kConnectionHeader) {
+    *sent |= kConnectionHeader;
+    if (ContainsIgnoreCase(v, value_length, "close"))
+      *flags |= kLast;
+    else
+      *flags |= kShouldKeepAlive;
+  } else if (match & kTransferEncodingHeader) {
+    *sent |= kTransferEncodingHeader;
+    if (ContainsIgnoreCase(v, value_length, "chunk"))
+      *flags |= kChunkedEncoding;
+  } else if (match & kContentLengthHeader) {
+    *sent |= kContentLengthHeader;
+  } else if (match & kDateHeader) {
+    *sent |= kDateHeader;
+  } else if (match & kExpectHeader) {
+    *flags |= kSentExpect;
+  }
+
+  return true;
+}
+
+
+// Like OutgoingMessage#_storeHeader() used to, array values repeat the field
+// once per element.
+template <typename Char>
+static bool AppendHeader(HeaderWriter<Char>* w,
+                         Handle<String> field,
+                         Handle<Value> value,
+                         uint32_t* flags,
+                         uint32_t* sent) {
+  if (!value->IsArray()) {
+    Local<String> s = value->ToString();
+    return !s.IsEmpty() && AppendHeaderField(w, field, s, flags, sent);
+  }
+
+  Local<Array> values = value.As<Array>();
+  for (uint32_t i = 0, n = values->Length(); i < n; i++) {
+    Local<String> s = values->Get(i)->ToString();
+    if (s.IsEmpty() || !AppendHeaderField(w, field, s, flags, sent))
+      return false;
+  }
+  return true;
+}
+
+
+// Returns the header block, or an empty handle if it has to be built again
+// with a wider writer, or if an exception is pending.
+template <typename Char>
+static Local<String> BuildHeaders(const FunctionCallbackInfo<Value>& args) {
+  Local<Value> first_line = args[0];
+  Local<Value> headers = args[2];
+  uint32_t flags = args[3]->Uint32Value();
+  uint32_t sent = 0;
+  HeaderWriter<Char> w;
+
+  if (first_line->IsString()) {
+    if (!w.Append(first_line.As<String>()))
+      return Local<String>();
+  } else {
+    Local<String> reason = args[1]->ToString();
+    if (reason.IsEmpty() || !AppendStatusLine(&w, first_line, reason))
+      return Local<String>();
+  }
+
+  if (headers->IsArray()) {
+    Local<Array> pairs = headers.As<Array>();
+    for (uint32_t i = 0, n = pairs->Length(); i < n; i++) {
+      Local<Value> pair = pairs->Get(i);
+      if (!pair->IsObject())
+        continue;
+      Local<String> field = pair.As<Object>()->Get(0)->ToString();
+      if (field.IsEmpty())
+        return Local<String>();
+      Local<Value> value = pair.As<Object>()->Get(1);
+      if (!AppendHeader(&w, field, value, &flags, &sent))
+        return Local<String>();
+    }
+  } else if (headers->IsObject()) {
+    Local<Object> obj = headers.As<Object>();
+    Local<Array> keys = obj->GetOwnPropertyNames();
+    for (uint32_t i = 0, n = keys->Length(); i < n; i++) {
+      Local<String> field = keys->Get(i)->ToString();
+      if (!AppendHeader(&w, field, obj->Get(field), &flags, &sent))
+        return Local<String>();
+    }
+  }
+
+  if ((flags & kSendDate) && !(sent & kDateHeader)) {
+    UpdateDateHeader();
+    w.Append(date_header, date_header_length);
+  }
+
+  // RFC 2616 says 204 and 304 responses MUST NOT have a body. Don't send a
+  // zero chunk that might confuse proxies, close the connection instead.
+  if ((flags & kNoBodyStatus) && (flags & kChunkedEncoding)) {
+    flags &= ~(kChunkedEncoding | kShouldKeepAlive);
+    flags |= kForcedClose;
+  }
+
+  if (flags & kRemovedConnection) {
+    flags |= kLast;
+    flags &= ~kShouldKeepAlive;
+  } else if (!(sent & kConnectionHeader)) {
+    bool keep_alive = (flags & kShouldKeepAlive) &&
+                      ((sent & kContentLengthHeader) ||
+                       (flags & kUseChunkedEncodingByDefault) ||
+                       (flags & kHasAgent));
+    if (keep_alive) {
+      static const char s[] = "Connection: keep-alive\r\n";
+      w.Append(s, sizeof(s) - 1);
+    } else {
+      static const char s[] = "Connection: close\r\n";
+      w.Append(s, sizeof(s) - 1);
+      flags |= kLast;
+    }
+  }
+
+  if (!(sent & (kContentLengthHeader | kTransferEncodingHeader))) {
+    if ((flags & kHasBody) && !(flags & kRemovedTransferEncoding)) {
+      if (flags & kUseChunkedEncodingByDefault) {
+        static const char s[] = "Transfer-Encoding: chunked\r\n";
+        w.Append(s, sizeof(s) - 1);
+        flags |= kChunkedEncoding;
+      } else {
+        flags |= kLast;
+      }
+    } else {
+      // Make sure we don't end the 0\r\n\r\n at the end of the message.
+      flags &= ~kChunkedEncoding;
+    }
+  }
+
+  w.Append("\r\n", 2);
+
+  outgoing_state[0] = flags;
+  return w.ToString();
+}
+
+
+// serializeHeaders(firstLine, reason, headers, flags)
+//
+// firstLine is either the request line, CRLF included, or a status code, in
+// which case reason is its reason phrase. headers is an object or an array
+// of [field, value] pairs.
+static void SerializeHeaders(const FunctionCallbackInfo<Value>& args) {
+  HandleScope scope(node_isolate);
+  v8::TryCatch try_catch;
+
+  Local<String> result = BuildHeaders<uint8_t>(args);
+  if (result.IsEmpty()) {
+    if (try_catch.HasCaught()) {
+      try_catch.ReThrow();
+      return;
+    }
+    result = BuildHeaders<uint16_t>(args);
+  }
+
+  args.GetReturnValue().Set(result);
+}
+
+
 void InitHttpParser(Handle<Object> target) {
   HandleScope scope(node_isolate);
 
@@ -566,14 +1564,43 @@ void InitHttpParser(Handle<Object> target) {
          Integer::NewFromUnsigned(kOnBody, node_isolate));
   t->Set(FIXED_ONE_BYTE_STRING(node_isolate, "kOnMessageComplete"),
          Integer::NewFromUnsigned(kOnMessageComplete, node_isolate));
+  t->Set(FIXED_ONE_BYTE_STRING(node_isolate, "kOnExecute"),
+         Integer::NewFromUnsigned(kOnExecute, node_isolate));
 
   NODE_SET_PROTOTYPE_METHOD(t, "execute", Parser::Execute);
   NODE_SET_PROTOTYPE_METHOD(t, "finish", Parser::Finish);
   NODE_SET_PROTOTYPE_METHOD(t, "reinitialize", Parser::Reinitialize);
+  NODE_SET_PROTOTYPE_METHOD(t, "consume", Parser::Consume);
+  NODE_SET_PROTOTYPE_METHOD(t, "unconsume", Parser::Unconsume);
 
   target->Set(FIXED_ONE_BYTE_STRING(node_isolate, "HTTPParser"),
               t->GetFunction());
 
+  NODE_SET_METHOD(target, "serializeHeaders", SerializeHeaders);
+
+  Local<Object> state = Object::New();
+  state->SetIndexedPropertiesToExternalArrayData(outgoing_state,
+                                                 v8::kExternalUnsignedIntArray,
+                                                 ARRAY_SIZE(outgoing_state));
+  target->Set(FIXED_ONE_BYTE_STRING(node_isolate, "outgoingState"), state);
+
+#define V(name)                                                               \
+  target->Set(FIXED_ONE_BYTE_STRING(node_isolate, #name),                     \
+              Integer::NewFromUnsigned(name, node_isolate));
+  V(kSendDate)
+  V(kShouldKeepAlive)
+  V(kChunkedEncoding)
+  V(kUseChunkedEncodingByDefault)
+  V(kHasAgent)
+  V(kRemovedConnection)
+  V(kRemovedTransferEncoding)
+  V(kHasBody)
+  V(kNoBodyStatus)
+  V(kLast)
+  V(kSentExpect)
+  V(kForcedClose)
+#undef V
+
 #define X(num, name, string)                                                  \
   name ## _sym = OneByteString(node_isolate, #string);
   HTTP_METHOD_MAP(X)
@@ -589,7 +1616,11 @@ void InitHttpParser(Handle<Object> target) {
       FIXED_ONE_BYTE_STRING(node_isolate, "shouldKeepAlive");
   upgrade_sym = FIXED_ONE_BYTE_STRING(node_isolate, "upgrade");
   headers_sym = FIXED_ONE_BYTE_STRING(node_isolate, "headers");
+  headers_object_sym = FIXED_ONE_BYTE_STRING(node_isolate, "headersObject");
   url_sym = FIXED_ONE_BYTE_STRING(node_isolate, "url");
+  comma_sym = FIXED_ONE_BYTE_STRING(node_isolate, ", ");
+
+  InitKnownHeaders();
 
   settings.on_message_begin    = Parser::on_message_begin;
   settings.on_url              = Parser::on_url;
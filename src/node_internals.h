@@ -213,6 +213,11 @@ inline static void ThrowUVException(int errorno,
 
 NO_RETURN void FatalError(const char* location, const char* message);
 
+// Copies the loop's cached time to where lib/timers.js reads it, instead of
+// calling Timer.now(). Anything that calls into JS straight off the event
+// loop must call this first, MakeCallback() does. See timer_wrap.cc.
+void UpdateLoopTime();
+
 #define NODE_WRAP(Object, Pointer)                                             \
   do {                                                                         \
     assert(!Object.IsEmpty());                                                 \
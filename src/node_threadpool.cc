@@ -0,0 +1,193 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "node_threadpool.h"
+#include "node.h"
+#include "node_internals.h"
+
+#if defined HAVE_DTRACE || defined HAVE_ETW || defined HAVE_SYSTEMTAP
+#include "node_dtrace.h"
+#endif
+
+#include "uv.h"
+#include "v8.h"
+
+#include <string.h>
+
+namespace node {
+namespace threadpool {
+
+using v8::Array;
+using v8::FunctionCallbackInfo;
+using v8::Handle;
+using v8::HandleScope;
+using v8::Local;
+using v8::Number;
+using v8::Object;
+using v8::String;
+using v8::Value;
+
+// Histogram buckets are powers of two in microseconds: bucket 0 counts
+// requests that took less than 1 us, bucket n those that took 2^(n-1) us up
+// to 2^n us. The last bucket counts everything beyond that.
+static const unsigned int kHistogramBuckets = 32;
+static const unsigned int kMaxWorkTypes = 64;
+
+struct WorkStats {
+  const char* category;
+  const char* name;
+  double count;
+  double wait_time;  // In microseconds.
+  double run_time;   // In microseconds.
+  double wait[kHistogramBuckets];
+  double run[kHistogramBuckets];
+};
+
+static WorkStats stats[kMaxWorkTypes];
+static unsigned int stats_count;
+
+
+static unsigned int Bucket(uint64_t us) {
+  unsigned int bucket = 0;
+  while (us > 0 && bucket < kHistogramBuckets - 1) {
+    us >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+
+static WorkStats* Lookup(const char* category, const char* name) {
+  for (unsigned int i = 0; i < stats_count; i++) {
+    WorkStats* s = &stats[i];
+    if ((s->category == category || strcmp(s->category, category) == 0) &&
+        (s->name == name || strcmp(s->name, name) == 0)) {
+      return s;
+    }
+  }
+
+  if (stats_count == ARRAY_SIZE(stats))
+    return NULL;
+
+  WorkStats* s = &stats[stats_count++];
+  memset(s, 0, sizeof(*s));
+  s->category = category;
+  s->name = name;
+  return s;
+}
+
+
+void RecordWork(const char* category, const char* name, uv_req_t* req) {
+  uv_work_times_t times;
+
+  // Not supported on this platform, or the request was cancelled.
+  if (uv_work_times(req, &times) != 0 || times.started == 0)
+    return;
+
+  uint64_t wait = times.started - times.queued;
+  uint64_t run = times.finished - times.started;
+
+#if defined HAVE_DTRACE || defined HAVE_ETW || defined HAVE_SYSTEMTAP
+  TraceThreadpoolWork(category, name, wait, run);
+#endif
+
+  WorkStats* s = Lookup(category, name);
+  if (s == NULL)
+    return;
+
+  s->count++;
+  s->wait_time += wait / 1000;
+  s->run_time += run / 1000;
+  s->wait[Bucket(wait / 1000)]++;
+  s->run[Bucket(run / 1000)]++;
+}
+
+
+static Local<Array> HistogramToArray(const double* histogram) {
+  Local<Array> array = Array::New(kHistogramBuckets);
+  for (unsigned int i = 0; i < kHistogramBuckets; i++)
+    array->Set(i, Number::New(histogram[i]));
+  return array;
+}
+
+
+// getStats() returns the number of queued requests per work class and, per
+// category and name, the request count, total wait and run times and their
+// histograms.
+static void GetStats(const FunctionCallbackInfo<Value>& args) {
+  HandleScope scope(node_isolate);
+
+  Local<Object> queued = Object::New();
+  queued->Set(FIXED_ONE_BYTE_STRING(node_isolate, "io"),
+              Number::New(uv_threadpool_queue_length(UV_WORK_IO)));
+  queued->Set(FIXED_ONE_BYTE_STRING(node_isolate, "cpu"),
+              Number::New(uv_threadpool_queue_length(UV_WORK_CPU)));
+  queued->Set(FIXED_ONE_BYTE_STRING(node_isolate, "dns"),
+              Number::New(uv_threadpool_queue_length(UV_WORK_DNS)));
+
+  Local<Object> work = Object::New();
+  for (unsigned int i = 0; i < stats_count; i++) {
+    const WorkStats* s = &stats[i];
+
+    Local<String> category = OneByteString(node_isolate, s->category);
+    Local<Value> names = work->Get(category);
+    if (!names->IsObject()) {
+      names = Object::New();
+      work->Set(category, names);
+    }
+
+    Local<Object> entry = Object::New();
+    entry->Set(FIXED_ONE_BYTE_STRING(node_isolate, "count"),
+               Number::New(s->count));
+    entry->Set(FIXED_ONE_BYTE_STRING(node_isolate, "waitTime"),
+               Number::New(s->wait_time));
+    entry->Set(FIXED_ONE_BYTE_STRING(node_isolate, "runTime"),
+               Number::New(s->run_time));
+    entry->Set(FIXED_ONE_BYTE_STRING(node_isolate, "wait"),
+               HistogramToArray(s->wait));
+    entry->Set(FIXED_ONE_BYTE_STRING(node_isolate, "run"),
+               HistogramToArray(s->run));
+    names.As<Object>()->Set(OneByteString(node_isolate, s->name), entry);
+  }
+
+  Local<Object> result = Object::New();
+  result->Set(FIXED_ONE_BYTE_STRING(node_isolate, "queued"), queued);
+  result->Set(FIXED_ONE_BYTE_STRING(node_isolate, "work"), work);
+  args.GetReturnValue().Set(result);
+}
+
+
+static void ResetStats(const FunctionCallbackInfo<Value>& args) {
+  stats_count = 0;
+}
+
+
+void Initialize(Handle<Object> target) {
+  HandleScope scope(node_isolate);
+
+  NODE_SET_METHOD(target, "getStats", GetStats);
+  NODE_SET_METHOD(target, "resetStats", ResetStats);
+}
+
+}  // namespace threadpool
+}  // namespace node
+
+NODE_MODULE(node_threadpool, node::threadpool::Initialize)
@@ -21,6 +21,9 @@
 
 #include "node.h"
 #include "node_buffer.h"
+#include "node_threadpool.h"
+#include "node_zlib.h"
+#include "req_wrap.h"
 #include "v8.h"
 #include "zlib.h"
 
@@ -31,6 +34,7 @@
 
 namespace node {
 
+using v8::Function;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::Handle;
@@ -40,9 +44,11 @@ using v8::Local;
 using v8::Number;
 using v8::Object;
 using v8::String;
+using v8::Undefined;
 using v8::Value;
 
 static Cached<String> callback_sym;
+static Cached<String> oncomplete_sym;
 static Cached<String> onerror_sym;
 
 enum node_zlib_mode {
@@ -56,10 +62,168 @@ enum node_zlib_mode {
   UNZIP
 };
 
+static const char* const mode_names[] = {
+  "none",
+  "deflate",
+  "inflate",
+  "gzip",
+  "gunzip",
+  "deflateRaw",
+  "inflateRaw",
+  "unzip"
+};
+
 
 void InitZlib(v8::Handle<v8::Object> target);
 
 
+/**
+ * Memory accounting. zlib allocates through these hooks, both on the main
+ * thread and on the thread pool: inflate() sets up its window on first use
+ * and parallel deflate blocks are initialized on the thread pool.
+ */
+struct AllocHeader {
+  union {
+    size_t size;
+    double align_;
+  };
+};
+
+static uv_once_t alloc_once = UV_ONCE_INIT;
+static uv_mutex_t alloc_mutex;
+static size_t allocated_bytes;
+static size_t reported_bytes;  // what V8 has been told, main thread only
+
+
+static void InitAllocMutex() {
+  if (uv_mutex_init(&alloc_mutex))
+    abort();
+}
+
+
+static void AdjustAllocatedBytes(size_t size, bool allocated) {
+  uv_once(&alloc_once, InitAllocMutex);
+  uv_mutex_lock(&alloc_mutex);
+  if (allocated)
+    allocated_bytes += size;
+  else
+    allocated_bytes -= size;
+  uv_mutex_unlock(&alloc_mutex);
+}
+
+
+static voidpf AllocForZlib(voidpf opaque, uInt items, uInt size) {
+  size_t length = static_cast<size_t>(items) * size;
+  AllocHeader* header =
+      static_cast<AllocHeader*>(malloc(sizeof(*header) + length));
+  if (header == NULL)
+    return Z_NULL;
+  header->size = length;
+  AdjustAllocatedBytes(length, true);
+  return header + 1;
+}
+
+
+static void FreeForZlib(voidpf opaque, voidpf address) {
+  AllocHeader* header = static_cast<AllocHeader*>(address) - 1;
+  AdjustAllocatedBytes(header->size, false);
+  free(header);
+}
+
+
+size_t zlib::AllocatedBytes() {
+  uv_once(&alloc_once, InitAllocMutex);
+  uv_mutex_lock(&alloc_mutex);
+  size_t bytes = allocated_bytes;
+  uv_mutex_unlock(&alloc_mutex);
+  return bytes;
+}
+
+
+// Let V8 know how much memory zlib holds on to, so that the GC can take
+// into account that a collected stream frees a lot more than its handle.
+static void ReportAllocatedBytes() {
+  size_t bytes = zlib::AllocatedBytes();
+  intptr_t change = static_cast<intptr_t>(bytes - reported_bytes);
+  if (change != 0)
+    node_isolate->AdjustAmountOfExternalAllocatedMemory(change);
+  reported_bytes = bytes;
+}
+
+
+/**
+ * Idle z_streams. A closed stream is reset and kept for reuse by the next
+ * stream that is initialized with the same parameters, instead of freeing
+ * its state only to allocate an identical one again. Main thread only.
+ */
+struct PooledStream {
+  z_stream strm;
+  node_zlib_mode mode;
+  int level;
+  int windowBits;
+  int memLevel;
+  int strategy;
+  PooledStream* next;
+};
+
+static const size_t kMaxPoolSize = 32;
+static PooledStream* pool;
+static size_t pool_size;
+
+
+static z_stream* GetPooledStream(node_zlib_mode mode,
+                                 int level,
+                                 int windowBits,
+                                 int memLevel,
+                                 int strategy) {
+  PooledStream** prev = &pool;
+  for (PooledStream* entry = pool; entry != NULL; entry = entry->next) {
+    if (entry->mode == mode &&
+        entry->level == level &&
+        entry->windowBits == windowBits &&
+        entry->memLevel == memLevel &&
+        entry->strategy == strategy) {
+      *prev = entry->next;
+      pool_size--;
+      return &entry->strm;
+    }
+    prev = &entry->next;
+  }
+  return NULL;
+}
+
+
+// Returns false when the stream can't be reused, the caller ends it then.
+static bool ReleasePooledStream(z_stream* strm,
+                                node_zlib_mode mode,
+                                int level,
+                                int windowBits,
+                                int memLevel,
+                                int strategy) {
+  if (pool_size == kMaxPoolSize)
+    return false;
+
+  int err;
+  if (mode == DEFLATE || mode == GZIP || mode == DEFLATERAW)
+    err = deflateReset(strm);
+  else
+    err = inflateReset(strm);
+  if (err != Z_OK)
+    return false;
+
+  PooledStream* entry = container_of(strm, PooledStream, strm);
+  entry->mode = mode;
+  entry->level = level;
+  entry->windowBits = windowBits;
+  entry->memLevel = memLevel;
+  entry->strategy = strategy;
+  entry->next = pool;
+  pool = entry;
+  pool_size++;
+  return true;
+}
+
+
 /**
  * Deflate/Inflate
  */
@@ -68,6 +232,8 @@ class ZCtx : public ObjectWrap {
 
   explicit ZCtx(node_zlib_mode mode) : ObjectWrap(),
                                        init_done_(false),
+                                       strm_(NULL),
+                                       init_err_(Z_OK),
                                        level_(0),
                                        windowBits_(0),
                                        memLevel_(0),
@@ -78,7 +244,9 @@ class ZCtx : public ObjectWrap {
                                        flush_(0),
                                        chunk_size_(0),
                                        write_in_progress_(false),
+                                       write_async_(false),
                                        mode_(mode) {
+    write_result_[0] = write_result_[1] = 0;
   }
 
 
@@ -92,13 +260,23 @@ class ZCtx : public ObjectWrap {
     assert(init_done_ && "close before init");
     assert(mode_ <= UNZIP);
 
-    if (mode_ == DEFLATE || mode_ == GZIP || mode_ == DEFLATERAW) {
-      (void)deflateEnd(&strm_);
-      node_isolate->AdjustAmountOfExternalAllocatedMemory(-kDeflateContextSize);
-    } else if (mode_ == INFLATE || mode_ == GUNZIP || mode_ == INFLATERAW ||
-               mode_ == UNZIP) {
-      (void)inflateEnd(&strm_);
-      node_isolate->AdjustAmountOfExternalAllocatedMemory(-kInflateContextSize);
+    if (mode_ != NONE) {
+      bool pooled = init_err_ == Z_OK &&
+                    ReleasePooledStream(strm_,
+                                        mode_,
+                                        level_,
+                                        windowBits_,
+                                        memLevel_,
+                                        strategy_);
+      if (!pooled) {
+        if (mode_ == DEFLATE || mode_ == GZIP || mode_ == DEFLATERAW)
+          (void)deflateEnd(strm_);
+        else
+          (void)inflateEnd(strm_);
+        delete container_of(strm_, PooledStream, strm);
+      }
+      strm_ = NULL;
+      ReportAllocatedBytes();
     }
     mode_ = NONE;
 
@@ -117,6 +295,11 @@ class ZCtx : public ObjectWrap {
 
 
   // write(flush, in, in_off, in_len, out, out_off, out_len)
+  // writeSync(flush, in, in_off, in_len, out, out_off, out_len)
+  //
+  // The synchronous version doesn't go to the thread pool, it leaves
+  // avail_in and avail_out in this[0] and this[1].
+  template <bool async>
   static void Write(const FunctionCallbackInfo<Value>& args) {
     HandleScope scope(node_isolate);
     assert(args.Length() == 7);
@@ -127,7 +310,7 @@ class ZCtx : public ObjectWrap {
 
     assert(!ctx->write_in_progress_ && "write already in progress");
     ctx->write_in_progress_ = true;
-    ctx->Ref();
+    ctx->write_async_ = async;
 
     assert(!args[0]->IsUndefined() && "must provide flush value");
 
@@ -173,15 +356,27 @@ class ZCtx : public ObjectWrap {
     // build up the work request
     uv_work_t* work_req = &(ctx->work_req_);
 
-    ctx->strm_.avail_in = in_len;
-    ctx->strm_.next_in = in;
-    ctx->strm_.avail_out = out_len;
-    ctx->strm_.next_out = out;
+    ctx->strm_->avail_in = in_len;
+    ctx->strm_->next_in = in;
+    ctx->strm_->avail_out = out_len;
+    ctx->strm_->next_out = out;
     ctx->flush_ = flush;
 
     // set this so that later on, I can easily tell how much was written.
     ctx->chunk_size_ = out_len;
 
+    if (!async) {
+      Process(work_req);
+      ReportAllocatedBytes();
+      if (CheckError(ctx)) {
+        ctx->write_result_[0] = ctx->strm_->avail_in;
+        ctx->write_result_[1] = ctx->strm_->avail_out;
+        ctx->write_in_progress_ = false;
+      }
+      return;
+    }
+
+    ctx->Ref();
     uv_queue_work(uv_default_loop(),
                   work_req,
                   ZCtx::Process,
@@ -205,23 +400,23 @@ class ZCtx : public ObjectWrap {
       case DEFLATE:
       case GZIP:
       case DEFLATERAW:
-        ctx->err_ = deflate(&ctx->strm_, ctx->flush_);
+        ctx->err_ = deflate(ctx->strm_, ctx->flush_);
         break;
       case UNZIP:
       case INFLATE:
       case GUNZIP:
       case INFLATERAW:
-        ctx->err_ = inflate(&ctx->strm_, ctx->flush_);
+        ctx->err_ = inflate(ctx->strm_, ctx->flush_);
 
         // If data was encoded with dictionary
         if (ctx->err_ == Z_NEED_DICT && ctx->dictionary_ != NULL) {
           // Load it
-          ctx->err_ = inflateSetDictionary(&ctx->strm_,
+          ctx->err_ = inflateSetDictionary(ctx->strm_,
                                            ctx->dictionary_,
                                            ctx->dictionary_len_);
           if (ctx->err_ == Z_OK) {
             // And try to decode again
-            ctx->err_ = inflate(&ctx->strm_, ctx->flush_);
+            ctx->err_ = inflate(ctx->strm_, ctx->flush_);
           } else if (ctx->err_ == Z_DATA_ERROR) {
             // Both inflateSetDictionary() and inflate() return Z_DATA_ERROR.
             // Make it possible for After() to tell a bad dictionary from bad
@@ -247,45 +442,58 @@ class ZCtx : public ObjectWrap {
 
     HandleScope scope(node_isolate);
     ZCtx *ctx = container_of(work_req, ZCtx, work_req_);
+    threadpool::RecordWork("zlib",
+                           mode_names[ctx->mode_],
+                           reinterpret_cast<uv_req_t*>(work_req));
+
+    ReportAllocatedBytes();
+
+    if (!CheckError(ctx))
+      return;
+
+    Local<Integer> avail_out = Integer::New(ctx->strm_->avail_out,
+                                            node_isolate);
+    Local<Integer> avail_in = Integer::New(ctx->strm_->avail_in, node_isolate);
+
+    ctx->write_in_progress_ = false;
+
+    // call the write() cb
+    Local<Object> handle = ctx->handle(node_isolate);
+    assert(handle->Get(callback_sym)->IsFunction() && "Invalid callback");
+    Local<Value> args[2] = { avail_in, avail_out };
+    MakeCallback(handle, callback_sym, ARRAY_SIZE(args), args);
+
+    ctx->Unref();
+  }
 
+  // Reports the error and returns false if the last deflate() or inflate()
+  // failed.
+  static bool CheckError(ZCtx* ctx) {
     // Acceptable error states depend on the type of zlib stream.
     switch (ctx->err_) {
       case Z_OK:
       case Z_STREAM_END:
       case Z_BUF_ERROR:
         // normal statuses, not fatal
-        break;
+        return true;
       case Z_NEED_DICT:
         if (ctx->dictionary_ == NULL) {
           ZCtx::Error(ctx, "Missing dictionary");
         } else {
           ZCtx::Error(ctx, "Bad dictionary");
         }
-        return;
+        return false;
       default:
         // something else.
         ZCtx::Error(ctx, "Zlib error");
-        return;
+        return false;
     }
-
-    Local<Integer> avail_out = Integer::New(ctx->strm_.avail_out, node_isolate);
-    Local<Integer> avail_in = Integer::New(ctx->strm_.avail_in, node_isolate);
-
-    ctx->write_in_progress_ = false;
-
-    // call the write() cb
-    Local<Object> handle = ctx->handle(node_isolate);
-    assert(handle->Get(callback_sym)->IsFunction() && "Invalid callback");
-    Local<Value> args[2] = { avail_in, avail_out };
-    MakeCallback(handle, callback_sym, ARRAY_SIZE(args), args);
-
-    ctx->Unref();
   }
 
   static void Error(ZCtx *ctx, const char *msg_) {
     const char *msg;
-    if (ctx->strm_.msg != NULL) {
-      msg = ctx->strm_.msg;
+    if (ctx->strm_->msg != NULL) {
+      msg = ctx->strm_->msg;
     } else {
       msg = msg_;
     }
@@ -297,6 +505,16 @@ class ZCtx : public ObjectWrap {
       OneByteString(node_isolate, msg),
       Number::New(ctx->err_)
     };
+
+    if (ctx->write_in_progress_ && !ctx->write_async_) {
+      // writeSync() was called from JS land, don't run the tick queue
+      // from under it.
+      ctx->write_in_progress_ = false;
+      Local<Function> onerror = handle->Get(onerror_sym).As<Function>();
+      onerror->Call(handle, ARRAY_SIZE(args), args);
+      return;
+    }
+
     MakeCallback(handle, onerror_sym, ARRAY_SIZE(args), args);
 
     // no hope of rescue.
@@ -317,6 +535,10 @@ class ZCtx : public ObjectWrap {
 
     ZCtx *ctx = new ZCtx(mode);
     ctx->Wrap(args.This());
+    args.This()->SetIndexedPropertiesToExternalArrayData(
+        ctx->write_result_,
+        v8::kExternalUnsignedIntArray,
+        ARRAY_SIZE(ctx->write_result_));
   }
 
   // just pull the ints out of the args and call the other Init
@@ -386,10 +608,6 @@ class ZCtx : public ObjectWrap {
     ctx->memLevel_ = memLevel;
     ctx->strategy_ = strategy;
 
-    ctx->strm_.zalloc = Z_NULL;
-    ctx->strm_.zfree = Z_NULL;
-    ctx->strm_.opaque = Z_NULL;
-
     ctx->flush_ = Z_NO_FLUSH;
 
     ctx->err_ = Z_OK;
@@ -406,31 +624,43 @@ class ZCtx : public ObjectWrap {
       ctx->windowBits_ *= -1;
     }
 
-    switch (ctx->mode_) {
-      case DEFLATE:
-      case GZIP:
-      case DEFLATERAW:
-        ctx->err_ = deflateInit2(&ctx->strm_,
+    ctx->strm_ = GetPooledStream(ctx->mode_,
                                  ctx->level_,
-                                 Z_DEFLATED,
                                  ctx->windowBits_,
                                  ctx->memLevel_,
                                  ctx->strategy_);
-        node_isolate->
-                    AdjustAmountOfExternalAllocatedMemory(kDeflateContextSize);
-        break;
-      case INFLATE:
-      case GUNZIP:
-      case INFLATERAW:
-      case UNZIP:
-        ctx->err_ = inflateInit2(&ctx->strm_, ctx->windowBits_);
-        node_isolate->
-                    AdjustAmountOfExternalAllocatedMemory(kInflateContextSize);
-        break;
-      default:
-        assert(0 && "wtf?");
+    if (ctx->strm_ == NULL) {
+      PooledStream* entry = new PooledStream;
+      memset(entry, 0, sizeof(*entry));
+      ctx->strm_ = &entry->strm;
+      ctx->strm_->zalloc = AllocForZlib;
+      ctx->strm_->zfree = FreeForZlib;
+      ctx->strm_->opaque = Z_NULL;
+
+      switch (ctx->mode_) {
+        case DEFLATE:
+        case GZIP:
+        case DEFLATERAW:
+          ctx->err_ = deflateInit2(ctx->strm_,
+                                   ctx->level_,
+                                   Z_DEFLATED,
+                                   ctx->windowBits_,
+                                   ctx->memLevel_,
+                                   ctx->strategy_);
+          break;
+        case INFLATE:
+        case GUNZIP:
+        case INFLATERAW:
+        case UNZIP:
+          ctx->err_ = inflateInit2(ctx->strm_, ctx->windowBits_);
+          break;
+        default:
+          assert(0 && "wtf?");
+      }
+      ReportAllocatedBytes();
     }
 
+    ctx->init_err_ = ctx->err_;
     if (ctx->err_ != Z_OK) {
       ZCtx::Error(ctx, "Init error");
     }
@@ -451,7 +681,7 @@ class ZCtx : public ObjectWrap {
     switch (ctx->mode_) {
       case DEFLATE:
       case DEFLATERAW:
-        ctx->err_ = deflateSetDictionary(&ctx->strm_,
+        ctx->err_ = deflateSetDictionary(ctx->strm_,
                                          ctx->dictionary_,
                                          ctx->dictionary_len_);
         break;
@@ -470,7 +700,11 @@ class ZCtx : public ObjectWrap {
     switch (ctx->mode_) {
       case DEFLATE:
       case DEFLATERAW:
-        ctx->err_ = deflateParams(&ctx->strm_, level, strategy);
+        ctx->err_ = deflateParams(ctx->strm_, level, strategy);
+        if (ctx->err_ == Z_OK) {
+          ctx->level_ = level;
+          ctx->strategy_ = strategy;
+        }
         break;
       default:
         break;
@@ -487,11 +721,11 @@ class ZCtx : public ObjectWrap {
     switch (ctx->mode_) {
       case DEFLATE:
       case DEFLATERAW:
-        ctx->err_ = deflateReset(&ctx->strm_);
+        ctx->err_ = deflateReset(ctx->strm_);
         break;
       case INFLATE:
       case INFLATERAW:
-        ctx->err_ = inflateReset(&ctx->strm_);
+        ctx->err_ = inflateReset(ctx->strm_);
         break;
       default:
         break;
@@ -503,12 +737,10 @@ class ZCtx : public ObjectWrap {
   }
 
  private:
-  static const int kDeflateContextSize = 16384;  // approximate
-  static const int kInflateContextSize = 10240;  // approximate
-
   bool init_done_;
 
-  z_stream strm_;
+  z_stream* strm_;  // owned by a PooledStream
+  int init_err_;
   int level_;
   int windowBits_;
   int memLevel_;
@@ -524,12 +756,198 @@ class ZCtx : public ObjectWrap {
   int chunk_size_;
 
   bool write_in_progress_;
+  bool write_async_;
+  uint32_t write_result_[2];
 
   uv_work_t work_req_;
   node_zlib_mode mode_;
 };
 
 
+/**
+ * One block of a parallel deflate. The block is compressed on its own with
+ * the window before it as the dictionary, and ends on a byte boundary so
+ * that the raw deflate output of consecutive blocks can be concatenated.
+ */
+class DeflateBlock : public ReqWrap<uv_work_t> {
+ public:
+  DeflateBlock(Local<Object> object,
+               Bytef* in,
+               size_t in_len,
+               Bytef* dictionary,
+               size_t dictionary_len,
+               int level,
+               int windowBits,
+               int memLevel,
+               int strategy,
+               bool last)
+      : ReqWrap<uv_work_t>(object),
+        in_(in),
+        in_len_(in_len),
+        dictionary_(dictionary),
+        dictionary_len_(dictionary_len),
+        level_(level),
+        windowBits_(windowBits),
+        memLevel_(memLevel),
+        strategy_(strategy),
+        last_(last),
+        err_(Z_OK),
+        out_(NULL),
+        out_len_(0),
+        crc_(0) {
+  }
+
+  ~DeflateBlock() {
+    free(out_);
+  }
+
+  // deflateBlock(in, dictionary, level, windowBits, memLevel, strategy,
+  //              last, req)
+  //
+  // Calls req.oncomplete(errno, out, crc32) when done.
+  static void New(const FunctionCallbackInfo<Value>& args) {
+    HandleScope scope(node_isolate);
+    assert(args.Length() == 8);
+    assert(Buffer::HasInstance(args[0]));
+    assert(args[7]->IsObject());
+
+    Local<Object> in = args[0].As<Object>();
+    Bytef* dictionary = NULL;
+    size_t dictionary_len = 0;
+    if (Buffer::HasInstance(args[1])) {
+      dictionary = reinterpret_cast<Bytef*>(Buffer::Data(args[1]));
+      dictionary_len = Buffer::Length(args[1]);
+    }
+
+    // The caller keeps the input and the dictionary alive through req.
+    DeflateBlock* block =
+        new DeflateBlock(args[7].As<Object>(),
+                         reinterpret_cast<Bytef*>(Buffer::Data(in)),
+                         Buffer::Length(in),
+                         dictionary,
+                         dictionary_len,
+                         args[2]->Int32Value(),
+                         args[3]->Int32Value(),
+                         args[4]->Int32Value(),
+                         args[5]->Int32Value(),
+                         args[6]->IsTrue());
+    uv_queue_work(uv_default_loop(),
+                  &block->req_,
+                  DeflateBlock::Process,
+                  DeflateBlock::After);
+    block->Dispatched();
+  }
+
+  // crc32Combine(crc1, crc2, len2)
+  static void Crc32Combine(const FunctionCallbackInfo<Value>& args) {
+    HandleScope scope(node_isolate);
+    uLong crc = crc32_combine(args[0]->Uint32Value(),
+                              args[1]->Uint32Value(),
+                              args[2]->IntegerValue());
+    args.GetReturnValue().Set(static_cast<uint32_t>(crc));
+  }
+
+ private:
+  static void Process(uv_work_t* req) {
+    DeflateBlock* block = container_of(req, DeflateBlock, req_);
+    z_stream strm;
+
+    memset(&strm, 0, sizeof(strm));
+    strm.zalloc = AllocForZlib;
+    strm.zfree = FreeForZlib;
+    block->crc_ = crc32(crc32(0, Z_NULL, 0), block->in_, block->in_len_);
+
+    block->err_ = deflateInit2(&strm,
+                               block->level_,
+                               Z_DEFLATED,
+                               -block->windowBits_,
+                               block->memLevel_,
+                               block->strategy_);
+    if (block->err_ != Z_OK)
+      return;
+
+    if (block->dictionary_ != NULL) {
+      block->err_ = deflateSetDictionary(&strm,
+                                         block->dictionary_,
+                                         block->dictionary_len_);
+    }
+
+    // Z_SYNC_FLUSH ends on a byte boundary without marking the last block,
+    // the final block of the stream gets Z_FINISH instead.
+    int flush = block->last_ ? Z_FINISH : Z_SYNC_FLUSH;
+    size_t size = deflateBound(&strm, block->in_len_) + 16;
+
+    strm.next_in = block->in_;
+    strm.avail_in = block->in_len_;
+
+    while (block->err_ == Z_OK) {
+      if (block->out_len_ == size || block->out_ == NULL) {
+        if (block->out_ != NULL)
+          size *= 2;
+        Bytef* out = static_cast<Bytef*>(realloc(block->out_, size));
+        if (out == NULL) {
+          block->err_ = Z_MEM_ERROR;
+          break;
+        }
+        block->out_ = out;
+      }
+      strm.next_out = block->out_ + block->out_len_;
+      strm.avail_out = size - block->out_len_;
+      block->err_ = deflate(&strm, flush);
+      block->out_len_ = size - strm.avail_out;
+      if (strm.avail_out != 0)
+        break;
+    }
+
+    if (block->err_ == Z_STREAM_END)
+      block->err_ = Z_OK;
+
+    (void)deflateEnd(&strm);
+  }
+
+  static void After(uv_work_t* req, int status) {
+    assert(status == 0);
+
+    HandleScope scope(node_isolate);
+    DeflateBlock* block = container_of(req, DeflateBlock, req_);
+    threadpool::RecordWork("zlib", "deflateBlock",
+                           reinterpret_cast<uv_req_t*>(req));
+
+    Local<Value> args[3] = {
+      Integer::New(block->err_, node_isolate),
+      Undefined(node_isolate),
+      Undefined(node_isolate)
+    };
+
+    if (block->err_ == Z_OK) {
+      // the buffer takes over the output.
+      args[1] = Buffer::Use(reinterpret_cast<char*>(block->out_),
+                            block->out_len_);
+      args[2] = Integer::NewFromUnsigned(block->crc_, node_isolate);
+      block->out_ = NULL;
+    }
+
+    MakeCallback(block->object(), oncomplete_sym, ARRAY_SIZE(args), args);
+    delete block;
+  }
+
+  Bytef* in_;
+  size_t in_len_;
+  Bytef* dictionary_;
+  size_t dictionary_len_;
+  int level_;
+  int windowBits_;
+  int memLevel_;
+  int strategy_;
+  bool last_;
+
+  int err_;
+  Bytef* out_;
+  size_t out_len_;
+  uLong crc_;
+};
+
+
 void InitZlib(Handle<Object> target) {
   HandleScope scope(node_isolate);
 
@@ -537,7 +955,8 @@ void InitZlib(Handle<Object> target) {
 
   z->InstanceTemplate()->SetInternalFieldCount(1);
 
-  NODE_SET_PROTOTYPE_METHOD(z, "write", ZCtx::Write);
+  NODE_SET_PROTOTYPE_METHOD(z, "write", ZCtx::Write<true>);
+  NODE_SET_PROTOTYPE_METHOD(z, "writeSync", ZCtx::Write<false>);
   NODE_SET_PROTOTYPE_METHOD(z, "init", ZCtx::Init);
   NODE_SET_PROTOTYPE_METHOD(z, "close", ZCtx::Close);
   NODE_SET_PROTOTYPE_METHOD(z, "params", ZCtx::Params);
@@ -548,6 +967,10 @@ void InitZlib(Handle<Object> target) {
 
   callback_sym = FIXED_ONE_BYTE_STRING(node_isolate, "callback");
   onerror_sym = FIXED_ONE_BYTE_STRING(node_isolate, "onerror");
+  oncomplete_sym = FIXED_ONE_BYTE_STRING(node_isolate, "oncomplete");
+
+  NODE_SET_METHOD(target, "deflateBlock", DeflateBlock::New);
+  NODE_SET_METHOD(target, "crc32Combine", DeflateBlock::Crc32Combine);
 
   // valid flush values.
   NODE_DEFINE_CONSTANT(target, Z_NO_FLUSH);
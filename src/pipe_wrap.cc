@@ -99,6 +99,7 @@ void PipeWrap::Initialize(Handle<Object> target) {
   NODE_SET_PROTOTYPE_METHOD(t, "readStop", StreamWrap::ReadStop);
   NODE_SET_PROTOTYPE_METHOD(t, "shutdown", StreamWrap::Shutdown);
 
+  NODE_SET_PROTOTYPE_METHOD(t, "writev", StreamWrap::Writev);
   NODE_SET_PROTOTYPE_METHOD(t, "writeBuffer", StreamWrap::WriteBuffer);
   NODE_SET_PROTOTYPE_METHOD(t,
                             "writeAsciiString",
@@ -0,0 +1,154 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "slab_allocator.h"
+#include "node.h"
+#include "node_buffer.h"
+#include "node_internals.h"
+#include "v8.h"
+
+#include <assert.h>
+#include <stdlib.h>  // malloc(), free()
+
+namespace node {
+
+using v8::Local;
+using v8::Object;
+
+size_t SlabAllocator::slab_bytes_;
+
+
+SlabAllocator::SlabAllocator(size_t slab_size)
+    : slab_size_(slab_size),
+      current_(NULL),
+      slab_count_(0),
+      slice_count_(0),
+      copy_count_(0) {
+}
+
+
+SlabAllocator::~SlabAllocator() {
+  if (current_ != NULL)
+    Unref(current_);
+  current_ = NULL;
+}
+
+
+SlabAllocator::Slab* SlabAllocator::NewSlab(size_t size) {
+  Slab* slab = static_cast<Slab*>(malloc(sizeof(*slab) + size));
+  if (slab == NULL)
+    FatalError("node::SlabAllocator::NewSlab(size_t)", "Out Of Memory");
+  slab->size = size;
+  slab->offset = 0;
+  slab->refs = 1;
+  slab_bytes_ += size;
+  node_isolate->AdjustAmountOfExternalAllocatedMemory(
+      static_cast<intptr_t>(size));
+  return slab;
+}
+
+
+void SlabAllocator::Unref(Slab* slab) {
+  assert(slab->refs > 0);
+  if (--slab->refs == 0) {
+    slab_bytes_ -= slab->size;
+    node_isolate->AdjustAmountOfExternalAllocatedMemory(
+        -static_cast<intptr_t>(slab->size));
+    free(slab);
+  }
+}
+
+
+void SlabAllocator::FreeCallback(char* data, void* hint) {
+  // smalloc has just subtracted the slice from the external memory, but it
+  // stays allocated until its slab goes. Undo that, the slab settles it.
+  node_isolate->AdjustAmountOfExternalAllocatedMemory(
+      static_cast<intptr_t>(HeaderOf(data)->length));
+  Unref(static_cast<Slab*>(hint));
+}
+
+
+uv_buf_t SlabAllocator::Allocate(size_t size) {
+  size_t needed = kHeaderSize + ROUND_UP(size, sizeof(Slab*));
+
+  if (current_ == NULL || current_->size - current_->offset < needed) {
+    if (current_ != NULL)
+      Unref(current_);
+    current_ = NewSlab(needed > slab_size_ ? needed : slab_size_);
+    slab_count_++;
+  }
+
+  char* base = Data(current_) + current_->offset;
+  Header* header = reinterpret_cast<Header*>(base);
+  header->slab = current_;
+  header->length = 0;
+  current_->offset += needed;
+  // The reservation keeps the slab alive until it's used or released.
+  current_->refs++;
+
+  return uv_buf_init(base + kHeaderSize, size);
+}
+
+
+// Hand the unused tail of a reservation back, only possible when nothing
+// else has been reserved after it.
+void SlabAllocator::Shrink(Slab* slab, uv_buf_t buf, size_t length) {
+  assert(length <= buf.len);
+  size_t start = buf.base - Data(slab);
+  size_t end = start + ROUND_UP(buf.len, sizeof(Slab*));
+  if (slab->offset != end)
+    return;
+  if (length == 0)
+    slab->offset = start - kHeaderSize;
+  else
+    slab->offset = start + ROUND_UP(length, sizeof(Slab*));
+}
+
+
+Local<Object> SlabAllocator::Use(uv_buf_t buf, size_t length) {
+  if (length < kCopyThreshold) {
+    copy_count_++;
+    Local<Object> copy = Buffer::New(buf.base, length);
+    Release(buf);
+    return copy;
+  }
+
+  Header* header = HeaderOf(buf.base);
+  Shrink(header->slab, buf, length);
+  header->length = length;
+  slice_count_++;
+  // The reservation's reference is transferred to the Buffer. The slab is
+  // already accounted for, so the Buffer's length is taken back out.
+  Local<Object> slice =
+      Buffer::New(buf.base, length, FreeCallback, header->slab);
+  node_isolate->AdjustAmountOfExternalAllocatedMemory(
+      -static_cast<intptr_t>(length));
+  return slice;
+}
+
+
+void SlabAllocator::Release(uv_buf_t buf) {
+  Slab* slab = HeaderOf(buf.base)->slab;
+  Shrink(slab, buf, 0);
+  Unref(slab);
+}
+
+}  // namespace node
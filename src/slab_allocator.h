@@ -0,0 +1,118 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef SRC_SLAB_ALLOCATOR_H_
+#define SRC_SLAB_ALLOCATOR_H_
+
+#include "uv.h"
+#include "v8.h"
+
+#include <stddef.h>  // size_t
+
+namespace node {
+
+// Hands out read buffers carved from large, refcounted slabs instead of
+// malloc'ing a fresh chunk for every read.
+//
+// A call to Allocate() reserves room at the tail of the current slab. The
+// reservation is then either turned into a Buffer with Use(), which gives the
+// unused part of the reservation back to the slab, or returned in full with
+// Release(). Every Buffer holds a reference to its slab; a slab is freed once
+// the allocator has moved on to a new slab and all its Buffers are collected.
+//
+// A small Buffer that is kept around would pin a whole slab, so reads shorter
+// than kCopyThreshold are copied into a Buffer of their own instead and their
+// reservation goes straight back to the slab. V8 is told about the memory
+// held by slabs, not about the slices in them.
+//
+// Not thread-safe, only use it from the main thread.
+class SlabAllocator {
+ public:
+  static const size_t kSlabSize = 256 * 1024;
+  static const size_t kCopyThreshold = 16 * 1024;
+
+  explicit SlabAllocator(size_t slab_size = kSlabSize);
+  ~SlabAllocator();
+
+  // Reserve `size` bytes, starts a new slab if the current one is too full
+  uv_buf_t Allocate(size_t size);
+
+  // Wrap the first `length` bytes of reservation `buf` in a Buffer
+  v8::Local<v8::Object> Use(uv_buf_t buf, size_t length);
+
+  // Give reservation `buf` back to its slab
+  void Release(uv_buf_t buf);
+
+  inline size_t slab_count() const {
+    return slab_count_;
+  }
+
+  inline size_t slice_count() const {
+    return slice_count_;
+  }
+
+  inline size_t copy_count() const {
+    return copy_count_;
+  }
+
+  static inline size_t slab_bytes() {
+    return slab_bytes_;
+  }
+
+ private:
+  struct Slab {
+    size_t size;
+    size_t offset;
+    unsigned int refs;
+  };
+
+  // Precedes every reservation
+  struct Header {
+    Slab* slab;
+    size_t length;  // of the Buffer, once there is one
+  };
+
+  static const size_t kHeaderSize = sizeof(Header);
+
+  static Slab* NewSlab(size_t size);
+  static void Unref(Slab* slab);
+  static void FreeCallback(char* data, void* hint);
+  static void Shrink(Slab* slab, uv_buf_t buf, size_t length);
+
+  static inline char* Data(Slab* slab) {
+    return reinterpret_cast<char*>(slab + 1);
+  }
+
+  static inline Header* HeaderOf(char* data) {
+    return reinterpret_cast<Header*>(data - kHeaderSize);
+  }
+
+  const size_t slab_size_;
+  Slab* current_;
+  size_t slab_count_;
+  size_t slice_count_;
+  size_t copy_count_;
+  static size_t slab_bytes_;
+};
+
+}  // namespace node
+
+#endif  // SRC_SLAB_ALLOCATOR_H_
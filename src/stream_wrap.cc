@@ -26,6 +26,7 @@
 #include "handle_wrap.h"
 #include "pipe_wrap.h"
 #include "req_wrap.h"
+#include "slab_allocator.h"
 #include "tcp_wrap.h"
 #include "udp_wrap.h"
 
@@ -54,13 +55,18 @@ static Cached<String> write_queue_size_sym;
 static Cached<String> onread_sym;
 static Cached<String> oncomplete_sym;
 static Cached<String> handle_sym;
+static SlabAllocator* slab_allocator;
 static bool initialized;
 
 
 void StreamWrap::Initialize(Handle<Object> target) {
+  NODE_SET_METHOD(target, "getSlabStats", GetSlabStats);
+
   if (initialized) return;
   initialized = true;
 
+  slab_allocator = new SlabAllocator();
+
   HandleScope scope(node_isolate);
   bytes_sym = FIXED_ONE_BYTE_STRING(node_isolate, "bytes");
   write_queue_size_sym = FIXED_ONE_BYTE_STRING(node_isolate, "writeQueueSize");
@@ -77,6 +83,21 @@ StreamWrap::StreamWrap(Handle<Object> object, uv_stream_t* stream)
 }
 
 
+void StreamWrap::GetSlabStats(const FunctionCallbackInfo<Value>& args) {
+  HandleScope scope(node_isolate);
+  Local<Object> stats = Object::New();
+  stats->Set(FIXED_ONE_BYTE_STRING(node_isolate, "slabs"),
+             Number::New(slab_allocator->slab_count()));
+  stats->Set(FIXED_ONE_BYTE_STRING(node_isolate, "slices"),
+             Number::New(slab_allocator->slice_count()));
+  stats->Set(FIXED_ONE_BYTE_STRING(node_isolate, "copies"),
+             Number::New(slab_allocator->copy_count()));
+  stats->Set(FIXED_ONE_BYTE_STRING(node_isolate, "bytes"),
+             Number::New(SlabAllocator::slab_bytes()));
+  args.GetReturnValue().Set(stats);
+}
+
+
 void StreamWrap::GetFD(Local<String>, const PropertyCallbackInfo<Value>& args) {
 #if !defined(_WIN32)
   HandleScope scope(node_isolate);
@@ -220,11 +241,27 @@ void StreamWrap::WriteBuffer(const FunctionCallbackInfo<Value>& args) {
   uv_buf_t buf;
   WriteBuffer(buf_obj, &buf);
 
-  int err = wrap->callbacks()->DoWrite(req_wrap,
-                                       &buf,
-                                       1,
-                                       NULL,
-                                       StreamWrap::AfterWrite);
+  uv_handle_t* send_handle = NULL;
+  if (wrap->is_named_pipe_ipc() && args[2]->IsObject()) {
+    Local<Object> send_handle_obj = args[2].As<Object>();
+    HandleWrap* send_wrap;
+    NODE_UNWRAP(send_handle_obj, HandleWrap, send_wrap);
+    send_handle = send_wrap->GetHandle();
+
+    // Reference the handle so it isn't garbage collected before
+    // `AfterWrite` is called.
+    if (handle_sym.IsEmpty()) {
+      handle_sym = FIXED_ONE_BYTE_STRING(node_isolate, "handle");
+    }
+    req_wrap_obj->Set(handle_sym, send_handle_obj);
+  }
+
+  int err = wrap->callbacks()->DoWrite(
+      req_wrap,
+      &buf,
+      1,
+      reinterpret_cast<uv_stream_t*>(send_handle),
+      StreamWrap::AfterWrite);
   req_wrap->Dispatched();
   req_wrap_obj->Set(bytes_sym, Integer::NewFromUnsigned(length, node_isolate));
 
@@ -546,12 +583,7 @@ void StreamWrapCallbacks::AfterWrite(WriteWrap* w) {
 
 uv_buf_t StreamWrapCallbacks::DoAlloc(uv_handle_t* handle,
                                       size_t suggested_size) {
-  char* data = static_cast<char*>(malloc(suggested_size));
-  if (data == NULL && suggested_size > 0) {
-    FatalError("node::StreamWrapCallbacks::DoAlloc(uv_handle_t*, size_t)",
-               "Out Of Memory");
-  }
-  return uv_buf_init(data, suggested_size);
+  return slab_allocator->Allocate(suggested_size);
 }
 
 
@@ -569,20 +601,19 @@ void StreamWrapCallbacks::DoRead(uv_stream_t* handle,
 
   if (nread < 0)  {
     if (buf.base != NULL)
-      free(buf.base);
+      slab_allocator->Release(buf);
     MakeCallback(Self(), onread_sym, ARRAY_SIZE(argv), argv);
     return;
   }
 
   if (nread == 0) {
     if (buf.base != NULL)
-      free(buf.base);
+      slab_allocator->Release(buf);
     return;
   }
 
-  buf.base = static_cast<char*>(realloc(buf.base, nread));
   assert(static_cast<size_t>(nread) <= buf.len);
-  argv[1] = Buffer::Use(buf.base, nread);
+  argv[1] = slab_allocator->Use(buf, nread);
 
   Local<Object> pending_obj;
   if (pending == UV_TCP) {
@@ -612,4 +643,15 @@ Handle<Object> StreamWrapCallbacks::Self() {
   return wrap()->object();
 }
 
+
+Local<Object> StreamWrapCallbacks::UseReadBuffer(uv_buf_t buf,
+                                                 size_t length) {
+  return slab_allocator->Use(buf, length);
+}
+
+
+void StreamWrapCallbacks::ReleaseReadBuffer(uv_buf_t buf) {
+  slab_allocator->Release(buf);
+}
+
 }  // namespace node
@@ -88,6 +88,11 @@ class StreamWrapCallbacks {
 
   v8::Handle<v8::Object> Self();
 
+  // Turn the first `length` bytes of a buffer from the default DoAlloc()
+  // into a Buffer, or give the buffer back unused.
+  static v8::Local<v8::Object> UseReadBuffer(uv_buf_t buf, size_t length);
+  static void ReleaseReadBuffer(uv_buf_t buf);
+
  protected:
   inline StreamWrap* wrap() const {
     return wrap_;
@@ -106,8 +111,15 @@ class StreamWrap : public HandleWrap {
       delete old;
   }
 
+  // Go back to the default callbacks, deletes the overriding ones.
+  void ResetCallbacks() {
+    OverrideCallbacks(&default_callbacks_);
+  }
+
   static void Initialize(v8::Handle<v8::Object> target);
 
+  static void GetSlabStats(const v8::FunctionCallbackInfo<v8::Value>& args);
+
   static void GetFD(v8::Local<v8::String>,
                     const v8::PropertyCallbackInfo<v8::Value>&);
 
@@ -126,6 +138,10 @@ class StreamWrap : public HandleWrap {
     return callbacks_;
   }
 
+  inline bool has_default_callbacks() const {
+    return callbacks_ == &default_callbacks_;
+  }
+
   inline uv_stream_t* stream() const {
     return stream_;
   }
@@ -29,6 +29,26 @@
 #include <limits.h>
 #include <string.h>  // memcpy
 
+// SSE2 is part of the x86_64 baseline, on ia32 it depends on the compiler
+// flags. The SSSE3 kernels are compiled with a function level target
+// attribute and only used after checking the CPU at run time.
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define NODE_HAVE_SSE2 1
+# include <emmintrin.h>
+#endif
+
+#if defined(NODE_HAVE_SSE2) && \
+    ((defined(__clang__) &&                                                   \
+      (__clang_major__ > 3 || (__clang_major__ == 3 && __clang_minor__ >= 8))) \
+     || (!defined(__clang__) && defined(__GNUC__) &&                          \
+      (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+# define NODE_HAVE_SSSE3 1
+# define NODE_TARGET_SSSE3 __attribute__((target("ssse3")))
+# include <cpuid.h>
+# include <tmmintrin.h>
+#endif
+
 // When creating strings >= this length v8's gc spins up and consumes
 // most of the execution time. For these cases it's more performant to
 // use external string resources.
@@ -101,6 +121,75 @@ typedef ExternString<String::ExternalStringResource,
                      uint16_t> ExternTwoByteString;
 
 
+static bool contains_non_ascii(const char* src, size_t len);
+static size_t count_non_ascii(const char* src, size_t len);
+
+
+// Like String::Value but for strings without two-byte characters, the copy
+// is half the size and the decoders get to work on bytes.
+class OneByteValue {
+ public:
+  explicit OneByteValue(Handle<String> str) : length_(str->Length()) {
+    data_ = length_ <= sizeof(stack_) ? stack_ : new char[length_];
+    str->WriteOneByte(reinterpret_cast<uint8_t*>(data_),
+                      0,
+                      length_,
+                      String::NO_NULL_TERMINATION);
+  }
+
+  ~OneByteValue() {
+    if (data_ != stack_)
+      delete[] data_;
+  }
+
+  const char* operator*() const { return data_; }
+  size_t length() const { return length_; }
+
+ private:
+  char stack_[1024];
+  char* data_;
+  size_t length_;
+};
+
+
+//// SIMD ////
+
+#if defined(NODE_HAVE_SSSE3)
+static bool cpu_has_ssse3() {
+  static int has_ssse3 = -1;
+  if (has_ssse3 == -1) {
+    unsigned eax, ebx, ecx, edx;
+    has_ssse3 = __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSSE3);
+  }
+  return has_ssse3 != 0;
+}
+#endif
+
+
+#if defined(NODE_HAVE_SSE2)
+// Loads 16 characters. Two-byte characters that don't fit in a byte are
+// saturated to 0x00 or 0xff, which no decoder accepts, so the scalar code
+// gets to deal with them.
+static inline __m128i load16(const char* src) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+}
+
+
+static inline __m128i load16(const uint16_t* src) {
+  const __m128i* p = reinterpret_cast<const __m128i*>(src);
+  return _mm_packus_epi16(_mm_loadu_si128(p), _mm_loadu_si128(p + 1));
+}
+
+
+// Mask of the bytes in [lo, hi]. The comparison is signed so it only works
+// for ASCII ranges, bytes >= 0x80 never match.
+static inline __m128i in_range(__m128i v, char lo, char hi) {
+  return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)),
+                       _mm_cmplt_epi8(v, _mm_set1_epi8(hi + 1)));
+}
+#endif
+
+
 //// Base 64 ////
 
 #define base64_encoded_size(size) ((size + 2 - ((size + 2) % 3)) / 3 * 4)
@@ -124,15 +213,14 @@ static inline size_t base64_decoded_size_fast(size_t size) {
   return size;
 }
 
-template <typename TypeName>
-size_t base64_decoded_size(const TypeName* src, size_t size) {
-  if (size == 0)
-    return 0;
-
-  if (src[size - 1] == '=')
-    size--;
-  if (size > 0 && src[size - 1] == '=')
+// `tail` holds the last two characters of the input, or fewer right-aligned
+// if the input is shorter.
+static size_t base64_decoded_size(const uint16_t tail[2], size_t size) {
+  if (size > 0 && tail[1] == '=') {
     size--;
+    if (size > 0 && tail[0] == '=')
+      size--;
+  }
 
   return base64_decoded_size_fast(size);
 }
@@ -160,6 +248,51 @@ static const int unbase64_table[] =
 #define unbase64(x) unbase64_table[(uint8_t)(x)]
 
 
+#if defined(NODE_HAVE_SSSE3)
+// Decodes 16 characters into 12 bytes. Returns false, without writing
+// anything, unless all 16 are in the (regular or URL-safe) alphabet; padding,
+// whitespace and garbage are left to the scalar code.
+template <typename TypeName>
+NODE_TARGET_SSSE3
+static bool base64_decode_block(char* dst, const TypeName* src) {
+  const __m128i c = load16(src);
+
+  const __m128i upper = in_range(c, 'A', 'Z');
+  const __m128i lower = in_range(c, 'a', 'z');
+  const __m128i digit = in_range(c, '0', '9');
+  const __m128i plus = _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('+')),
+                                    _mm_cmpeq_epi8(c, _mm_set1_epi8('-')));
+  const __m128i slash = _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('/')),
+                                     _mm_cmpeq_epi8(c, _mm_set1_epi8('_')));
+
+  const __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower),
+                                     _mm_or_si128(digit,
+                                                  _mm_or_si128(plus, slash)));
+  if (_mm_movemask_epi8(valid) != 0xffff)
+    return false;
+
+  __m128i shift = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+  shift = _mm_or_si128(shift, _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+  shift = _mm_or_si128(shift, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+  __m128i v = _mm_add_epi8(c, shift);
+  v = _mm_or_si128(_mm_andnot_si128(_mm_or_si128(plus, slash), v),
+                   _mm_or_si128(_mm_and_si128(plus, _mm_set1_epi8(62)),
+                                _mm_and_si128(slash, _mm_set1_epi8(63))));
+
+  // Merge the 6 bit values into 24 bit groups, then drop every fourth byte.
+  v = _mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140));
+  v = _mm_madd_epi16(v, _mm_set1_epi32(0x00011000));
+  v = _mm_shuffle_epi8(v, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8,
+                                        14, 13, 12, -1, -1, -1, -1));
+
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), v);
+  const int tail = _mm_cvtsi128_si32(_mm_srli_si128(v, 8));
+  memcpy(dst + 8, &tail, 4);
+  return true;
+}
+#endif
+
+
 template <typename TypeName>
 size_t base64_decode(char* buf,
                      size_t len,
@@ -169,8 +302,22 @@ size_t base64_decode(char* buf,
   char* dst = buf;
   char* dstEnd = buf + len;
   const TypeName* srcEnd = src + srcLen;
+#if defined(NODE_HAVE_SSSE3)
+  const bool simd = cpu_has_ssse3();
+#endif
 
   while (src < srcEnd && dst < dstEnd) {
+#if defined(NODE_HAVE_SSSE3)
+    // Runs of clean input are decoded 16 characters at a time. Anything
+    // else falls through to the scalar code for one group of four.
+    while (simd && srcEnd - src >= 16 && dstEnd - dst >= 12 &&
+           base64_decode_block(dst, src)) {
+      src += 16;
+      dst += 12;
+    }
+    if (src == srcEnd || dst == dstEnd) break;
+#endif
+
     int remaining = srcEnd - src;
 
     while (unbase64(*src) < 0 && src < srcEnd) src++, remaining--;
@@ -213,13 +360,56 @@ unsigned hex2bin(TypeName c) {
 }
 
 
+#if defined(NODE_HAVE_SSE2)
+// Returns the nibbles of 16 hex digits, or sets `valid` to false.
+static inline __m128i hex_nibbles(__m128i c, bool* valid) {
+  const __m128i digit = in_range(c, '0', '9');
+  // Folds 'A'-'F' onto 'a'-'f', nothing else lands in that range.
+  const __m128i folded = _mm_or_si128(c, _mm_set1_epi8(0x20));
+  const __m128i alpha = in_range(folded, 'a', 'f');
+  *valid = _mm_movemask_epi8(_mm_or_si128(digit, alpha)) == 0xffff;
+  return _mm_or_si128(
+      _mm_and_si128(digit, _mm_sub_epi8(c, _mm_set1_epi8('0'))),
+      _mm_and_si128(alpha, _mm_sub_epi8(folded, _mm_set1_epi8('a' - 10))));
+}
+
+
+// Decodes 32 hex digits into 16 bytes. Returns false, without writing
+// anything, if one of them is not a hex digit.
+template <typename TypeName>
+static inline bool hex_decode_block(char* dst, const TypeName* src) {
+  bool valid0;
+  bool valid1;
+  const __m128i n0 = hex_nibbles(load16(src), &valid0);
+  const __m128i n1 = hex_nibbles(load16(src + 16), &valid1);
+  if (!valid0 || !valid1)
+    return false;
+
+  // Every 16 bit lane holds the high nibble in its low byte and vice versa.
+  const __m128i lo = _mm_set1_epi16(0xff);
+  const __m128i b0 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(n0, lo), 4),
+                                  _mm_srli_epi16(n0, 8));
+  const __m128i b1 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(n1, lo), 4),
+                                  _mm_srli_epi16(n1, 8));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(b0, b1));
+  return true;
+}
+#endif
+
+
 template <typename TypeName>
 size_t hex_decode(char* buf,
                   size_t len,
                   const TypeName* src,
                   const size_t srcLen) {
-  size_t i;
-  for (i = 0; i < len && i * 2 + 1 < srcLen; ++i) {
+  size_t i = 0;
+#if defined(NODE_HAVE_SSE2)
+  while (i + 16 <= len && (i + 16) * 2 <= srcLen &&
+         hex_decode_block(buf + i, src + i * 2)) {
+    i += 16;
+  }
+#endif
+  for (; i < len && i * 2 + 1 < srcLen; ++i) {
     unsigned a = hex2bin(src[i * 2 + 0]);
     unsigned b = hex2bin(src[i * 2 + 1]);
     if (!~a || !~b) return i;
@@ -270,11 +460,11 @@ size_t StringBytes::Write(char* buf,
                           int* chars_written) {
   HandleScope scope(node_isolate);
   const char* data;
-  size_t len = 0;
-  bool is_extern = GetExternalParts(val, &data, &len);
+  size_t data_len = 0;
+  bool is_extern = GetExternalParts(val, &data, &data_len);
 
   Local<String> str = val->ToString();
-  len = len < buflen ? len : buflen;
+  size_t len = data_len < buflen ? data_len : buflen;
 
   int flags = String::NO_NULL_TERMINATION |
               String::HINT_MANY_WRITES_EXPECTED;
@@ -295,6 +485,13 @@ size_t StringBytes::Write(char* buf,
       break;
 
     case UTF8:
+      if (is_extern && str->IsExternalAscii() &&
+          !contains_non_ascii(data, len)) {
+        memcpy(buf, data, len);
+        if (chars_written != NULL)
+          *chars_written = len;
+        break;
+      }
       len = str->WriteUtf8(buf, buflen, chars_written, flags);
       break;
 
@@ -310,7 +507,10 @@ size_t StringBytes::Write(char* buf,
 
     case BASE64:
       if (is_extern) {
-        base64_decode(buf, buflen, data, len);
+        len = base64_decode(buf, buflen, data, data_len);
+      } else if (str->IsOneByte()) {
+        OneByteValue value(str);
+        len = base64_decode(buf, buflen, *value, value.length());
       } else {
         String::Value value(str);
         len = base64_decode(buf, buflen, *value, value.length());
@@ -322,7 +522,10 @@ size_t StringBytes::Write(char* buf,
 
     case HEX:
       if (is_extern) {
-        hex_decode(buf, buflen, data, len);
+        len = hex_decode(buf, buflen, data, data_len);
+      } else if (str->IsOneByte()) {
+        OneByteValue value(str);
+        len = hex_decode(buf, buflen, *value, value.length());
       } else {
         String::Value value(str);
         len = hex_decode(buf, buflen, *value, value.length());
@@ -416,17 +619,29 @@ size_t StringBytes::Size(Handle<Value> val, enum encoding encoding) {
       data_size = str->Length();
       break;
 
-    case UTF8:
-      data_size = str->Utf8Length();
+    case UTF8: {
+      const char* data;
+      size_t len;
+      if (str->IsExternalAscii() && GetExternalParts(str, &data, &len))
+        data_size = len + count_non_ascii(data, len);
+      else
+        data_size = str->Utf8Length();
       break;
+    }
 
     case UCS2:
       data_size = str->Length() * sizeof(uint16_t);
       break;
 
     case BASE64: {
-      String::Value value(str);
-      data_size = base64_decoded_size(*value, value.length());
+      // Only the padding at the end matters, don't copy the whole string.
+      const int length = str->Length();
+      uint16_t tail[2] = { 0, 0 };
+      if (length >= 2)
+        str->Write(tail, length - 2, 2, String::NO_NULL_TERMINATION);
+      else if (length == 1)
+        str->Write(tail + 1, 0, 1, String::NO_NULL_TERMINATION);
+      data_size = base64_decoded_size(tail, length);
       break;
     }
 
@@ -453,6 +668,23 @@ static bool contains_non_ascii_slow(const char* buf, size_t len) {
 }
 
 
+#if defined(NODE_HAVE_SSE2)
+static bool contains_non_ascii(const char* src, size_t len) {
+  size_t i = 0;
+
+  for (; i + 64 <= len; i += 64) {
+    const __m128i a = _mm_or_si128(load16(src + i), load16(src + i + 16));
+    const __m128i b = _mm_or_si128(load16(src + i + 32), load16(src + i + 48));
+    if (_mm_movemask_epi8(_mm_or_si128(a, b))) return true;
+  }
+
+  for (; i + 16 <= len; i += 16) {
+    if (_mm_movemask_epi8(load16(src + i))) return true;
+  }
+
+  return contains_non_ascii_slow(src + i, len - i);
+}
+#else
 static bool contains_non_ascii(const char* src, size_t len) {
   if (len < 16) {
     return contains_non_ascii_slow(src, len);
@@ -490,6 +722,36 @@ static bool contains_non_ascii(const char* src, size_t len) {
 
   return false;
 }
+#endif  // defined(NODE_HAVE_SSE2)
+
+
+// Number of bytes >= 0x80, i.e. the number of extra bytes a Latin-1 string
+// takes up when it's encoded as UTF-8.
+static size_t count_non_ascii(const char* src, size_t len) {
+  size_t count = 0;
+  size_t i = 0;
+
+#if defined(NODE_HAVE_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i one = _mm_set1_epi8(1);
+  while (i + 16 <= len) {
+    // Sum in 8 bit lanes for up to 255 rounds, then fold into 64 bits.
+    __m128i sum = zero;
+    for (size_t n = 0; n < 255 && i + 16 <= len; ++n, i += 16)
+      sum = _mm_add_epi8(sum, _mm_and_si128(_mm_srli_epi16(load16(src + i), 7),
+                                            one));
+    sum = _mm_sad_epu8(sum, zero);
+    count += _mm_cvtsi128_si32(sum) +
+             _mm_cvtsi128_si32(_mm_srli_si128(sum, 8));
+  }
+#endif
+
+  for (; i < len; ++i) {
+    if (src[i] & 0x80) count++;
+  }
+
+  return count;
+}
 
 
 static void force_ascii_slow(const char* src, char* dst, size_t len) {
@@ -499,6 +761,19 @@ static void force_ascii_slow(const char* src, char* dst, size_t len) {
 }
 
 
+#if defined(NODE_HAVE_SSE2)
+static void force_ascii(const char* src, char* dst, size_t len) {
+  const __m128i mask = _mm_set1_epi8(0x7f);
+  size_t i = 0;
+
+  for (; i + 16 <= len; i += 16) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm_and_si128(load16(src + i), mask));
+  }
+
+  force_ascii_slow(src + i, dst + i, len - i);
+}
+#else
 static void force_ascii(const char* src, char* dst, size_t len) {
   if (len < 16) {
     force_ascii_slow(src, dst, len);
@@ -542,6 +817,44 @@ static void force_ascii(const char* src, char* dst, size_t len) {
     force_ascii_slow(src + offset, dst + offset, remainder);
   }
 }
+#endif  // defined(NODE_HAVE_SSE2)
+
+
+#if defined(NODE_HAVE_SSSE3)
+// Encodes 12 bytes into 16 characters. Reads 16 bytes from `src`.
+NODE_TARGET_SSSE3
+static void base64_encode_block(const char* src, char* dst) {
+  __m128i v = load16(src);
+
+  // Spread the bytes so every 32 bit lane holds one 24 bit group, then move
+  // the four 6 bit indices of each group into their own bytes.
+  v = _mm_shuffle_epi8(v, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7,
+                                       4, 5, 3, 4, 1, 2, 0, 1));
+  const __m128i t0 = _mm_mulhi_epu16(
+      _mm_and_si128(v, _mm_set1_epi32(0x0fc0fc00)),
+      _mm_set1_epi32(0x04000040));
+  const __m128i t1 = _mm_mullo_epi16(
+      _mm_and_si128(v, _mm_set1_epi32(0x003f03f0)),
+      _mm_set1_epi32(0x01000010));
+  const __m128i indices = _mm_or_si128(t0, t1);
+
+  // Map the indices onto the alphabet: 0-25 'A', 26-51 'a', 52-61 '0',
+  // 62 '+' and 63 '/'. Every range gets an offset from a lookup table.
+  __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  range = _mm_or_si128(
+      range,
+      _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices),
+                    _mm_set1_epi8(13)));
+  const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                        '0' - 52, '0' - 52, '0' - 52,
+                                        '0' - 52, '0' - 52, '0' - 52,
+                                        '0' - 52, '0' - 52, '+' - 62,
+                                        '/' - 63, 'A', 0, 0);
+  v = _mm_add_epi8(_mm_shuffle_epi8(offsets, range), indices);
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+}
+#endif
 
 
 static size_t base64_encode(const char* src,
@@ -569,6 +882,17 @@ static size_t base64_encode(const char* src,
   k = 0;
   n = slen / 3 * 3;
 
+#if defined(NODE_HAVE_SSSE3)
+  if (cpu_has_ssse3()) {
+    // The block reads 16 bytes but consumes only 12.
+    while (i + 16 <= slen) {
+      base64_encode_block(src + i, dst + k);
+      i += 12;
+      k += 16;
+    }
+  }
+#endif
+
   while (i < n) {
     a = src[i + 0] & 0xff;
     b = src[i + 1] & 0xff;
@@ -614,7 +938,30 @@ static size_t hex_encode(const char* src, size_t slen, char* dst, size_t dlen) {
       "not enough space provided for hex encode");
 
   dlen = slen * 2;
-  for (uint32_t i = 0, k = 0; k < dlen; i += 1, k += 2) {
+  uint32_t i = 0;
+  uint32_t k = 0;
+
+#if defined(NODE_HAVE_SSE2)
+  const __m128i nibble = _mm_set1_epi8(0x0f);
+  const __m128i nine = _mm_set1_epi8(9);
+  const __m128i zero = _mm_set1_epi8('0');
+  const __m128i alpha = _mm_set1_epi8('a' - '0' - 10);
+  for (; i + 16 <= slen; i += 16, k += 32) {
+    const __m128i v = load16(src + i);
+    __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), nibble);
+    __m128i lo = _mm_and_si128(v, nibble);
+    hi = _mm_add_epi8(_mm_add_epi8(hi, zero),
+                      _mm_and_si128(_mm_cmpgt_epi8(hi, nine), alpha));
+    lo = _mm_add_epi8(_mm_add_epi8(lo, zero),
+                      _mm_and_si128(_mm_cmpgt_epi8(lo, nine), alpha));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k),
+                     _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k + 16),
+                     _mm_unpackhi_epi8(hi, lo));
+  }
+#endif
+
+  for (; k < dlen; i += 1, k += 2) {
     static const char hex[] = "0123456789abcdef";
     uint8_t val = static_cast<uint8_t>(src[i]);
     dst[k + 0] = hex[val >> 4];
@@ -659,6 +1006,14 @@ Local<Value> StringBytes::Encode(const char* buf,
       break;
 
     case UTF8:
+      // ASCII is valid UTF-8 that V8 doesn't have to decode.
+      if (!contains_non_ascii(buf, buflen)) {
+        if (buflen < EXTERN_APEX)
+          val = OneByteString(node_isolate, buf, buflen);
+        else
+          val = ExternOneByteString::NewFromCopy(buf, buflen);
+        break;
+      }
       val = String::NewFromUtf8(node_isolate,
                                 buf,
                                 String::kNormalString,
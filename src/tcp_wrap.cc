@@ -268,9 +268,13 @@ void TCPWrap::Bind(const FunctionCallbackInfo<Value>& args) {
 
   String::AsciiValue ip_address(args[0]);
   int port = args[1]->Int32Value();
+  bool reuseport = args[2]->BooleanValue();
 
-  struct sockaddr_in address = uv_ip4_addr(*ip_address, port);
-  int err = uv_tcp_bind(&wrap->handle_, address);
+  int err = uv_tcp_reuseport(&wrap->handle_, reuseport);
+  if (err == 0) {
+    struct sockaddr_in address = uv_ip4_addr(*ip_address, port);
+    err = uv_tcp_bind(&wrap->handle_, address);
+  }
 
   args.GetReturnValue().Set(err);
 }
@@ -284,9 +288,13 @@ void TCPWrap::Bind6(const FunctionCallbackInfo<Value>& args) {
 
   String::AsciiValue ip6_address(args[0]);
   int port = args[1]->Int32Value();
+  bool reuseport = args[2]->BooleanValue();
 
-  struct sockaddr_in6 address = uv_ip6_addr(*ip6_address, port);
-  int err = uv_tcp_bind6(&wrap->handle_, address);
+  int err = uv_tcp_reuseport(&wrap->handle_, reuseport);
+  if (err == 0) {
+    struct sockaddr_in6 address = uv_ip6_addr(*ip6_address, port);
+    err = uv_tcp_bind6(&wrap->handle_, address);
+  }
 
   args.GetReturnValue().Set(err);
 }
@@ -0,0 +1,342 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "timer_wheel.h"
+#include "node.h"
+#include "node_internals.h"
+#include "handle_wrap.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace node {
+
+using v8::Array;
+using v8::FunctionCallbackInfo;
+using v8::FunctionTemplate;
+using v8::Handle;
+using v8::HandleScope;
+using v8::Integer;
+using v8::Local;
+using v8::Object;
+using v8::Value;
+
+// Index of the callback on the JS object, the same as Timer's kOnTimeout.
+static const uint32_t kOnTimeout = 0;
+
+
+static inline unsigned CountTrailingZeros(uint64_t x) {
+#if defined(__GNUC__)
+  return __builtin_ctzll(x);
+#else
+  unsigned n = 0;
+  while ((x & 1) == 0) {
+    x >>= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+
+static inline unsigned HighestBit(uint64_t x) {
+#if defined(__GNUC__)
+  return 63 - __builtin_clzll(x);
+#else
+  unsigned n = 0;
+  while (x >>= 1)
+    n++;
+  return n;
+#endif
+}
+
+
+void TimerWheel::Initialize(Handle<Object> target) {
+  HandleScope scope(node_isolate);
+
+  Local<FunctionTemplate> constructor = FunctionTemplate::New(New);
+  constructor->InstanceTemplate()->SetInternalFieldCount(1);
+  constructor->SetClassName(FIXED_ONE_BYTE_STRING(node_isolate, "TimerWheel"));
+
+  NODE_SET_PROTOTYPE_METHOD(constructor, "close", HandleWrap::Close);
+  NODE_SET_PROTOTYPE_METHOD(constructor, "ref", HandleWrap::Ref);
+  NODE_SET_PROTOTYPE_METHOD(constructor, "unref", HandleWrap::Unref);
+
+  NODE_SET_PROTOTYPE_METHOD(constructor, "add", Add);
+  NODE_SET_PROTOTYPE_METHOD(constructor, "refresh", Refresh);
+  NODE_SET_PROTOTYPE_METHOD(constructor, "remove", Remove);
+
+  target->Set(FIXED_ONE_BYTE_STRING(node_isolate, "TimerWheel"),
+              constructor->GetFunction());
+}
+
+
+TimerWheel::TimerWheel(Handle<Object> object, uint64_t resolution)
+    : HandleWrap(object, reinterpret_cast<uv_handle_t*>(&handle_)),
+      resolution_(resolution),
+      armed_(kNever),
+      entries_(NULL),
+      entries_size_(0),
+      free_(kNone) {
+  int r = uv_timer_init(uv_default_loop(), &handle_);
+  assert(r == 0);
+  now_ = uv_now(uv_default_loop()) / resolution_;
+  for (unsigned i = 0; i < ARRAY_SIZE(heads_); i++)
+    heads_[i] = kNone;
+  memset(occupied_, 0, sizeof(occupied_));
+}
+
+
+TimerWheel::~TimerWheel() {
+  free(entries_);
+}
+
+
+// new TimerWheel(resolution)
+void TimerWheel::New(const FunctionCallbackInfo<Value>& args) {
+  // This constructor should not be exposed to public javascript.
+  assert(args.IsConstructCall());
+  HandleScope scope(node_isolate);
+  int64_t resolution = args[0]->IntegerValue();
+  new TimerWheel(args.This(), resolution > 0 ? resolution : 1);
+}
+
+
+// add(msecs), returns the id of the new timeout.
+void TimerWheel::Add(const FunctionCallbackInfo<Value>& args) {
+  HandleScope scope(node_isolate);
+  TimerWheel* wheel;
+  NODE_UNWRAP(args.This(), TimerWheel, wheel);
+
+  uint32_t id = wheel->NewEntry();
+  wheel->Schedule(id, args[0]->IntegerValue());
+  args.GetReturnValue().Set(id);
+}
+
+
+// refresh(id, msecs), makes the timeout expire msecs from now.
+void TimerWheel::Refresh(const FunctionCallbackInfo<Value>& args) {
+  HandleScope scope(node_isolate);
+  TimerWheel* wheel;
+  NODE_UNWRAP(args.This(), TimerWheel, wheel);
+
+  uint32_t id = args[0]->Uint32Value();
+  assert(id < wheel->entries_size_);
+  assert(wheel->entries_[id].slot != -1);
+  wheel->Unlink(id);
+  wheel->Schedule(id, args[1]->IntegerValue());
+}
+
+
+// remove(id), the id can be handed out again afterwards.
+void TimerWheel::Remove(const FunctionCallbackInfo<Value>& args) {
+  HandleScope scope(node_isolate);
+  TimerWheel* wheel;
+  NODE_UNWRAP(args.This(), TimerWheel, wheel);
+
+  uint32_t id = args[0]->Uint32Value();
+  assert(id < wheel->entries_size_);
+  assert(wheel->entries_[id].slot != -1);
+  wheel->Unlink(id);
+  wheel->FreeEntry(id);
+  // handle_ may now fire for nothing. That's cheaper than working out the
+  // next deadline on every removal.
+}
+
+
+uint32_t TimerWheel::NewEntry() {
+  if (free_ == kNone) {
+    uint32_t size = entries_size_ ? entries_size_ * 2 : 64;
+    Entry* entries =
+        static_cast<Entry*>(realloc(entries_, size * sizeof(*entries)));
+    if (entries == NULL)
+      FatalError("node::TimerWheel::NewEntry()", "Out of memory");
+    entries_ = entries;
+    // Chain the new entries onto the free list, lowest id first.
+    for (uint32_t i = entries_size_; i < size; i++) {
+      entries_[i].slot = -1;
+      entries_[i].next = i + 1 < size ? i + 1 : kNone;
+    }
+    free_ = entries_size_;
+    entries_size_ = size;
+  }
+
+  uint32_t id = free_;
+  free_ = entries_[id].next;
+  return id;
+}
+
+
+void TimerWheel::FreeEntry(uint32_t id) {
+  entries_[id].slot = -1;
+  entries_[id].next = free_;
+  free_ = id;
+}
+
+
+void TimerWheel::Schedule(uint32_t id, uint64_t msecs) {
+  // Round up, a timeout must not fire early.
+  uint64_t when = uv_now(uv_default_loop()) + msecs;
+  entries_[id].expires = (when + resolution_ - 1) / resolution_;
+  Link(id);
+  if (entries_[id].expires < armed_)
+    Arm();
+}
+
+
+void TimerWheel::Link(uint32_t id) {
+  Entry* e = &entries_[id];
+
+  // The highest bit the expiry time and now_ differ in picks the level. An
+  // expired timeout goes into the current slot of level 0.
+  static const uint64_t kMaxTicks =
+      static_cast<uint64_t>(1) << (kSlotBits * kLevels);
+  uint64_t when = e->expires;
+  if (when < now_)
+    when = now_;
+  if (when - now_ >= kMaxTicks)
+    when = now_ + kMaxTicks - 1;
+  unsigned level = HighestBit((when ^ now_) | (kSlots - 1)) / kSlotBits;
+  if (level >= kLevels)
+    level = kLevels - 1;
+  unsigned slot = (when >> (level * kSlotBits)) & (kSlots - 1);
+
+  uint32_t index = level * kSlots + slot;
+  e->slot = index;
+  e->prev = kNone;
+  e->next = heads_[index];
+  if (e->next != kNone)
+    entries_[e->next].prev = id;
+  heads_[index] = id;
+  occupied_[level] |= static_cast<uint64_t>(1) << slot;
+}
+
+
+void TimerWheel::Unlink(uint32_t id) {
+  Entry* e = &entries_[id];
+  assert(e->slot != -1);
+
+  if (e->prev != kNone)
+    entries_[e->prev].next = e->next;
+  else
+    heads_[e->slot] = e->next;
+  if (e->next != kNone)
+    entries_[e->next].prev = e->prev;
+
+  if (heads_[e->slot] == kNone) {
+    unsigned level = e->slot / kSlots;
+    unsigned slot = e->slot % kSlots;
+    occupied_[level] &= ~(static_cast<uint64_t>(1) << slot);
+  }
+  e->slot = -1;
+}
+
+
+// The first non-empty slot and the tick it comes up at. Lower levels always
+// come up before higher ones.
+bool TimerWheel::NextExpiration(uint32_t* index, uint64_t* deadline) const {
+  for (unsigned level = 0; level < kLevels; level++) {
+    uint64_t occupied = occupied_[level];
+    if (occupied == 0)
+      continue;
+
+    unsigned shift = level * kSlotBits;
+    uint64_t level_range = static_cast<uint64_t>(1) << (shift + kSlotBits);
+    unsigned now_slot = (now_ >> shift) & (kSlots - 1);
+
+    // Only the top level can wrap around, see Link().
+    uint64_t rotated = occupied >> now_slot;
+    if (now_slot != 0)
+      rotated |= occupied << (kSlots - now_slot);
+    unsigned slot = (now_slot + CountTrailingZeros(rotated)) & (kSlots - 1);
+
+    *index = level * kSlots + slot;
+    *deadline = (now_ & ~(level_range - 1)) +
+                (static_cast<uint64_t>(slot) << shift);
+    if (slot < now_slot)
+      *deadline += level_range;
+    return true;
+  }
+  return false;
+}
+
+
+void TimerWheel::Arm() {
+  uint32_t index;
+  uint64_t deadline;
+  if (!NextExpiration(&index, &deadline)) {
+    uv_timer_stop(&handle_);
+    armed_ = kNever;
+    return;
+  }
+
+  uint64_t now = uv_now(uv_default_loop());
+  uint64_t when = deadline * resolution_;
+  uv_timer_start(&handle_, OnTimeout, when > now ? when - now : 0, 0);
+  armed_ = deadline;
+}
+
+
+void TimerWheel::OnTimeout(uv_timer_t* handle, int status) {
+  HandleScope scope(node_isolate);
+
+  TimerWheel* wheel = container_of(handle, TimerWheel, handle_);
+  uint64_t now = uv_now(uv_default_loop()) / wheel->resolution_;
+  wheel->armed_ = kNever;
+
+  // Run the wheel up to now. Whatever is in a slot that comes up has either
+  // expired or moves to a lower level.
+  Local<Array> expired = Array::New();
+  uint32_t count = 0;
+  uint32_t index;
+  uint64_t deadline;
+  while (wheel->NextExpiration(&index, &deadline) && deadline <= now) {
+    wheel->now_ = deadline;
+    uint32_t id = wheel->heads_[index];
+    wheel->heads_[index] = kNone;
+    wheel->occupied_[index / kSlots] &=
+        ~(static_cast<uint64_t>(1) << (index % kSlots));
+    while (id != kNone) {
+      uint32_t next = wheel->entries_[id].next;
+      if (wheel->entries_[id].expires <= deadline) {
+        wheel->FreeEntry(id);
+        expired->Set(count++, Integer::NewFromUnsigned(id, node_isolate));
+      } else {
+        wheel->Link(id);
+      }
+      id = next;
+    }
+  }
+  if (now > wheel->now_)
+    wheel->now_ = now;
+
+  wheel->Arm();
+
+  if (count == 0)
+    return;
+
+  Local<Value> argv[1] = { expired };
+  MakeCallback(wheel->object(), kOnTimeout, ARRAY_SIZE(argv), argv);
+}
+
+}  // namespace node
@@ -0,0 +1,91 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#ifndef SRC_TIMER_WHEEL_H_
+#define SRC_TIMER_WHEEL_H_
+
+#include "node.h"
+#include "handle_wrap.h"
+#include "uv.h"
+#include "v8.h"
+
+#include <stdint.h>
+
+namespace node {
+
+// A hierarchical timing wheel driven by a single uv_timer_t. Adding,
+// refreshing and removing a timeout are O(1), timeouts that expire together
+// are handed to JS in one batch. Times are kept in ticks of |resolution|
+// milliseconds and a timeout never fires early, at most one tick late.
+//
+// Each level has kSlots slots, a slot of level N spans kSlots^N ticks. A
+// timeout goes into the lowest level whose slot can tell it apart from the
+// current time, and moves down a level whenever its slot comes up.
+class TimerWheel : public HandleWrap {
+ public:
+  static void Initialize(v8::Handle<v8::Object> target);
+
+ private:
+  static const unsigned kSlotBits = 6;
+  static const unsigned kSlots = 1 << kSlotBits;
+  static const unsigned kLevels = 6;
+  static const uint32_t kNone = 0xffffffff;
+  static const uint64_t kNever = ~static_cast<uint64_t>(0);
+
+  struct Entry {
+    uint64_t expires;  // In ticks.
+    uint32_t prev;
+    uint32_t next;     // Next free id when the entry isn't in use.
+    int32_t slot;      // Index into heads_, -1 when not scheduled.
+  };
+
+  TimerWheel(v8::Handle<v8::Object> object, uint64_t resolution);
+  ~TimerWheel();
+
+  static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Add(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Refresh(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Remove(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void OnTimeout(uv_timer_t* handle, int status);
+
+  uint32_t NewEntry();
+  void FreeEntry(uint32_t id);
+  void Schedule(uint32_t id, uint64_t msecs);
+  void Link(uint32_t id);
+  void Unlink(uint32_t id);
+  bool NextExpiration(uint32_t* slot, uint64_t* deadline) const;
+  void Arm();
+
+  uv_timer_t handle_;
+  uint64_t resolution_;
+  uint64_t now_;             // In ticks, the wheel has run up to here.
+  uint64_t armed_;           // Tick handle_ fires at, kNever when stopped.
+  Entry* entries_;
+  uint32_t entries_size_;
+  uint32_t free_;
+  uint32_t heads_[kLevels * kSlots];
+  uint64_t occupied_[kLevels];  // A bit per non-empty slot.
+};
+
+}  // namespace node
+
+#endif  // SRC_TIMER_WHEEL_H_
@@ -19,7 +19,9 @@
 // OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
 // USE OR OTHER DEALINGS IN THE SOFTWARE.
 
+#include "timer_wheel.h"
 #include "node.h"
+#include "node_internals.h"
 #include "handle_wrap.h"
 
 #include <stdint.h>
@@ -39,6 +41,15 @@ using v8::Value;
 
 const uint32_t kOnTimeout = 0;
 
+// uv_now() as of the last call into JS, exposed as Timer.loopTime[0].
+static double loop_time;
+
+
+void UpdateLoopTime() {
+  loop_time = static_cast<double>(uv_now(uv_default_loop()));
+}
+
+
 class TimerWrap : public HandleWrap {
  public:
   static void Initialize(Handle<Object> target) {
@@ -51,6 +62,16 @@ class TimerWrap : public HandleWrap {
                      Integer::New(kOnTimeout, node_isolate));
 
     NODE_SET_METHOD(constructor, "now", Now);
+    NODE_SET_METHOD(constructor, "preciseNow", PreciseNow);
+
+    UpdateLoopTime();
+    Local<Object> loop_time_object = Object::New();
+    loop_time_object->SetIndexedPropertiesToExternalArrayData(
+        &loop_time,
+        v8::kExternalDoubleArray,
+        1);
+    constructor->Set(FIXED_ONE_BYTE_STRING(node_isolate, "loopTime"),
+                     loop_time_object);
 
     NODE_SET_PROTOTYPE_METHOD(constructor, "close", HandleWrap::Close);
     NODE_SET_PROTOTYPE_METHOD(constructor, "ref", HandleWrap::Ref);
@@ -64,6 +85,8 @@ class TimerWrap : public HandleWrap {
 
     target->Set(FIXED_ONE_BYTE_STRING(node_isolate, "Timer"),
                 constructor->GetFunction());
+
+    TimerWheel::Initialize(target);
   }
 
  private:
@@ -149,6 +172,15 @@ class TimerWrap : public HandleWrap {
     args.GetReturnValue().Set(now);
   }
 
+  // Brings the loop's time up to date first. Timers started afterwards are
+  // relative to the new time.
+  static void PreciseNow(const FunctionCallbackInfo<Value>& args) {
+    HandleScope scope(node_isolate);
+    uv_update_time(uv_default_loop());
+    UpdateLoopTime();
+    args.GetReturnValue().Set(loop_time);
+  }
+
   uv_timer_t handle_;
 };
 
@@ -65,6 +65,9 @@ class TLSCallbacks : public crypto::SSLWrap<TLSCallbacks>,
  protected:
   static const int kClearOutChunkSize = 1024;
 
+  // Maximum number of NodeBIO buffers sent with a single uv_write()
+  static const size_t kSimultaneousBufferCount = 16;
+
   // Write callback queue's item
   class WriteItem {
    public:
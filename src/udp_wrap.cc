@@ -26,10 +26,12 @@
 #include "req_wrap.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 
 namespace node {
 
+using v8::Array;
 using v8::Function;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
@@ -56,9 +58,30 @@ class SendWrap : public ReqWrap<uv_udp_send_t> {
 };
 
 
+// One request for a whole sendBatch() call. Every datagram gets its own
+// uv_udp_send_t, the first one is the embedded req_. JS is called back once
+// all of them have completed.
+class SendBatchWrap : public ReqWrap<uv_udp_send_t> {
+ public:
+  SendBatchWrap(Local<Object> req_wrap_obj, bool have_callback, size_t count);
+  ~SendBatchWrap();
+  inline uv_udp_send_t* req(size_t index);
+  inline bool have_callback() const;
+
+  size_t pending_;
+  int status_;
+
+ private:
+  const bool have_callback_;
+  uv_udp_send_t* extra_reqs_;
+};
+
+
 static Persistent<Function> constructor;
 static Cached<String> oncomplete_sym;
 static Cached<String> onmessage_sym;
+static Cached<String> onmessages_sym;
+static Cached<String> size_sym;
 
 
 SendWrap::SendWrap(Local<Object> req_wrap_obj, bool have_callback)
@@ -72,14 +95,49 @@ inline bool SendWrap::have_callback() const {
 }
 
 
+SendBatchWrap::SendBatchWrap(Local<Object> req_wrap_obj,
+                             bool have_callback,
+                             size_t count)
+    : ReqWrap<uv_udp_send_t>(req_wrap_obj)
+    , pending_(0)
+    , status_(0)
+    , have_callback_(have_callback)
+    , extra_reqs_(NULL) {
+  if (count > 1)
+    extra_reqs_ = new uv_udp_send_t[count - 1];
+}
+
+
+SendBatchWrap::~SendBatchWrap() {
+  delete[] extra_reqs_;
+}
+
+
+inline uv_udp_send_t* SendBatchWrap::req(size_t index) {
+  return index == 0 ? &req_ : &extra_reqs_[index - 1];
+}
+
+
+inline bool SendBatchWrap::have_callback() const {
+  return have_callback_;
+}
+
+
 UDPWrap::UDPWrap(Handle<Object> object)
-    : HandleWrap(object, reinterpret_cast<uv_handle_t*>(&handle_)) {
+    : HandleWrap(object, reinterpret_cast<uv_handle_t*>(&handle_))
+    , batch_(NULL)
+    , batch_count_(0)
+    , recv_batch_(1)
+    , batch_buf_(NULL)
+    , batch_buf_size_(0) {
   int r = uv_udp_init(uv_default_loop(), &handle_);
   assert(r == 0);  // can't fail anyway
 }
 
 
 UDPWrap::~UDPWrap() {
+  delete[] batch_;
+  free(batch_buf_);
 }
 
 
@@ -88,6 +146,8 @@ void UDPWrap::Initialize(Handle<Object> target) {
 
   oncomplete_sym = FIXED_ONE_BYTE_STRING(node_isolate, "oncomplete");
   onmessage_sym = FIXED_ONE_BYTE_STRING(node_isolate, "onmessage");
+  onmessages_sym = FIXED_ONE_BYTE_STRING(node_isolate, "onmessages");
+  size_sym = FIXED_ONE_BYTE_STRING(node_isolate, "size");
 
   Local<FunctionTemplate> t = FunctionTemplate::New(New);
   t->InstanceTemplate()->SetInternalFieldCount(1);
@@ -106,6 +166,9 @@ void UDPWrap::Initialize(Handle<Object> target) {
   NODE_SET_PROTOTYPE_METHOD(t, "send", Send);
   NODE_SET_PROTOTYPE_METHOD(t, "bind6", Bind6);
   NODE_SET_PROTOTYPE_METHOD(t, "send6", Send6);
+  NODE_SET_PROTOTYPE_METHOD(t, "sendBatch", SendBatch);
+  NODE_SET_PROTOTYPE_METHOD(t, "sendBatch6", SendBatch6);
+  NODE_SET_PROTOTYPE_METHOD(t, "setRecvBatch", SetRecvBatch);
   NODE_SET_PROTOTYPE_METHOD(t, "close", Close);
   NODE_SET_PROTOTYPE_METHOD(t, "recvStart", RecvStart);
   NODE_SET_PROTOTYPE_METHOD(t, "recvStop", RecvStop);
@@ -307,6 +370,125 @@ void UDPWrap::Send6(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+void UDPWrap::DoSendBatch(const FunctionCallbackInfo<Value>& args,
+                          int family) {
+  HandleScope scope(node_isolate);
+  int err = 0;
+
+  UDPWrap* wrap;
+  NODE_UNWRAP(args.This(), UDPWrap, wrap);
+
+  // sendBatch(req, buffers, ports, addresses, hasCallback)
+  assert(args[0]->IsObject());
+  assert(args[1]->IsArray());
+  assert(args[2]->IsArray());
+  assert(args[3]->IsArray());
+  assert(args[4]->IsBoolean());
+
+  Local<Object> req_wrap_obj = args[0].As<Object>();
+  Local<Array> buffers = args[1].As<Array>();
+  Local<Array> ports = args[2].As<Array>();
+  Local<Array> addresses = args[3].As<Array>();
+  const bool have_callback = args[4]->IsTrue();
+  const size_t count = buffers->Length();
+
+  assert(count > 0);
+  assert(ports->Length() == count);
+  assert(addresses->Length() == count);
+
+  SendBatchWrap* req_wrap = new SendBatchWrap(req_wrap_obj,
+                                              have_callback,
+                                              count);
+
+  // The datagrams are queued back to back. libuv hands them to the kernel in
+  // as few system calls as the platform allows.
+  for (size_t i = 0; i < count; i++) {
+    Local<Value> buffer_obj = buffers->Get(i);
+    assert(Buffer::HasInstance(buffer_obj));
+    const unsigned short port = ports->Get(i)->Uint32Value();
+    String::Utf8Value address(addresses->Get(i));
+
+    uv_buf_t buf = uv_buf_init(Buffer::Data(buffer_obj),
+                               Buffer::Length(buffer_obj));
+    uv_udp_send_t* req = req_wrap->req(i);
+    req->data = req_wrap;
+
+    switch (family) {
+    case AF_INET:
+      err = uv_udp_send(req,
+                        &wrap->handle_,
+                        &buf,
+                        1,
+                        uv_ip4_addr(*address, port),
+                        OnSendBatch);
+      break;
+    case AF_INET6:
+      err = uv_udp_send6(req,
+                         &wrap->handle_,
+                         &buf,
+                         1,
+                         uv_ip6_addr(*address, port),
+                         OnSendBatch);
+      break;
+    default:
+      assert(0 && "unexpected address family");
+      abort();
+    }
+
+    if (err)
+      break;
+
+    req_wrap->pending_++;
+  }
+
+  req_wrap->Dispatched();
+
+  if (req_wrap->pending_ == 0) {
+    delete req_wrap;
+  } else if (err) {
+    // Part of the batch is in flight, report the error when that completes.
+    req_wrap->status_ = err;
+    err = 0;
+  }
+
+  args.GetReturnValue().Set(err);
+}
+
+
+void UDPWrap::SendBatch(const FunctionCallbackInfo<Value>& args) {
+  DoSendBatch(args, AF_INET);
+}
+
+
+void UDPWrap::SendBatch6(const FunctionCallbackInfo<Value>& args) {
+  DoSendBatch(args, AF_INET6);
+}
+
+
+void UDPWrap::SetRecvBatch(const FunctionCallbackInfo<Value>& args) {
+  HandleScope scope(node_isolate);
+  UDPWrap* wrap;
+  NODE_UNWRAP(args.This(), UDPWrap, wrap);
+
+  assert(args.Length() == 1);
+  unsigned int count = args[0]->Uint32Value();
+
+  int err = uv_udp_set_recv_batch(&wrap->handle_, count);
+  if (err == 0) {
+    wrap->recv_batch_ = count > 1 ? count : 1;
+    if (wrap->recv_batch_ > 1 && wrap->batch_ == NULL)
+      wrap->batch_ = new Datagram[kMaxRecvBatch];
+  }
+
+  // Batching is an optimization. Where it's not supported, datagrams are
+  // simply read one at a time.
+  if (err == UV_ENOSYS)
+    err = 0;
+
+  args.GetReturnValue().Set(err);
+}
+
+
 void UDPWrap::RecvStart(const FunctionCallbackInfo<Value>& args) {
   HandleScope scope(node_isolate);
   UDPWrap* wrap;
@@ -365,7 +547,44 @@ void UDPWrap::OnSend(uv_udp_send_t* req, int status) {
 }
 
 
+void UDPWrap::OnSendBatch(uv_udp_send_t* req, int status) {
+  SendBatchWrap* req_wrap = static_cast<SendBatchWrap*>(req->data);
+
+  if (status != 0 && req_wrap->status_ == 0)
+    req_wrap->status_ = status;
+
+  assert(req_wrap->pending_ > 0);
+  if (--req_wrap->pending_ > 0)
+    return;
+
+  if (req_wrap->have_callback()) {
+    HandleScope scope(node_isolate);
+    Local<Object> req_wrap_obj = req_wrap->object();
+    Local<Value> arg = Integer::New(req_wrap->status_, node_isolate);
+    MakeCallback(req_wrap_obj, oncomplete_sym, 1, &arg);
+  }
+  delete req_wrap;
+}
+
+
 uv_buf_t UDPWrap::OnAlloc(uv_handle_t* handle, size_t suggested_size) {
+  UDPWrap* wrap = static_cast<UDPWrap*>(handle->data);
+
+  // Batched reads always use the same buffer. The datagrams are copied out
+  // before libuv hands it back.
+  if (wrap->recv_batch_ > 1) {
+    if (wrap->batch_buf_size_ < suggested_size) {
+      free(wrap->batch_buf_);
+      wrap->batch_buf_ = static_cast<char*>(malloc(suggested_size));
+      if (wrap->batch_buf_ == NULL) {
+        FatalError("node::UDPWrap::OnAlloc(uv_handle_t*, size_t)",
+                   "Out Of Memory");
+      }
+      wrap->batch_buf_size_ = suggested_size;
+    }
+    return uv_buf_init(wrap->batch_buf_, wrap->batch_buf_size_);
+  }
+
   char* data = static_cast<char*>(malloc(suggested_size));
   if (data == NULL && suggested_size > 0) {
     FatalError("node::UDPWrap::OnAlloc(uv_handle_t*, size_t)",
@@ -380,14 +599,22 @@ void UDPWrap::OnRecv(uv_udp_t* handle,
                      uv_buf_t buf,
                      struct sockaddr* addr,
                      unsigned flags) {
+  UDPWrap* wrap = static_cast<UDPWrap*>(handle->data);
+  const bool is_batch_buf = buf.base != NULL && buf.base == wrap->batch_buf_;
+
+  if (flags & UV_UDP_MMSG_CHUNK) {
+    wrap->QueueDatagram(buf.base, nread, addr);
+    return;
+  }
+
   if (nread == 0) {
-    if (buf.base != NULL)
+    if (is_batch_buf)
+      wrap->FlushDatagrams();
+    else if (buf.base != NULL)
       free(buf.base);
     return;
   }
 
-  UDPWrap* wrap = static_cast<UDPWrap*>(handle->data);
-
   HandleScope scope(node_isolate);
   Local<Object> wrap_obj = wrap->object();
   Local<Value> argv[] = {
@@ -398,7 +625,7 @@ void UDPWrap::OnRecv(uv_udp_t* handle,
   };
 
   if (nread < 0) {
-    if (buf.base != NULL)
+    if (buf.base != NULL && !is_batch_buf)
       free(buf.base);
     MakeCallback(wrap_obj, onmessage_sym, ARRAY_SIZE(argv), argv);
     return;
@@ -412,6 +639,62 @@ void UDPWrap::OnRecv(uv_udp_t* handle,
 }
 
 
+void UDPWrap::QueueDatagram(const char* data,
+                            size_t length,
+                            const sockaddr* addr) {
+  assert(batch_ != NULL);
+  assert(batch_count_ < kMaxRecvBatch);
+
+  Datagram* dgram = &batch_[batch_count_++];
+  dgram->data = data;
+  dgram->length = length;
+  memcpy(&dgram->address,
+         addr,
+         addr->sa_family == AF_INET6 ? sizeof(sockaddr_in6) :
+                                       sizeof(sockaddr_in));
+}
+
+
+// Copies the queued datagrams into a single buffer and calls
+// onmessages(handle, buffer, rinfos) once. The JS side slices the buffer
+// up again using rinfo.size.
+void UDPWrap::FlushDatagrams() {
+  if (batch_count_ == 0)
+    return;
+
+  HandleScope scope(node_isolate);
+
+  size_t total = 0;
+  for (unsigned int i = 0; i < batch_count_; i++)
+    total += batch_[i].length;
+
+  Local<Object> buffer = Buffer::New(total);
+  Local<Array> rinfos = Array::New(batch_count_);
+  char* data = Buffer::Data(buffer);
+
+  for (unsigned int i = 0; i < batch_count_; i++) {
+    const Datagram* dgram = &batch_[i];
+    memcpy(data, dgram->data, dgram->length);
+    data += dgram->length;
+
+    const sockaddr* addr = reinterpret_cast<const sockaddr*>(&dgram->address);
+    Local<Object> rinfo = AddressToJS(addr);
+    rinfo->Set(size_sym, Integer::NewFromUnsigned(dgram->length, node_isolate));
+    rinfos->Set(i, rinfo);
+  }
+
+  batch_count_ = 0;
+
+  Local<Object> wrap_obj = object();
+  Local<Value> argv[] = {
+    wrap_obj,
+    buffer,
+    rinfos
+  };
+  MakeCallback(wrap_obj, onmessages_sym, ARRAY_SIZE(argv), argv);
+}
+
+
 UDPWrap* UDPWrap::Unwrap(Local<Object> obj) {
   UDPWrap* wrap;
   NODE_UNWRAP(obj, UDPWrap, wrap);
@@ -38,6 +38,9 @@ class UDPWrap: public HandleWrap {
   static void Send(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Bind6(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Send6(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SendBatch(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SendBatch6(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SetRecvBatch(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void RecvStart(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void RecvStop(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void GetSockName(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -54,6 +57,15 @@ class UDPWrap: public HandleWrap {
   uv_udp_t* UVHandle();
 
  private:
+  // Matches the maximum batch size of uv_udp_set_recv_batch().
+  static const unsigned int kMaxRecvBatch = 64;
+
+  struct Datagram {
+    const char* data;
+    size_t length;
+    struct sockaddr_storage address;
+  };
+
   explicit UDPWrap(v8::Handle<v8::Object> object);
   virtual ~UDPWrap();
 
@@ -61,17 +73,31 @@ class UDPWrap: public HandleWrap {
                      int family);
   static void DoSend(const v8::FunctionCallbackInfo<v8::Value>& args,
                      int family);
+  static void DoSendBatch(const v8::FunctionCallbackInfo<v8::Value>& args,
+                          int family);
   static void SetMembership(const v8::FunctionCallbackInfo<v8::Value>& args,
                             uv_membership membership);
 
   static uv_buf_t OnAlloc(uv_handle_t* handle, size_t suggested_size);
   static void OnSend(uv_udp_send_t* req, int status);
+  static void OnSendBatch(uv_udp_send_t* req, int status);
   static void OnRecv(uv_udp_t* handle,
                      ssize_t nread,
                      uv_buf_t buf,
                      struct sockaddr* addr,
                      unsigned flags);
 
+  void QueueDatagram(const char* data, size_t length, const sockaddr* addr);
+  void FlushDatagrams();
+
+  // Datagrams from the current recvmmsg() batch, delivered to JS in one go
+  // once libuv hands back the batch buffer.
+  Datagram* batch_;
+  unsigned int batch_count_;
+  unsigned int recv_batch_;
+  char* batch_buf_;
+  size_t batch_buf_size_;
+
   uv_udp_t handle_;
 };
 
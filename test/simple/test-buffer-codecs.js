@@ -0,0 +1,137 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Checks the vectorized base64, hex, ASCII and UTF-8 paths against simple
+// reference implementations, for lengths and offsets around the block sizes.
+
+var common = require('../common');
+var assert = require('assert');
+
+var alphabet = 'ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/';
+
+function refBase64(buf) {
+  var s = '';
+  for (var i = 0; i < buf.length; i += 3) {
+    var n = buf[i] << 16 | (buf[i + 1] | 0) << 8 | (buf[i + 2] | 0);
+    s += alphabet[n >> 18] + alphabet[n >> 12 & 63];
+    s += i + 1 < buf.length ? alphabet[n >> 6 & 63] : '=';
+    s += i + 2 < buf.length ? alphabet[n & 63] : '=';
+  }
+  return s;
+}
+
+function refHex(buf) {
+  var s = '';
+  for (var i = 0; i < buf.length; i++)
+    s += (buf[i] < 16 ? '0' : '') + buf[i].toString(16);
+  return s;
+}
+
+function random(len) {
+  var buf = new Buffer(len);
+  for (var i = 0; i < len; i++)
+    buf[i] = Math.random() * 256;
+  return buf;
+}
+
+var big = random(1024);
+
+for (var len = 0; len < 100; len++) {
+  for (var offset = 0; offset < 4; offset++) {
+    var buf = big.slice(offset, offset + len);
+    var b64 = buf.toString('base64');
+    var hex = buf.toString('hex');
+
+    assert.equal(b64, refBase64(buf));
+    assert.equal(hex, refHex(buf));
+    assert.deepEqual(new Buffer(b64, 'base64'), buf);
+    assert.deepEqual(new Buffer(hex, 'hex'), buf);
+    assert.deepEqual(new Buffer(hex.toUpperCase(), 'hex'), buf);
+
+    // URL-safe alphabet.
+    var url = b64.replace(/\+/g, '-').replace(/\//g, '_');
+    assert.deepEqual(new Buffer(url, 'base64'), buf);
+
+    // Characters outside the alphabet are skipped, also in two-byte strings.
+    // The size estimate counts them so slice off the extra bytes.
+    var junk = '\u1200' + b64.slice(0, 20) + '\u1200' + b64.slice(20);
+    assert.deepEqual(new Buffer(junk, 'base64').slice(0, len), buf);
+
+    // Whitespace is skipped.
+    var wrapped = b64.replace(/(.{7})/g, '$1\n');
+    assert.deepEqual(new Buffer(wrapped, 'base64'), buf);
+
+    var ascii = '';
+    for (var i = 0; i < len; i++)
+      ascii += String.fromCharCode(buf[i] & 0x7f);
+    assert.equal(buf.toString('ascii'), ascii);
+
+    // Pure ASCII is decoded as-is, a single high byte anywhere is not.
+    var plain = new Buffer(ascii, 'binary');
+    assert.equal(plain.toString('utf8'), ascii);
+    if (len > 0) {
+      var pos = offset * 17 % len;
+      plain[pos] = 0xe9;
+      var utf8 = plain.toString('utf8');
+      assert.equal(utf8[pos], '�');
+      assert.equal(utf8.length, len);
+    }
+  }
+}
+
+// Hex decoding stops at the first bad digit.
+var hex = refHex(big.slice(0, 40));
+for (var pos = 0; pos < hex.length; pos += 7) {
+  var bad = hex.slice(0, pos) + 'g' + hex.slice(pos + 1);
+  var out = new Buffer(bad, 'hex');
+  assert.equal(out.length, pos >> 1);
+  assert.deepEqual(out, big.slice(0, pos >> 1));
+}
+
+// Writing into a buffer doesn't touch the bytes after the decoded data.
+var b64 = big.slice(0, 48).toString('base64');
+var target = new Buffer(64);
+target.fill(0xaa);
+assert.equal(target.write(b64.slice(0, 32), 0, 'base64'), 24);
+assert.deepEqual(target.slice(0, 24), big.slice(0, 24));
+for (var i = 24; i < 64; i++)
+  assert.equal(target[i], 0xaa);
+
+// Buffer.byteLength() on large (external) one-byte strings.
+var latin1 = new Buffer(1024 * 1024);
+latin1.fill('a');
+latin1[4242] = 0xe9;
+latin1[latin1.length - 1] = 0xff;
+var str = latin1.toString('binary');
+assert.equal(Buffer.byteLength(str, 'utf8'), latin1.length + 2);
+assert.equal(new Buffer(str, 'utf8').length, latin1.length + 2);
+
+latin1.fill('a');
+str = latin1.toString('ascii');
+assert.equal(Buffer.byteLength(str, 'utf8'), latin1.length);
+assert.deepEqual(new Buffer(str, 'utf8'), latin1);
+assert.equal(latin1.toString('utf8'), str);
+
+// Large strings are external and decoded straight from their bytes.
+var large = random(1024 * 1024 + 7);
+assert.deepEqual(new Buffer(large.toString('base64'), 'base64'), large);
+assert.deepEqual(new Buffer(large.toString('hex'), 'hex'), large);
@@ -0,0 +1,93 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+var common = require('../common');
+var assert = require('assert');
+var fork = require('child_process').fork;
+var net = require('net');
+
+var SMALL = 1000;
+
+if (process.argv[2] === 'child') {
+  assert.equal(process.env.NODE_CHANNEL_SERIALIZATION, undefined);
+
+  process.on('message', function(m, handle) {
+    if (m === 'server') {
+      assert(handle instanceof net.Server);
+      handle.close();
+      process.send({ gotServer: true });
+      return;
+    }
+    // Echo everything else back, Buffers included.
+    process.send(m);
+  });
+  return;
+}
+
+var child = fork(__filename, ['child'], { serialization: 'binary' });
+
+var big = new Buffer(1024 * 1024 + 7);
+for (var i = 0; i < big.length; i++) big[i] = i % 251;
+
+var expected = [{ hello: 'world' }, 'a string', new Buffer('buf'), big];
+for (var i = 0; i < SMALL; i++) expected.push({ n: i, s: 'é中' });
+
+var received = [];
+var gotServer = false;
+
+child.on('message', function(m) {
+  if (m && m.gotServer) {
+    gotServer = true;
+    child.disconnect();
+    return;
+  }
+
+  received.push(m);
+  if (received.length !== expected.length) return;
+
+  expected.forEach(function(e, i) {
+    if (Buffer.isBuffer(e)) {
+      assert(Buffer.isBuffer(received[i]));
+      assert.equal(received[i].toString('hex'), e.toString('hex'));
+    } else {
+      assert.deepEqual(received[i], e);
+    }
+  });
+
+  // Handle passing still works with framed messages around it.
+  var server = net.createServer().listen(common.PORT, function() {
+    child.send({ before: true });
+    child.send('server', server);
+    server.close();
+  });
+});
+
+// All of these go out in the same tick.
+expected.forEach(function(m) {
+  child.send(m);
+});
+
+process.on('exit', function() {
+  assert.equal(received.length, expected.length + 1);
+  assert.deepEqual(received[expected.length], { before: true });
+  assert(gotServer);
+});
@@ -0,0 +1,47 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+var common = require('../common');
+var assert = require('assert');
+var cluster = require('cluster');
+var net = require('net');
+
+if (cluster.isMaster) {
+  cluster.schedulingPolicy = cluster.SCHED_REUSEPORT;
+  // Hog the TCP port without SO_REUSEPORT so that binding fails.
+  net.createServer(assert.fail).listen(common.PORT, function() {
+    var server = this;
+    var worker = cluster.fork();
+    worker.on('exit', common.mustCall(function(exitCode) {
+      assert.equal(exitCode, 0);
+      server.close();
+    }));
+  });
+}
+else {
+  var s = net.createServer(assert.fail);
+  s.listen(common.PORT, assert.fail.bind(null, 'listen should have failed'));
+  s.on('error', common.mustCall(function(err) {
+    assert.equal(err.code, 'EADDRINUSE');
+    process.disconnect();
+  }));
+}
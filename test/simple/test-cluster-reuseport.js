@@ -0,0 +1,78 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+var common = require('../common');
+var assert = require('assert');
+var cluster = require('cluster');
+var net = require('net');
+
+var WORKERS = 2;
+var CONNECTIONS = 64;
+
+if (cluster.isMaster) {
+  cluster.schedulingPolicy = cluster.SCHED_REUSEPORT;
+
+  var ports = [];
+  var workers = [];
+  for (var i = 0; i < WORKERS; i++)
+    workers.push(cluster.fork());
+
+  cluster.on('listening', function(worker, address) {
+    ports.push(address.port);
+    if (ports.length < WORKERS)
+      return;
+    // listen(0) must resolve to the same port in all workers.
+    assert.equal(ports[0], ports[1]);
+    connect(ports[0]);
+  });
+
+  var served = {};
+  var done = 0;
+
+  function connect(port) {
+    for (var i = 0; i < CONNECTIONS; i++) {
+      net.connect(port, function() {
+        var id = '';
+        this.setEncoding('utf8');
+        this.on('data', function(data) { id += data; });
+        this.on('end', function() {
+          served[id] = (served[id] | 0) + 1;
+          if (++done === CONNECTIONS)
+            workers.forEach(function(w) { w.disconnect(); });
+        });
+      });
+    }
+  }
+
+  process.on('exit', function() {
+    assert.equal(done, CONNECTIONS);
+    // The kernel hashes connections over the listeners, with this many
+    // connections every worker gets some. The round-robin fallback on
+    // older kernels and other platforms does too.
+    assert.equal(Object.keys(served).length, WORKERS);
+  });
+}
+else {
+  net.createServer(function(conn) {
+    conn.end(String(cluster.worker.id));
+  }).listen(0);
+}
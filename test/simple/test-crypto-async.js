@@ -0,0 +1,147 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+var common = require('../common');
+var assert = require('assert');
+
+try {
+  var crypto = require('crypto');
+} catch (e) {
+  console.log('Not compiled with OPENSSL support.');
+  process.exit();
+}
+
+crypto.DEFAULT_ENCODING = 'buffer';
+
+var fs = require('fs');
+
+var certPem = fs.readFileSync(common.fixturesDir + '/test_cert.pem', 'ascii');
+var keyPem = fs.readFileSync(common.fixturesDir + '/test_key.pem', 'ascii');
+var rsaPubPem = fs.readFileSync(common.fixturesDir + '/test_rsa_pubkey.pem',
+    'ascii');
+var rsaKeyPem = fs.readFileSync(common.fixturesDir + '/test_rsa_privkey.pem',
+    'ascii');
+
+var pending = 0;
+function expect(fn) {
+  pending++;
+  return function() {
+    pending--;
+    return fn.apply(this, arguments);
+  };
+}
+
+process.on('exit', function() {
+  assert.equal(pending, 0);
+});
+
+// Sign on the thread pool, the signature matches the synchronous one.
+var expected = crypto.createSign('RSA-SHA256')
+                     .update('Test123')
+                     .sign(keyPem, 'hex');
+
+crypto.createSign('RSA-SHA256')
+      .update('Test123')
+      .sign(keyPem, 'hex', expect(function(err, sig) {
+  assert.ifError(err);
+  assert.equal(sig, expected);
+
+  crypto.createVerify('RSA-SHA256')
+        .update('Test123')
+        .verify(certPem, sig, 'hex', expect(function(err, verified) {
+    assert.ifError(err);
+    assert.strictEqual(verified, true);
+  }));
+
+  crypto.createVerify('RSA-SHA256')
+        .update('Test124')
+        .verify(certPem, sig, 'hex', expect(function(err, verified) {
+    assert.ifError(err);
+    assert.strictEqual(verified, false);
+  }));
+}));
+
+// Without an encoding the callback gets a buffer.
+crypto.createSign('RSA-SHA1')
+      .update('Test123')
+      .sign(rsaKeyPem, expect(function(err, sig) {
+  assert.ifError(err);
+  assert(Buffer.isBuffer(sig));
+
+  crypto.createVerify('RSA-SHA1')
+        .update('Test123')
+        .verify(rsaPubPem, sig, expect(function(err, verified) {
+    assert.ifError(err);
+    assert.strictEqual(verified, true);
+  }));
+}));
+
+// The object can't be used again once the job is queued.
+var sign = crypto.createSign('RSA-SHA1');
+sign.update('Test123');
+sign.sign(rsaKeyPem, expect(function(err, sig) {
+  assert.ifError(err);
+}));
+sign.sign(rsaKeyPem, expect(function(err, sig) {
+  assert(/not initialised/.test(err.message));
+}));
+
+// Errors are passed to the callback.
+crypto.createSign('RSA-SHA1')
+      .update('Test123')
+      .sign('not a key', expect(function(err, sig) {
+  assert(err instanceof Error);
+  assert.equal(sig, undefined);
+}));
+
+crypto.createVerify('RSA-SHA1')
+      .update('Test123')
+      .verify('not a key', 'sig', expect(function(err, verified) {
+  assert(err instanceof Error);
+}));
+
+// Diffie-Hellman key exchange, one side sync and the other async.
+var dh1 = crypto.getDiffieHellman('modp1');
+var dh2 = crypto.getDiffieHellman('modp1');
+dh1.generateKeys();
+
+dh2.generateKeys('hex', expect(function(err, key2) {
+  assert.ifError(err);
+  assert.equal(key2, dh2.getPublicKey('hex'));
+  assert(dh2.getPrivateKey().length > 0);
+
+  var secret1 = dh1.computeSecret(key2, 'hex', 'base64');
+  dh2.computeSecret(dh1.getPublicKey(), expect(function(err, secret2) {
+    assert.ifError(err);
+    assert.equal(secret2.toString('base64'), secret1);
+  }));
+
+  dh2.computeSecret(dh1.getPublicKey('hex'), 'hex', 'base64',
+                    expect(function(err, secret2) {
+    assert.ifError(err);
+    assert.equal(secret2, secret1);
+  }));
+
+  dh2.computeSecret(new Buffer([0]), expect(function(err, secret) {
+    assert(/too small/.test(err.message));
+  }));
+}));
@@ -0,0 +1,107 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+var common = require('../common');
+var assert = require('assert');
+var dgram = require('dgram');
+
+var N = 24;
+var received = [];
+var callbacks = 0;
+
+var server = dgram.createSocket('udp4');
+var client = dgram.createSocket('udp4');
+
+server.on('message', function(buf, rinfo) {
+  assert.equal(rinfo.size, buf.length);
+  assert.equal(rinfo.address, '127.0.0.1');
+  received.push(buf.toString());
+
+  if (received.length === N) {
+    server.close();
+    client.close();
+  }
+});
+
+server.on('listening', function() {
+  server.setRecvBatch(8);
+
+  var messages = [];
+  for (var i = 0; i < 10; i++)
+    messages.push(new Buffer('msg' + i));
+
+  // One destination for all buffers...
+  client.sendBatch(messages, common.PORT, '127.0.0.1', function(err) {
+    assert.ifError(err);
+    callbacks++;
+
+    // ...and one destination per message.
+    var objects = [];
+    for (var i = 10; i < 20; i++)
+      objects.push({
+        buffer: new Buffer('msg' + i),
+        port: common.PORT,
+        address: 'localhost'
+      });
+    client.sendBatch(objects, function(err) {
+      assert.ifError(err);
+      callbacks++;
+
+      // Without an address they go to this host, like send().
+      client.sendBatch([new Buffer('msg20'), new Buffer('msg21')],
+                       common.PORT,
+                       function(err) {
+        assert.ifError(err);
+        callbacks++;
+      });
+      client.sendBatch([{ buffer: new Buffer('msg22'), port: common.PORT },
+                        { buffer: new Buffer('msg23'),
+                          port: common.PORT,
+                          address: undefined }],
+                       function(err) {
+        assert.ifError(err);
+        callbacks++;
+      });
+    });
+  });
+});
+
+server.bind(common.PORT);
+
+assert.throws(function() {
+  client.sendBatch('not an array', common.PORT, '127.0.0.1');
+}, TypeError);
+
+assert.throws(function() {
+  client.sendBatch([new Buffer('x')], 0, '127.0.0.1');
+}, RangeError);
+
+assert.throws(function() {
+  server.setRecvBatch(100);
+});
+
+process.on('exit', function() {
+  assert.equal(callbacks, 4);
+  assert.equal(received.length, N);
+  received.sort(function(a, b) { return a.slice(3) - b.slice(3); });
+  for (var i = 0; i < N; i++)
+    assert.equal(received[i], 'msg' + i);
+});
@@ -0,0 +1,234 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// The lookup cache, negative caching, coalescing of concurrent lookups and
+// record TTLs of resolve4(), against a stand-in for the resolver so that
+// the answers and the timing are known.
+
+var common = require('../common');
+var assert = require('assert');
+var domain = require('domain');
+var cares = process.binding('cares_wrap');
+var uv = process.binding('uv');
+
+var queries = [];
+cares.getaddrinfo = function(req, name, family) {
+  queries.push(name);
+  setTimeout(function() {
+    if (name === 'missing.example')
+      req.oncomplete(uv.UV_EAI_NONAME);
+    else if (name === 'broken.example')
+      req.oncomplete(uv.UV_EAI_AGAIN);
+    else
+      req.oncomplete(0, ['10.0.0.' + queries.length]);
+  }, 10);
+  return 0;
+};
+cares.queryA = function(req, name) {
+  queries.push(name);
+  setTimeout(function() {
+    req.oncomplete(0, ['10.1.0.1', '10.1.0.2'], 1);
+  }, 10);
+  return 0;
+};
+
+// Counts since the current test started.
+var baseline;
+// resolve4() holds on to the binding function it was created with.
+var dns = require('dns');
+
+function stats(hits, misses, coalesced) {
+  var s = dns.getCacheStats();
+  assert.deepEqual([s.hits - baseline.hits,
+                    s.misses - baseline.misses,
+                    s.coalesced - baseline.coalesced],
+                   [hits, misses, coalesced]);
+}
+
+var tests = [coalesce, cached, negative, throwing, records];
+
+function next() {
+  queries = [];
+  dns.clearCache();
+  baseline = dns.getCacheStats();
+  var test = tests.shift();
+  if (test) test();
+}
+
+// Without a cache, lookups that overlap share one query. Each callback runs
+// in the domain its lookup was made in, or in none, and gets its own error
+// object.
+function coalesce() {
+  var d1 = domain.create();
+  var d2 = domain.create();
+  var results = [];
+  function done(d) {
+    return function(err, address, family) {
+      assert.strictEqual(process.domain, d);
+      results.push(address + '/' + family);
+      if (results.length === 3) {
+        assert.deepEqual(results, ['10.0.0.1/4', '10.0.0.1/4', '10.0.0.1/4']);
+        assert.deepEqual(queries, ['a.example']);
+        stats(0, 1, 2);
+        assert.equal(dns.getCacheStats().entries, 0);
+        setImmediate(afterwards);
+      }
+    };
+  }
+  d1.run(function() { dns.lookup('a.example', done(d1)); });
+  d2.run(function() { dns.lookup('a.example', done(d2)); });
+  dns.lookup('a.example', done(undefined));
+
+  // Nothing was cached, this is a query of its own.
+  function afterwards() {
+    dns.lookup('a.example', function(err, address) {
+      assert.equal(address, '10.0.0.2');
+      var errors = [];
+      dns.lookup('broken.example', function(err) { errors.push(err); });
+      dns.lookup('broken.example', function(err) {
+        errors.push(err);
+        assert.notStrictEqual(errors[0], errors[1]);
+        assert.equal(errors[1].code, 'EAI_AGAIN');
+        next();
+      });
+    });
+  }
+}
+
+function cached() {
+  dns.setCacheOptions({ ttl: 100 });
+  dns.lookup('b.example', function(err, address) {
+    assert.equal(address, '10.0.0.1');
+    dns.lookup('b.example', 4, function(err, address) {
+      // Another family is another entry.
+      assert.equal(address, '10.0.0.2');
+      dns.lookup('b.example', function(err, address, family) {
+        assert.equal(address, '10.0.0.1');
+        assert.equal(family, 4);
+        stats(1, 2, 0);
+        assert.equal(dns.getCacheStats().entries, 2);
+        setTimeout(function() {
+          dns.lookup('b.example', function(err, address) {
+            assert.equal(address, '10.0.0.3');
+            next();
+          });
+        }, 150);
+      });
+    });
+  });
+}
+
+// Names that don't exist are remembered for negativeTtl, other errors
+// aren't remembered at all.
+function negative() {
+  dns.setCacheOptions({ negativeTtl: 100 });
+  dns.lookup('missing.example', function(err) {
+    assert.equal(err.code, 'ENOTFOUND');
+    dns.lookup('missing.example', function(err2) {
+      assert.equal(err2.code, 'ENOTFOUND');
+      assert.notStrictEqual(err, err2);
+      dns.lookup('broken.example', function(err) {
+        dns.lookup('broken.example', function(err) {
+          assert.deepEqual(queries, ['missing.example',
+                                     'broken.example',
+                                     'broken.example']);
+          next();
+        });
+      });
+    });
+  });
+}
+
+// A callback that throws doesn't keep the others from their answer, and
+// what it throws goes to its own domain, not to the one of the lookup that
+// made the query.
+function throwing() {
+  var a = domain.create();
+  var b = domain.create();
+  var caught = { a: 0, b: 0, process: 0 };
+  a.on('error', function(err) {
+    caught.a++;
+  });
+  b.on('error', function(err) {
+    assert.equal(err.message, 'from b');
+    caught.b++;
+  });
+  process.once('uncaughtException', function(err) {
+    assert.equal(err.message, 'from no domain');
+    caught.process++;
+  });
+
+  a.run(function() {
+    dns.lookup('c.example', function() {
+      assert.equal(process.domain, a);
+    });
+  });
+  b.run(function() {
+    dns.lookup('c.example', function() {
+      assert.equal(process.domain, b);
+      throw new Error('from b');
+    });
+  });
+  dns.lookup('c.example', function() {
+    assert.strictEqual(process.domain, undefined);
+    throw new Error('from no domain');
+  });
+  dns.lookup('c.example', function(err, address) {
+    assert.strictEqual(process.domain, undefined);
+    assert.equal(address, '10.0.0.1');
+    assert.deepEqual(caught, { a: 0, b: 1, process: 1 });
+    next();
+  });
+}
+
+
+// Records are kept for their TTL, one second here, or the cache's TTL if
+// that is shorter.
+function records() {
+  dns.setCacheOptions({ ttl: 60000 });
+  dns.resolve4('d.example', function(err, addresses) {
+    assert.deepEqual(addresses, ['10.1.0.1', '10.1.0.2']);
+    addresses.pop();
+    dns.resolve4('d.example', function(err, addresses) {
+      assert.deepEqual(addresses, ['10.1.0.1', '10.1.0.2']);
+      assert.deepEqual(queries, ['d.example']);
+      setTimeout(function() {
+        dns.resolve4('d.example', function(err, addresses) {
+          assert.deepEqual(queries, ['d.example', 'd.example']);
+          dns.setCacheOptions({ ttl: 0, negativeTtl: 0 });
+          assert.equal(dns.getCacheStats().entries, 0);
+          next();
+        });
+      }, 1100);
+    });
+  });
+}
+
+assert.throws(function() {
+  dns.setCacheOptions({ ttl: -1 });
+}, TypeError);
+
+process.on('exit', function() {
+  assert.equal(tests.length, 0);
+});
+
+next();
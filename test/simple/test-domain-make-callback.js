@@ -0,0 +1,100 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Callbacks from C++ on an object that belongs to a domain run inside it,
+// get their arguments and `this`, and leave the domain stack the way it was.
+// A disposed domain gets no callbacks. process.domain is a plain property.
+
+var common = require('../common');
+var assert = require('assert');
+var domain = require('domain');
+var Timer = process.binding('timer_wrap').Timer;
+
+var calls = 0;
+var d = domain.create();
+var timer = new Timer();
+timer.domain = d;
+timer[0] = function() {
+  assert.equal(this, timer);
+  assert.equal(arguments.length, 1);
+  assert.equal(process.domain, d);
+  assert.equal(domain.active, d);
+  assert.equal(domain._stack.length, 1);
+  calls++;
+  timer.close();
+};
+assert.equal(process.domain, undefined);
+timer.start(1, 0);
+
+// Anything scheduled from the callback would be bound to the domain.
+var poll = setInterval(function() {
+  if (calls === 0) return;
+  clearInterval(poll);
+  afterCall();
+}, 1);
+
+function afterCall() {
+  assert.equal(process.domain, undefined);
+  assert.equal(domain._stack.length, 0);
+
+  var disposed = domain.create();
+  var t = new Timer();
+  t.domain = disposed;
+  t[0] = function() {
+    assert.fail('disposed domain entered');
+  };
+  disposed.dispose();
+  t.start(1, 0);
+  setTimeout(function() {
+    t.close();
+    throwing();
+  }, 50);
+}
+
+// An error thrown from the callback goes to the domain.
+function throwing() {
+  var errors = 0;
+  var d = domain.create();
+  d.on('error', function(err) {
+    assert.equal(err.message, 'from the callback');
+    errors++;
+    t.close();
+  });
+  var t = new Timer();
+  t.domain = d;
+  t[0] = function() {
+    throw new Error('from the callback');
+  };
+  t.start(1, 0);
+
+  process.on('exit', function() {
+    assert.equal(errors, 1);
+  });
+}
+
+process.domain = 42;
+assert.equal(process.domain, 42);
+process.domain = undefined;
+
+process.on('exit', function() {
+  assert.equal(calls, 1);
+});
@@ -0,0 +1,122 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+var common = require('../common');
+var assert = require('assert');
+var fs = require('fs');
+var path = require('path');
+
+var file = path.join(common.fixturesDir, 'a.js');
+var dir = common.fixturesDir;
+var missing = path.join(common.fixturesDir, 'does-not-exist');
+var link = path.join(common.tmpDir, 'stat-many-link');
+
+try { fs.unlinkSync(link); } catch (e) {}
+fs.symlinkSync(file, link);
+
+function checkStats(actual, expected) {
+  assert.ok(actual instanceof fs.Stats);
+  Object.keys(expected).forEach(function(k) {
+    if (expected[k] instanceof Date)
+      assert.equal(actual[k].getTime(), expected[k].getTime(), k);
+    else
+      assert.strictEqual(actual[k], expected[k], k);
+  });
+}
+
+function checkError(actual, fn) {
+  assert.throws(fn, function(expected) {
+    assert.ok(actual instanceof Error);
+    assert.equal(actual.message, expected.message);
+    assert.equal(actual.code, expected.code);
+    assert.equal(actual.errno, expected.errno);
+    assert.equal(actual.path, expected.path);
+    assert.equal(actual.syscall, expected.syscall);
+    return true;
+  });
+}
+
+function check(list, lstat) {
+  assert.ok(list instanceof fs.StatsList);
+  assert.equal(list.length, 4);
+
+  assert.ok(list.exists(0));
+  assert.ok(list.isFile(0));
+  assert.ok(!list.isDirectory(0));
+  assert.equal(list.error(0), null);
+  checkStats(list.get(0), fs.statSync(file));
+  assert.equal(list.size(0), fs.statSync(file).size);
+  assert.equal(list.mtime(0), fs.statSync(file).mtime.getTime());
+
+  assert.ok(list.isDirectory(1));
+  checkStats(list.get(1), fs.statSync(dir));
+
+  assert.ok(!list.exists(2));
+  assert.ok(!list.isFile(2));
+  assert.ok(!list.isDirectory(2));
+  assert.equal(list.get(2), null);
+  assert.ok(isNaN(list.size(2)));
+  checkError(list.error(2), function() {
+    lstat ? fs.lstatSync(missing) : fs.statSync(missing);
+  });
+
+  if (lstat) {
+    assert.ok(list.isSymbolicLink(3));
+    checkStats(list.get(3), fs.lstatSync(link));
+  } else {
+    assert.ok(list.isFile(3));
+    checkStats(list.get(3), fs.statSync(link));
+  }
+}
+
+var paths = [file, dir, missing, link];
+check(fs.statManySync(paths), false);
+check(fs.lstatManySync(paths), true);
+assert.equal(fs.statManySync([]).length, 0);
+
+var done = 0;
+fs.statMany(paths, function(err, list) {
+  assert.ifError(err);
+  check(list, false);
+  done++;
+});
+fs.lstatMany(paths, function(err, list) {
+  assert.ifError(err);
+  check(list, true);
+  done++;
+});
+
+assert.throws(function() {
+  fs.statManySync(file);
+}, TypeError);
+assert.throws(function() {
+  fs.statManySync([file, 'foo\u0000bar']);
+}, /null bytes/);
+fs.statMany(['foo\u0000bar'], function(err) {
+  assert.ok(/null bytes/.test(err.message));
+  done++;
+});
+
+process.on('exit', function() {
+  assert.equal(done, 3);
+  fs.unlinkSync(link);
+});
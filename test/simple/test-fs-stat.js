@@ -116,6 +116,28 @@ fs.stat(__filename, function(err, s) {
   }
 });
 
+// The dates are made lazily, from the *Ms numbers, and can be replaced.
+var s = fs.statSync(__filename);
+assert.ok(s instanceof fs.Stats);
+assert.equal(typeof s.mtimeMs, 'number');
+assert.equal(Object.keys(s).indexOf('mtime'), -1);
+assert.equal(s.mtime.getTime(), s.mtimeMs);
+assert.strictEqual(s.mtime, s.mtime);
+assert.notEqual(Object.keys(s).indexOf('mtime'), -1);
+var json = JSON.parse(JSON.stringify(s));
+assert.equal(json.size, s.size);
+assert.equal(json.atime, s.atime.toISOString());
+assert.equal(json.ctime, s.ctime.toISOString());
+assert.ok(/ctime: /.test(require('util').inspect(fs.lstatSync('.'))));
+s.atime = 42;
+assert.equal(s.atime, 42);
+
+// Made by hand, a Stats object is empty. It doesn't see the last result.
+var empty = new fs.Stats();
+assert.deepEqual(Object.keys(empty), []);
+assert.strictEqual(empty.mtime, undefined);
+assert.equal(empty.isFile(), false);
+
 process.on('exit', function() {
   assert.equal(5, success_count);
   assert.equal(false, got_error);
@@ -0,0 +1,156 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+var common = require('../common');
+var assert = require('assert');
+var fs = require('fs');
+var path = require('path');
+
+var root = path.join(common.tmpDir, 'walk');
+
+function rmrf(p) {
+  var stats;
+  try { stats = fs.lstatSync(p); } catch (e) { return; }
+  if (stats.isDirectory()) {
+    fs.readdirSync(p).forEach(function(name) { rmrf(path.join(p, name)); });
+    fs.rmdirSync(p);
+  } else {
+    fs.unlinkSync(p);
+  }
+}
+
+rmrf(root);
+['', 'sub', 'sub/deep', 'empty', 'node_modules'].forEach(function(d) {
+  fs.mkdirSync(path.join(root, d));
+});
+['a.js', 'b.txt', 'sub/c.js', 'sub/deep/d.js', 'node_modules/x.js']
+    .forEach(function(f) {
+  fs.writeFileSync(path.join(root, f), f);
+});
+fs.symlinkSync('sub', path.join(root, 'link'));
+
+var tests = [];
+var pending = 0;
+
+function walk(options, expected) {
+  pending++;
+  var entries = [];
+  var batches = 0;
+  fs.walk(root, options).on('data', function(batch) {
+    assert.ok(Array.isArray(batch));
+    assert.ok(batch.length > 0);
+    assert.ok(batch.length <= (options && options.batchSize || 256));
+    batches++;
+    batch.forEach(function(entry) {
+      assert.equal(entry.path.indexOf(root + path.sep), 0);
+      entries.push(entry.path.slice(root.length + 1).replace(/\\/g, '/') +
+                   ' ' + entry.type + ' ' + entry.depth);
+    });
+  }).on('end', function() {
+    assert.deepEqual(entries, expected);
+    if (options && options.batchSize)
+      assert.equal(batches, Math.ceil(expected.length / options.batchSize));
+    pending--;
+  });
+}
+
+// Depth first, in directory order, directories before their contents.
+var all = [
+  'a.js file 1',
+  'b.txt file 1',
+  'empty directory 1',
+  'link symlink 1',
+  'node_modules directory 1',
+  'node_modules/x.js file 2',
+  'sub directory 1',
+  'sub/c.js file 2',
+  'sub/deep directory 2',
+  'sub/deep/d.js file 3'
+];
+walk(undefined, all);
+walk({ batchSize: 3 }, all);
+walk({ batchSize: 1 }, all);
+
+walk({ depth: 1 }, all.filter(function(e) { return /1$/.test(e); }));
+walk({ depth: 2 }, all.filter(function(e) { return !/3$/.test(e); }));
+
+walk({ types: ['file'] }, all.filter(function(e) { return /file/.test(e); }));
+walk({ types: ['directory', 'symlink'] },
+     all.filter(function(e) { return !/file/.test(e); }));
+
+walk({ ignore: ['node_modules', 'deep'] },
+     all.filter(function(e) { return !/node_modules|deep/.test(e); }));
+
+walk({ extensions: ['.js'], types: ['file'] },
+     all.filter(function(e) { return /\.js /.test(e); }));
+
+// An empty directory.
+pending++;
+fs.walk(path.join(root, 'empty')).on('data', function() {
+  assert.fail('got entries');
+}).on('end', function() {
+  pending--;
+});
+
+// A root that can't be read.
+pending++;
+fs.walk(path.join(root, 'missing')).on('error', function(err) {
+  assert.equal(err.code, 'ENOENT');
+  assert.equal(err.path, path.join(root, 'missing'));
+  pending--;
+}).resume();
+
+assert.throws(function() {
+  fs.walk(root, { types: ['files'] });
+}, /Unknown entry type/);
+assert.throws(function() {
+  fs.walk(root, { depth: -1 });
+}, /depth/);
+
+// Walks and statMany() requests share a few loops for their file system
+// calls, running a lot of them doesn't leave fds open.
+if (fs.existsSync('/proc/self/fd')) {
+  var fdsBefore = fs.readdirSync('/proc/self/fd').length;
+  var left = 200;
+  for (var i = 0; i < 200; i++) {
+    pending++;
+    fs.walk(root).on('end', onwalkend).resume();
+    fs.statMany([root], function(err) {
+      assert.ifError(err);
+    });
+  }
+}
+
+function onwalkend() {
+  pending--;
+  if (--left > 0)
+    return;
+  setImmediate(function() {
+    var fds = fs.readdirSync('/proc/self/fd').length;
+    assert.ok(fds - fdsBefore < 50, (fds - fdsBefore) + ' fds more');
+  });
+}
+
+process.on('exit', function() {
+  assert.equal(pending, 0);
+  rmrf(root);
+});
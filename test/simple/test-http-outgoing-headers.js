@@ -0,0 +1,130 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+var common = require('../common');
+var assert = require('assert');
+var http = require('http');
+
+// The header block of a response, without writing it anywhere.
+function render(statusCode, reason, headers, setup) {
+  var res = new http.ServerResponse({
+    method: 'GET',
+    httpVersionMajor: 1,
+    httpVersionMinor: 1,
+    headers: {}
+  });
+  res._send = function() {};
+  res.sendDate = false;
+  if (setup) setup(res);
+  if (reason === null)
+    res.writeHead(statusCode, headers);
+  else
+    res.writeHead(statusCode, reason, headers);
+  return res;
+}
+
+// Cached status lines follow changes to the reason phrase.
+assert.equal(render(200, null, {})._header,
+             'HTTP/1.1 200 OK\r\n' +
+             'Connection: keep-alive\r\n' +
+             'Transfer-Encoding: chunked\r\n\r\n');
+assert.equal(render(200, 'Fine', {})._header.split('\r\n')[0],
+             'HTTP/1.1 200 Fine');
+assert.equal(render(200, null, {})._header.split('\r\n')[0],
+             'HTTP/1.1 200 OK');
+assert.equal(render(200.5, 'Odd', {})._header.split('\r\n')[0],
+             'HTTP/1.1 200.5 Odd');
+assert.equal(render('201', null, {})._header.split('\r\n')[0],
+             'HTTP/1.1 201 Created');
+
+// Content-Length means no chunked encoding, array values are repeated.
+var res = render(200, null, {
+  'Content-Length': 4,
+  'Set-Cookie': ['a=1', 'b=2']
+});
+assert.equal(res._header,
+             'HTTP/1.1 200 OK\r\n' +
+             'Content-Length: 4\r\n' +
+             'Set-Cookie: a=1\r\n' +
+             'Set-Cookie: b=2\r\n' +
+             'Connection: keep-alive\r\n\r\n');
+assert.equal(res.chunkedEncoding, false);
+assert.equal(res.shouldKeepAlive, true);
+
+// Field names are matched anywhere and in any case, like they always were.
+res = render(200, null, [['x-proxy-CONNECTION', 'Close'],
+                         ['Transfer-Encoding', 'gzip, chunked']]);
+assert.equal(res._last, true);
+assert.equal(res.chunkedEncoding, true);
+assert.equal(res._header.indexOf('Connection: '), -1);
+
+// No chunked 204s, the connection is closed instead.
+res = render(204, null, { 'Transfer-Encoding': 'chunked' });
+assert.equal(res.chunkedEncoding, false);
+assert.equal(res.shouldKeepAlive, false);
+
+// Response splitting.
+res = render(200, null, { 'X-Split': 'a\r\n\r\nb', 'X-Fold': 'c\n \td' });
+assert.notEqual(res._header.indexOf('X-Split: ab\r\n'), -1);
+assert.notEqual(res._header.indexOf('X-Fold: cd\r\n'), -1);
+
+// One-byte and two-byte strings end up in the header as they are.
+res = render(200, 'Très bien', { 'X-Snowman': 'snow☃man' });
+assert.equal(res._header.split('\r\n')[0], 'HTTP/1.1 200 Très bien');
+assert.notEqual(res._header.indexOf('X-Snowman: snow☃man\r\n'), -1);
+
+// The Date header looks like Date#toUTCString(), unless there's one already.
+res = render(200, null, {}, function(res) { res.sendDate = true; });
+var date = /\r\nDate: (.*)\r\n/.exec(res._header)[1];
+assert.ok(Math.abs(new Date(date) - Date.now()) < 2000);
+assert.equal(date, new Date(date).toUTCString());
+res = render(200, null, { date: 'yesterday' },
+             function(res) { res.sendDate = true; });
+assert.equal(res._header.match(/date:/ig).length, 1);
+
+// toString() is called on values and its exceptions propagate.
+assert.throws(function() {
+  render(200, null, { 'X-Bad': { toString: function() { throw 'boom'; } } });
+}, /boom/);
+
+// A toString() that builds a header block of its own doesn't clobber the
+// one it's called from. Enough fields that a bigger buffer is needed.
+var fields = {};
+for (var i = 0; i < 50; i++)
+  fields['X-Field-' + i] = 'value ' + i + ' of fifty, long enough to add up';
+var inner;
+fields['X-Nested'] = {
+  toString: function() {
+    inner = render(200, null, { 'X-Inner': 'inner' });
+    return 'outer';
+  }
+};
+for (var i = 50; i < 100; i++)
+  fields['X-Field-' + i] = 'value ' + i + ' of a hundred, again a long one';
+res = render(200, null, fields);
+assert.equal(inner._header,
+             'HTTP/1.1 200 OK\r\n' +
+             'X-Inner: inner\r\n' +
+             'Connection: keep-alive\r\n' +
+             'Transfer-Encoding: chunked\r\n\r\n');
+assert.notEqual(res._header.indexOf('\r\nX-Nested: outer\r\n'), -1);
+for (var i = 0; i < 100; i++)
+  assert.notEqual(res._header.indexOf('\r\nX-Field-' + i + ': value ' + i), -1);
@@ -0,0 +1,152 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+var common = require('../common');
+var assert = require('assert');
+
+var HTTPParser = process.binding('http_parser').HTTPParser;
+var IncomingMessage = require('_http_incoming').IncomingMessage;
+
+var CRLF = '\r\n';
+var kOnHeadersComplete = HTTPParser.kOnHeadersComplete | 0;
+
+// The parser merges the headers into an object itself in the fast case.
+// It must come out exactly like IncomingMessage#_addHeaderLines() does it.
+function parse(type, head) {
+  var parser = new HTTPParser(type);
+  var info;
+  parser[kOnHeadersComplete] = function(info_) {
+    info = info_;
+  };
+  var buf = new Buffer(head + CRLF);
+  assert.equal(parser.execute(buf, 0, buf.length), buf.length);
+  assert(info);
+  return info;
+}
+
+function expected(headers) {
+  var msg = new IncomingMessage(null);
+  msg._addHeaderLines(headers, headers.length);
+  return msg.headers;
+}
+
+function check(type, head) {
+  var info = parse(type, head);
+  assert(info.headersObject);
+  assert.deepEqual(info.headersObject, expected(info.headers));
+  assert.deepEqual(Object.keys(info.headersObject),
+                   Object.keys(expected(info.headers)));
+  return info;
+}
+
+var info = check(HTTPParser.REQUEST, [
+  'GET / HTTP/1.1',
+  'Host: example.com',
+  'user-agent: test',
+  'ACCEPT: text/html',
+  'Accept: text/plain',
+  'Cookie: a=1',
+  'cookie: b=2',
+  'Content-Type: text/plain',
+  'content-type: text/html',
+  'X-Custom: 1',
+  'x-custom: 2',
+  'X-Forwarded-For: 10.0.0.1',
+  'x-forwarded-for: 10.0.0.2',
+  'Custom: first',
+  'CUSTOM: second',
+  'Set-Cookie: a',
+  'set-cookie: b',
+  'Constructor: dropped',
+  'Empty:',
+  'Transfer-Encoding: chunked',
+  ''
+].join(CRLF));
+
+// Raw header names keep their case.
+assert.equal(info.headers[0], 'Host');
+assert.equal(info.headers[2], 'user-agent');
+assert.equal(info.headers[4], 'ACCEPT');
+assert.equal(info.headersObject.accept, 'text/html, text/plain');
+assert.deepEqual(info.headersObject['set-cookie'], ['a', 'b']);
+assert.equal(info.headersObject.custom, 'first');
+assert.equal(info.headersObject['x-custom'], '1, 2');
+assert.equal(info.headersObject.constructor, Object);
+
+check(HTTPParser.RESPONSE, [
+  'HTTP/1.1 200 OK',
+  'Date: Mon, 1 Jan 2001 00:00:00 GMT',
+  'Set-Cookie: a=1',
+  'Set-Cookie: b=2',
+  'Set-Cookie: c=3',
+  'WWW-Authenticate: Basic',
+  'www-authenticate: Digest',
+  'Content-Length: 0',
+  ''
+].join(CRLF));
+
+// End to end, including a request whose headers arrive in pieces and one
+// with too many headers for the fast path.
+var http = require('http');
+var net = require('net');
+
+var requests = 0;
+var server = http.createServer(function(req, res) {
+  assert.equal(req.headers.host, 'localhost');
+  assert.equal(req.headers.accept, 'a, b');
+  assert.equal(req.headers['x-num'], String(requests));
+  if (requests === 2)
+    assert.equal(req.headers['x-pad'].split(', ').length, 40);
+  assert.deepEqual(req.rawHeaders.slice(0, 8),
+                   ['Host', 'localhost', 'Accept', 'a', 'accept', 'b',
+                    'X-Num', String(requests)]);
+  requests++;
+  res.end();
+});
+
+server.listen(common.PORT, function() {
+  var head = 'GET / HTTP/1.1' + CRLF +
+             'Host: localhost' + CRLF +
+             'Accept: a' + CRLF +
+             'accept: b' + CRLF;
+  var c = net.connect(common.PORT, function() {
+    c.write(head + 'X-Num: 0' + CRLF + CRLF);
+    setTimeout(function() {
+      c.write(head);
+      setTimeout(function() {
+        c.write('X-Num: 1' + CRLF + CRLF);
+        var pad = '';
+        for (var i = 0; i < 40; i++)
+          pad += 'X-Pad: ' + i + CRLF;
+        c.end(head + 'X-Num: 2' + CRLF + pad + 'Connection: close' + CRLF +
+              CRLF);
+      }, 50);
+    }, 50);
+  });
+  c.resume();
+  c.on('end', function() {
+    server.close();
+  });
+});
+
+process.on('exit', function() {
+  assert.equal(requests, 3);
+});
@@ -0,0 +1,216 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// The server's parser reads straight from the socket's handle. Check that
+// bodies, pipelining, flow control, timeouts, upgrades and parse errors all
+// still work the way they do when the data goes through the socket, and that
+// 'data' listeners on the socket still see the request.
+
+var common = require('../common');
+var assert = require('assert');
+var http = require('http');
+var net = require('net');
+
+var tests = [pipelined, paused, trickle, upgrade, parseError, dataListener];
+var bodyLength = 1024 * 1024;
+
+function next() {
+  var test = tests.shift();
+  if (test) test();
+}
+
+function connect(server, cb) {
+  server.listen(common.PORT, function() {
+    cb(net.connect(common.PORT));
+  });
+}
+
+// Two requests in one write, the second one with a chunked body.
+function pipelined() {
+  var bodies = [];
+  var server = http.createServer(function(req, res) {
+    assert.ok(req.socket.parser._consumed);
+    var body = '';
+    req.setEncoding('utf8');
+    req.on('data', function(s) { body += s; });
+    req.on('end', function() {
+      bodies.push(req.method + ' ' + req.url + ' ' + body);
+      res.end();
+    });
+  });
+  connect(server, function(conn) {
+    conn.end('GET /a HTTP/1.1\r\n\r\n' +
+             'POST /b HTTP/1.1\r\n' +
+             'Transfer-Encoding: chunked\r\n\r\n' +
+             '3\r\nfoo\r\n3\r\nbar\r\n0\r\n\r\n');
+    conn.resume();
+    conn.on('close', function() {
+      assert.deepEqual(bodies, ['GET /a ', 'POST /b foobar']);
+      server.close(next);
+    });
+  });
+}
+
+// A request that doesn't read its body must stop the reads, and get all of
+// it once it does start reading.
+function paused() {
+  var server = http.createServer(function(req, res) {
+    req.pause();
+    setTimeout(function() {
+      assert.equal(req.socket._handle.reading, false);
+      assert.ok(req.socket.bytesRead < bodyLength);
+      var received = 0;
+      req.on('data', function(b) { received += b.length; });
+      req.on('end', function() {
+        assert.equal(received, bodyLength);
+        assert.ok(req.socket.bytesRead > bodyLength);
+        res.end();
+      });
+      req.resume();
+    }, 100);
+  });
+  connect(server, function(conn) {
+    var body = new Buffer(bodyLength);
+    body.fill('x');
+    conn.write('POST / HTTP/1.1\r\n' +
+               'Connection: close\r\n' +
+               'Content-Length: ' + bodyLength + '\r\n\r\n');
+    conn.end(body);
+    conn.resume();
+    conn.on('close', function() {
+      server.close(next);
+    });
+  });
+}
+
+// Reads that don't complete anything still count as socket activity.
+function trickle() {
+  var server = http.createServer(function(req, res) {
+    res.end('ok');
+  });
+  server.setTimeout(200, function() {
+    assert.fail('timed out');
+  });
+  connect(server, function(conn) {
+    var request = 'GET / HTTP/1.1\r\nX-Slow: 1\r\nConnection: close\r\n\r\n';
+    var i = 0;
+    (function write() {
+      if (i < request.length) {
+        conn.write(request.slice(i, i + 5));
+        i += 5;
+        setTimeout(write, 50);
+      }
+    })();
+    var response = '';
+    conn.setEncoding('utf8');
+    conn.on('data', function(s) { response += s; });
+    conn.on('end', function() {
+      assert.ok(/^HTTP\/1.1 200 OK/.test(response));
+      server.close(next);
+    });
+  });
+}
+
+// What comes after the headers of an upgrade is passed along, later data
+// arrives on the socket again.
+function upgrade() {
+  var server = http.createServer();
+  server.on('upgrade', function(req, socket, head) {
+    assert.equal(head.toString(), 'head');
+    assert.ok(!req.socket.parser);
+    socket.setEncoding('utf8');
+    socket.once('data', function(s) {
+      assert.equal(s, 'tail');
+      socket.end('done');
+    });
+  });
+  connect(server, function(conn) {
+    conn.write('GET / HTTP/1.1\r\n' +
+               'Connection: Upgrade\r\n' +
+               'Upgrade: test\r\n\r\nhead');
+    setTimeout(function() {
+      conn.write('tail');
+    }, 50);
+    conn.setEncoding('utf8');
+    var response = '';
+    conn.on('data', function(s) { response += s; });
+    conn.on('end', function() {
+      assert.equal(response, 'done');
+      server.close(next);
+    });
+  });
+}
+
+function parseError() {
+  var server = http.createServer(function(req, res) {
+    assert.fail('got a request');
+  });
+  var gotError = false;
+  server.on('clientError', function(err, socket) {
+    assert.equal(err.code, 'HPE_INVALID_METHOD');
+    gotError = true;
+  });
+  connect(server, function(conn) {
+    conn.end('NOT HTTP\r\n\r\n');
+    conn.resume();
+    conn.on('close', function() {
+      assert.ok(gotError);
+      server.close(next);
+    });
+  });
+}
+
+// A 'data' listener added to the socket gets the raw request bytes, and
+// the requests are still parsed.
+function dataListener() {
+  var request = 'GET /a HTTP/1.1\r\n\r\n' +
+                'POST /b HTTP/1.1\r\n' +
+                'Content-Length: 3\r\n' +
+                'Connection: close\r\n\r\nfoo';
+  var seen = '';
+  var urls = [];
+  var server = http.createServer(function(req, res) {
+    assert.ok(!req.socket.parser._consumed);
+    urls.push(req.url);
+    req.resume();
+    res.end();
+  });
+  server.on('connection', function(socket) {
+    socket.on('data', function(d) {
+      seen += d;
+    });
+  });
+  connect(server, function(conn) {
+    conn.end(request);
+    conn.resume();
+    conn.on('close', function() {
+      assert.equal(seen, request);
+      assert.deepEqual(urls, ['/a', '/b']);
+      server.close(next);
+    });
+  });
+}
+
+process.on('exit', function() {
+  assert.equal(tests.length, 0);
+});
+
+next();
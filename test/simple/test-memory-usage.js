@@ -28,3 +28,52 @@ var assert = require('assert');
 var r = process.memoryUsage();
 console.log(common.inspect(r));
 assert.equal(true, r['rss'] > 0);
+assert.equal(true, r['zlib'] >= 0);
+
+if (!process.versions.openssl)
+  return;
+
+// Buffers are held while a TLS connection is open and freed once the last
+// one is gone.
+var tls = require('tls');
+var fs = require('fs');
+
+var baseline = r['tlsBuffers'];
+var during = -1;
+var closed = 0;
+
+var server = tls.createServer({
+  key: fs.readFileSync(common.fixturesDir + '/keys/agent1-key.pem'),
+  cert: fs.readFileSync(common.fixturesDir + '/keys/agent1-cert.pem')
+}, function(socket) {
+  socket.on('close', onclose);
+  socket.end('hello');
+});
+
+server.listen(common.PORT, function() {
+  var client = tls.connect({
+    port: common.PORT,
+    rejectUnauthorized: false
+  }, function() {
+    during = process.memoryUsage().tlsBuffers;
+  });
+  client.resume();
+  client.on('close', onclose);
+});
+
+function onclose() {
+  if (++closed < 2)
+    return;
+  server.close();
+  // The native handles are freed right after the 'close' callbacks.
+  setImmediate(function() {
+    r = process.memoryUsage();
+    console.log(common.inspect(r));
+    assert(during > baseline);
+    assert.equal(r['tlsBuffers'], baseline);
+  });
+}
+
+process.on('exit', function() {
+  assert.equal(closed, 2);
+});
@@ -0,0 +1,152 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+var common = require('../common');
+var assert = require('assert');
+var crypto = require('crypto');
+var fs = require('fs');
+var net = require('net');
+var path = require('path');
+
+var filename = path.join(common.tmpDir, 'sendfile.bin');
+var data = crypto.pseudoRandomBytes(4 * 1024 * 1024);
+fs.writeFileSync(filename, data);
+
+function md5(buf) {
+  return crypto.createHash('md5').update(buf).digest('hex');
+}
+
+var tests = [
+  // Whole file through pipe(). The client stalls for a bit so the send buffer
+  // fills up and the EAGAIN path gets exercised.
+  function(socket) {
+    socket.write('header\n');
+    fs.createReadStream(filename).pipe(socket);
+    return Buffer.concat([new Buffer('header\n'), data]);
+  },
+  // A range.
+  function(socket) {
+    fs.createReadStream(filename, { start: 1000, end: 99999 }).pipe(socket);
+    return data.slice(1000, 100000);
+  },
+  // The explicit API, ordered with regular writes on both sides.
+  function(socket) {
+    var fd = fs.openSync(filename, 'r');
+    socket.write('before');
+    socket.sendFile(fd, 10, 65536, common.mustCall(function(err, sent) {
+      assert.ifError(err);
+      assert.equal(sent, 65536);
+      fs.closeSync(fd);
+      socket.end('after');
+    }));
+    return Buffer.concat([new Buffer('before'),
+                          data.slice(10, 10 + 65536),
+                          new Buffer('after')]);
+  },
+  // Writes and end() right after sendFile() wait for the file.
+  function(socket) {
+    var fd = fs.openSync(filename, 'r');
+    socket.sendFile(fd, 0, data.length, common.mustCall(function(err, sent) {
+      assert.ifError(err);
+      assert.equal(sent, data.length);
+      fs.closeSync(fd);
+    }));
+    socket.write('trailer');
+    socket.end('!');
+    return Buffer.concat([data, new Buffer('trailer!')]);
+  },
+  // Unpiped before it started, piped again.
+  function(socket) {
+    var stream = fs.createReadStream(filename, { start: 5 });
+    var unpiped = 0;
+    socket.on('unpipe', function(src) {
+      assert.equal(src, stream);
+      unpiped++;
+    });
+    stream.pipe(socket);
+    stream.unpipe(socket);
+    assert.equal(unpiped, 1);
+    stream.pipe(socket);
+    return data.slice(5);
+  }
+];
+
+var expected = [];
+var completed = 0;
+
+var server = net.createServer(function(socket) {
+  expected.push(tests[expected.length](socket));
+});
+
+server.listen(common.PORT, function() {
+  runTest(0);
+});
+
+function runTest(index) {
+  if (index === tests.length) {
+    server.close(destinationCloses);
+    return;
+  }
+
+  var chunks = [];
+  var client = net.connect(common.PORT);
+  client.pause();
+  setTimeout(function() {
+    client.resume();
+  }, 100);
+  client.on('data', function(chunk) {
+    chunks.push(chunk);
+  });
+  client.on('end', function() {
+    var received = Buffer.concat(chunks);
+    assert.equal(received.length, expected[index].length);
+    assert.equal(md5(received), md5(expected[index]));
+    completed++;
+    runTest(index + 1);
+  });
+}
+
+// The destination going away mid-transfer closes the file, and the error
+// doesn't go unhandled.
+var sourceClosed = false;
+function destinationCloses() {
+  var server = net.createServer(function(socket) {
+    var stream = fs.createReadStream(filename);
+    stream.on('close', function() {
+      sourceClosed = true;
+      server.close();
+    });
+    socket.on('error', function() {});
+    stream.pipe(socket);
+  });
+  server.listen(common.PORT, function() {
+    var client = net.connect(common.PORT);
+    client.once('data', function() {
+      client.destroy();
+    });
+  });
+}
+
+process.on('exit', function() {
+  assert.equal(completed, tests.length);
+  assert.ok(sourceClosed);
+  fs.unlinkSync(filename);
+});
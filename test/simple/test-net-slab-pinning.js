@@ -0,0 +1,90 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Flags: --expose-gc
+
+// Small reads that are kept around don't pin the slab they were read into,
+// only the slabs of reads that are still alive stay allocated.
+
+var common = require('../common');
+var assert = require('assert');
+var net = require('net');
+
+var binding = process.binding('tcp_wrap');
+var ROUNDS = 5;
+var LARGE = 2 * 1024 * 1024;
+
+var kept = [];
+var received = 0;
+var rounds = 0;
+
+var server = net.createServer(function(socket) {
+  socket.on('data', function(chunk) {
+    if (received === 0) {
+      // One small message, wait for it to be acked before anything else.
+      kept.push(chunk);
+      received = chunk.length;
+      socket.write('k');
+      return;
+    }
+    received += chunk.length;
+    if (received === 5 + LARGE) {
+      received = 0;
+      socket.write('k');
+    }
+  });
+});
+
+server.listen(common.PORT, function() {
+  var conn = net.connect(common.PORT);
+  var large = new Buffer(LARGE);
+  large.fill('y');
+  var small = true;
+
+  conn.write('hello');
+  conn.on('data', function(ack) {
+    assert.equal(ack.length, 1);
+    if (small) {
+      conn.write(large);
+    } else if (++rounds < ROUNDS) {
+      conn.write('hello');
+    } else {
+      conn.end();
+      server.close();
+    }
+    small = !small;
+  });
+});
+
+process.on('exit', function() {
+  assert.equal(rounds, ROUNDS);
+  assert.equal(kept.length, ROUNDS);
+  kept.forEach(function(chunk) {
+    assert.equal(chunk.toString(), 'hello');
+  });
+
+  gc();
+  gc();
+  var stats = binding.getSlabStats();
+  assert(stats.copies >= ROUNDS);
+  assert(stats.bytes <= 256 * 1024, stats.bytes + ' bytes held in slabs');
+});
@@ -0,0 +1,97 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// The nextTick queue is cut down while it runs when every tick queues
+// another one. Check that ticks still run once each and in order, with a
+// throwing tick in the middle, without and with domains.
+
+var common = require('../common');
+var assert = require('assert');
+
+var N = 20000;
+var runs = 0;
+
+function run(done) {
+  var ran = [];
+
+  function chain(i) {
+    ran.push(i);
+    if (i % 1000 === 0) {
+      // These run before the next one in the chain.
+      for (var j = 1; j <= 3; j++)
+        process.nextTick(extra.bind(null, i, j));
+    }
+    if (i < N)
+      process.nextTick(chain.bind(null, i + 1));
+    else
+      process.nextTick(check);
+    if (i === 5000)
+      throw new Error('tick 5000');
+  }
+
+  function extra(i, j) {
+    ran.push(i + '.' + j);
+  }
+
+  function check() {
+    var expected = [];
+    for (var i = 0; i <= N; i++) {
+      expected.push(i);
+      if (i % 1000 === 0) {
+        for (var j = 1; j <= 3; j++)
+          expected.push(i + '.' + j);
+      }
+    }
+    assert.deepEqual(ran, expected);
+    runs++;
+    done();
+  }
+
+  process.nextTick(chain.bind(null, 0));
+}
+
+var thrown = 0;
+
+process.once('uncaughtException', function(err) {
+  assert.equal(err.message, 'tick 5000');
+  thrown++;
+});
+
+run(function() {
+  var domain = require('domain');
+  var d = domain.create();
+  d.on('error', function(err) {
+    assert.equal(err.message, 'tick 5000');
+    thrown++;
+  });
+  // From the loop, so the ticks run with _tickDomainCallback.
+  setTimeout(function() {
+    d.run(function() {
+      run(function() {});
+    });
+  });
+});
+
+process.on('exit', function() {
+  assert.equal(runs, 2);
+  assert.equal(thrown, 2);
+});
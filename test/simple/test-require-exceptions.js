@@ -40,3 +40,11 @@ assert.throws(function() {
   assert.equal('MODULE_NOT_FOUND', e.code);
   return true;
 });
+
+// So should a path that can't exist
+assert.throws(function() {
+  require(common.fixturesDir + '/DOES_NOT\u0000EXIST');
+}, function(e) {
+  assert.equal('MODULE_NOT_FOUND', e.code);
+  return true;
+});
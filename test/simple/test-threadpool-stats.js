@@ -0,0 +1,51 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+var common = require('../common');
+var assert = require('assert');
+var fs = require('fs');
+
+if (process.platform === 'win32') {
+  console.error('Skipping: thread pool timings are not available on win32.');
+  process.exit(0);
+}
+
+var threadpool = process.binding('threadpool');
+threadpool.resetStats();
+
+var stats = threadpool.getStats();
+assert.equal(typeof stats.queued.io, 'number');
+assert.equal(typeof stats.queued.cpu, 'number');
+assert.equal(typeof stats.queued.dns, 'number');
+assert.deepEqual(stats.work, {});
+
+fs.stat(__filename, common.mustCall(function(err) {
+  assert.ifError(err);
+
+  var entry = threadpool.getStats().work.fs.stat;
+  assert.equal(entry.count, 1);
+  assert(entry.waitTime >= 0);
+  assert(entry.runTime >= 0);
+  assert.equal(entry.wait.length, 32);
+  assert.equal(entry.run.length, 32);
+  assert.equal(entry.wait.reduce(function(a, b) { return a + b; }), 1);
+  assert.equal(entry.run.reduce(function(a, b) { return a + b; }), 1);
+}));
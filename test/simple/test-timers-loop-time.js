@@ -0,0 +1,91 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Timer.loopTime[0] is what lib/timers.js uses instead of Timer.now(). It
+// has to be up to date in everything the loop calls into JS.
+
+var common = require('../common');
+var assert = require('assert');
+var fs = require('fs');
+var http = require('http');
+var Timer = process.binding('timer_wrap').Timer;
+
+var checks = 0;
+
+function check(what) {
+  assert.equal(Timer.loopTime[0], Timer.now(), what);
+  checks++;
+}
+
+check('startup');
+
+setTimeout(function() {
+  check('setTimeout');
+  setImmediate(function() {
+    check('setImmediate');
+    process.nextTick(function() {
+      check('nextTick');
+    });
+  });
+}, 20);
+
+fs.stat(__filename, function() {
+  check('fs.stat');
+});
+
+// The server's parser calls into JS straight from the socket's reads.
+var server = http.createServer(function(req, res) {
+  check('request');
+  req.on('data', function() {
+    check('request data');
+  });
+  req.on('end', function() {
+    res.end();
+    server.close();
+  });
+});
+server.listen(common.PORT, function() {
+  check('listen');
+  var req = http.request({
+    port: common.PORT,
+    method: 'POST'
+  }, function(res) {
+    check('response');
+    res.resume();
+  });
+  setTimeout(function() {
+    req.end('body');
+  }, 50);
+});
+
+// preciseNow() moves the loop's time forward, for timers too.
+var start = Date.now();
+while (Date.now() - start < 20);
+var before = Timer.loopTime[0];
+var now = Timer.preciseNow();
+assert.ok(now >= before + 20);
+assert.equal(Timer.loopTime[0], now);
+check('preciseNow');
+
+process.on('exit', function() {
+  assert.equal(checks, 10);
+});
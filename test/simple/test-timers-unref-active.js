@@ -0,0 +1,121 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// timers._unrefActive() timeouts live in a timing wheel. Check that they
+// never fire early, that refreshing and unenrolling work, and that a
+// throwing timeout doesn't keep the rest of its batch from running.
+
+var common = require('../common');
+var assert = require('assert');
+var timers = require('timers');
+var Timer = process.binding('timer_wrap').Timer;
+
+var fired = 0;
+var early = 0;
+
+function item(msecs, onTimeout) {
+  var item = {};
+  timers.enroll(item, msecs);
+  item._onTimeout = onTimeout || function() {
+    if (Timer.now() - this._idleStart < msecs)
+      early++;
+    fired++;
+  };
+  timers._unrefActive(item);
+  return item;
+}
+
+// Lots of them, with timeouts that end up on different levels of the wheel.
+for (var i = 0; i < 1000; i++)
+  item(1 + (i * 7) % 300);
+
+// Refreshed more often than its timeout, so it only fires after we stop.
+// Started from the loop, the time it took to get here doesn't count.
+var refreshes = 0;
+var refreshed;
+setImmediate(function() {
+  refreshed = item(100, function() {
+    assert.equal(refreshes, 10);
+    refreshed.done = true;
+  });
+  var interval = setInterval(function() {
+    if (++refreshes === 10)
+      return clearInterval(interval);
+    timers._unrefActive(refreshed);
+  }, 20);
+});
+
+// Unenrolled ones don't fire, and can be enrolled again with another
+// timeout.
+var removed = item(30, function() {
+  assert.fail('unenrolled timeout fired');
+});
+timers.unenroll(removed);
+var moved = item(400, function() {
+  assert.fail('re-enrolled with the old timeout');
+});
+timers.enroll(moved, 60);
+moved._onTimeout = function() {
+  moved.done = true;
+};
+timers._unrefActive(moved);
+
+// One of a batch throws, the others still run.
+var thrown = 0;
+var batch = 0;
+process.on('uncaughtException', function(err) {
+  assert.equal(err.message, 'boom');
+  thrown++;
+});
+setTimeout(function() {
+  for (var i = 0; i < 5; i++) {
+    item(100, function() {
+      if (batch++ === 1)
+        throw new Error('boom');
+    });
+  }
+}, 10);
+
+// Made active again, it leaves the wheel for a regular list and only fires
+// from there.
+var reffed = 0;
+var regular = item(50, function() {
+  reffed++;
+});
+timers.active(regular);
+assert.equal(regular._wheelId, -1);
+
+// Something to keep the loop alive, the timeouts themselves don't.
+setTimeout(function() {}, 600);
+item(60 * 1000, function() {
+  assert.fail('kept the loop alive');
+});
+
+process.on('exit', function() {
+  assert.equal(fired, 1000);
+  assert.equal(early, 0);
+  assert.ok(refreshed.done);
+  assert.ok(moved.done);
+  assert.equal(batch, 5);
+  assert.equal(thrown, 1);
+  assert.equal(reffed, 1);
+});
@@ -0,0 +1,160 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+var common = require('../common');
+var assert = require('assert');
+var zlib = require('zlib');
+
+// Text that repeats itself across block boundaries, so the blocks have to be
+// primed with the data before them to compress well.
+var words = ['alpha', 'beta', 'gamma', 'delta', 'epsilon', 'zeta', 'eta'];
+var seed = 1;
+var line = '';
+for (var i = 0; i < 4000; i++) {
+  seed = (seed * 16807) % 2147483647;
+  line += words[seed % words.length] + (seed % 13 ? ' ' : '\n');
+}
+var input = new Buffer(line + line + line + line + line + line + line + line);
+assert.ok(input.length > 3 * zlib.Z_MIN_BLOCKSIZE);
+
+var pending = 0;
+
+function check(name, fn, opts, decompress) {
+  pending++;
+  zlib[fn](input, opts, function(err, parallel) {
+    assert.ifError(err);
+    assert.equal(zlib[decompress](parallel).toString(), input.toString(),
+                 name);
+    zlib[fn](input, function(err, serial) {
+      assert.ifError(err);
+      assert.ok(parallel.length < serial.length * 1.02,
+                name + ': ' + parallel.length + ' vs ' + serial.length);
+      pending--;
+    });
+  });
+}
+
+[1, 2, 4].forEach(function(parallel) {
+  [zlib.Z_MIN_BLOCKSIZE, zlib.Z_DEFAULT_BLOCKSIZE].forEach(function(size) {
+    var opts = { parallel: parallel, blockSize: size };
+    var name = parallel + 'x' + size;
+    check('gzip ' + name, 'gzip', opts, 'gunzipSync');
+    check('deflateRaw ' + name, 'deflateRaw', opts, 'inflateRawSync');
+  });
+});
+
+// The gzip trailer, length and CRC32 of all of the input.
+pending++;
+zlib.gzip(input, { parallel: 4, blockSize: zlib.Z_MIN_BLOCKSIZE },
+          function(err, parallel) {
+  assert.ifError(err);
+  var serial = zlib.gzipSync(input);
+  assert.equal(parallel.readUInt32LE(parallel.length - 4), input.length);
+  assert.equal(parallel.readUInt32LE(parallel.length - 8),
+               serial.readUInt32LE(serial.length - 8));
+  assert.deepEqual(parallel.slice(0, 10), serial.slice(0, 10));
+  pending--;
+});
+
+// Empty input.
+pending++;
+zlib.gzip(new Buffer(0), { parallel: 2 }, function(err, buf) {
+  assert.ifError(err);
+  assert.equal(zlib.gunzipSync(buf).length, 0);
+  pending--;
+});
+
+// A preset dictionary primes the first block. inflateRaw doesn't take a
+// dictionary, so put it in front of the output as a stored block instead.
+pending++;
+var dictionary = new Buffer(words.join(' '));
+zlib.deflateRaw(input, { parallel: 2, dictionary: dictionary },
+                function(err, buf) {
+  assert.ifError(err);
+  var stored = new Buffer(5);
+  stored[0] = 0;  // not the last block, stored.
+  stored.writeUInt16LE(dictionary.length, 1);
+  stored.writeUInt16LE(~dictionary.length & 0xffff, 3);
+  var inflated = zlib.inflateRawSync(Buffer.concat([stored, dictionary, buf]));
+  assert.equal(inflated.slice(dictionary.length).toString(), input.toString());
+  pending--;
+});
+
+// Flushes, and new parameters half way through a stream.
+pending++;
+var gzip = zlib.createGzip({ parallel: 3, blockSize: zlib.Z_MIN_BLOCKSIZE });
+var output = [];
+gzip.on('data', function(b) { output.push(b); });
+gzip.write(input.slice(0, 100000));
+gzip.flush(function() {
+  // everything written so far can be decompressed.
+  var sofar = Buffer.concat(output);
+  var inflated = zlib.inflateRawSync(sofar.slice(10), {
+    flush: zlib.Z_SYNC_FLUSH
+  });
+  assert.equal(inflated.toString(), input.slice(0, 100000).toString());
+
+  gzip.params(zlib.Z_BEST_SPEED, zlib.Z_DEFAULT_STRATEGY, function() {
+    gzip.end(input.slice(100000));
+  });
+});
+gzip.on('end', function() {
+  assert.equal(zlib.gunzipSync(Buffer.concat(output)).toString(),
+               input.toString());
+  pending--;
+});
+
+// A reset with blocks in flight drops them, and the stream goes on.
+pending++;
+var reset = zlib.createGzip({ parallel: 2, blockSize: zlib.Z_MIN_BLOCKSIZE });
+var resetOutput = [];
+reset.on('data', function(b) { resetOutput.push(b); });
+reset.write(input);
+reset.reset();
+var resetAt = resetOutput.length;
+reset.end(input.slice(0, 1000));
+reset.on('end', function() {
+  var after = Buffer.concat(resetOutput.slice(resetAt));
+  assert.equal(zlib.gunzipSync(after).toString(),
+               input.slice(0, 1000).toString());
+  pending--;
+});
+
+assert.throws(function() {
+  zlib.createInflate({ parallel: 2 });
+}, /only supported by Gzip and DeflateRaw/);
+assert.throws(function() {
+  zlib.createGzip({ parallel: 1.5 });
+}, /Invalid parallel/);
+assert.throws(function() {
+  zlib.createGzip({ parallel: 2, blockSize: 1024 });
+}, RangeError);
+assert.throws(function() {
+  zlib.createGzip({ parallel: 2, blockSize: '65536' });
+}, /Invalid block size/);
+assert.throws(function() {
+  zlib.createGzip({ parallel: 2, blockSize: NaN });
+}, RangeError);
+
+process.on('exit', function() {
+  assert.equal(pending, 0);
+});
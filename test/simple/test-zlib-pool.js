@@ -0,0 +1,93 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+var common = require('../common');
+var assert = require('assert');
+var zlib = require('zlib');
+
+function zlibMemory() {
+  return process.memoryUsage().zlib;
+}
+
+// Closed streams are kept for reuse, up to a limit.
+var before = zlibMemory();
+var streams = [];
+for (var i = 0; i < 40; i++)
+  streams.push(zlib.createGzip({ level: 3 }));
+var open = zlibMemory() - before;
+var perStream = open / 40;
+assert.ok(perStream > 64 * 1024);
+
+streams.forEach(function(s) { s.close(); });
+assert.equal(zlibMemory() - before, 32 * perStream);
+
+// Streams with the same parameters don't allocate anything new.
+streams = [];
+for (var i = 0; i < 32; i++)
+  streams.push(zlib.createGzip({ level: 3 }));
+assert.equal(zlibMemory() - before, 32 * perStream);
+
+// Different parameters do.
+var other = zlib.createGzip({ level: 3, memLevel: 9 });
+assert.ok(zlibMemory() - before > 32 * perStream);
+other.close();
+streams.forEach(function(s) { s.close(); });
+
+// A reused stream behaves like a new one, whatever happened to the stream
+// that used it before.
+var input = new Buffer(new Array(1000).join('reuse me '));
+var expected = zlib.deflateSync(input);
+
+var withDictionary = zlib.deflateSync(input, {
+  dictionary: new Buffer('reuse me')
+});
+assert.notDeepEqual(withDictionary, expected);
+assert.deepEqual(zlib.deflateSync(input), expected);
+
+var paramsChanged = zlib.createDeflate();
+paramsChanged.write(input.slice(0, 100));
+paramsChanged.params(zlib.Z_BEST_SPEED, zlib.Z_DEFAULT_STRATEGY, function() {
+  paramsChanged.end(input.slice(100));
+  paramsChanged.resume();
+  paramsChanged.on('end', function() {
+    // the stream went back with the new level, and gets reused for it.
+    var best = zlib.deflateSync(input, { level: zlib.Z_BEST_SPEED });
+    assert.equal(zlib.inflateSync(best).toString(), input.toString());
+    assert.deepEqual(zlib.deflateSync(input), expected);
+    done++;
+  });
+});
+
+var inflate = zlib.createInflate();
+inflate.write(expected.slice(0, 20));
+inflate.close();
+assert.equal(zlib.inflateSync(expected).toString(), input.toString());
+
+assert.equal(zlib.gunzipSync(zlib.gzipSync(input)).toString(),
+             input.toString());
+assert.equal(zlib.gunzipSync(zlib.gzipSync(input)).toString(),
+             input.toString());
+
+var done = 0;
+process.on('exit', function() {
+  assert.equal(done, 1);
+});
@@ -0,0 +1,119 @@
+// Copyright Joyent, Inc. and other Node contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN
+// NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+// USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+var common = require('../common');
+var assert = require('assert');
+var zlib = require('zlib');
+
+var small = '{"id":42,"name":"small json body","tags":["a","b","c"]}';
+var large = new Buffer(256 * 1024);
+for (var i = 0; i < large.length; i++)
+  large[i] = i * i % 251 < 100 ? 97 : i & 0xff;
+
+var pairs = [
+  ['deflateSync', 'inflateSync', 'deflate'],
+  ['gzipSync', 'gunzipSync', 'gzip'],
+  ['deflateRawSync', 'inflateRawSync', 'deflateRaw'],
+  ['gzipSync', 'unzipSync', 'gzip']
+];
+
+// Round trips, and the same output as the asynchronous versions. Inline
+// and thread pool writes must not make a difference either.
+var pending = 0;
+pairs.forEach(function(pair) {
+  [small, large].forEach(function(input) {
+    var compressed = zlib[pair[0]](input);
+    assert.ok(Buffer.isBuffer(compressed));
+    var inflated = zlib[pair[1]](compressed);
+    assert.equal(inflated.toString('binary'),
+                 Buffer.isBuffer(input) ? input.toString('binary') : input);
+
+    [0, zlib.Z_DEFAULT_INLINE_THRESHOLD, Infinity].forEach(function(t) {
+      pending++;
+      zlib[pair[2]](input, { inlineThreshold: t }, function(err, buf) {
+        assert.ifError(err);
+        assert.deepEqual(buf, compressed);
+        pending--;
+      });
+    });
+  });
+});
+
+// Small input that inflates to many output chunks.
+var zeros = new Buffer(512 * 1024);
+zeros.fill(0);
+zeros = zlib.deflateSync(zeros);
+assert.ok(zeros.length < zlib.Z_DEFAULT_INLINE_THRESHOLD);
+assert.equal(zlib.inflateSync(zeros).length, 512 * 1024);
+pending++;
+zlib.inflate(zeros, function(err, buf) {
+  assert.ifError(err);
+  assert.equal(buf.length, 512 * 1024);
+  pending--;
+});
+
+// Errors are thrown by the synchronous functions.
+assert.throws(function() {
+  zlib.inflateSync(new Buffer('not deflated'));
+}, function(err) {
+  return err.code === 'Z_DATA_ERROR';
+});
+assert.throws(function() {
+  zlib.gzipSync(42);
+}, TypeError);
+
+// Failed calls close their handle right away, they don't wait for GC.
+var before = process.memoryUsage().zlib;
+for (var i = 0; i < 100; i++) {
+  assert.throws(function() {
+    zlib.inflateSync(new Buffer('not deflated'));
+  });
+}
+assert.equal(process.memoryUsage().zlib, before);
+
+// An inline write still delivers its output asynchronously.
+var sync = true;
+var deflate = zlib.createDeflate({ flush: zlib.Z_SYNC_FLUSH });
+deflate.on('data', function() {
+  assert.equal(sync, false);
+  pending--;
+});
+pending++;
+deflate.write(small);
+sync = false;
+
+// And reports errors asynchronously too.
+var errors = 0;
+var inflate = zlib.createInflate();
+inflate.write(new Buffer('not deflated'));
+inflate.on('error', function(err) {
+  assert.equal(err.code, 'Z_DATA_ERROR');
+  errors++;
+});
+
+assert.throws(function() {
+  zlib.createDeflate({ inlineThreshold: -1 });
+}, /Invalid inlineThreshold/);
+
+process.on('exit', function() {
+  assert.equal(pending, 0);
+  assert.equal(errors, 1);
+});